@@ -27,6 +27,14 @@
  * and provide memory allocation as well as file operation callbacks. 
  * Should be zero-initialized to trigger default behavior.
  *
+ * Setting `memory.arena` makes `cgltf_parse()` place everything owned by the
+ * returned `cgltf_data` in large blocks obtained from `memory.alloc`. The data's
+ * `memory` then refers to the arena: allocating through it is a pointer bump,
+ * freeing through it only releases memory the arena did not hand out (such as
+ * buffers loaded by `cgltf_load_buffers()`), and `cgltf_free()` releases all
+ * blocks at once instead of walking the data. Short strings are interned in
+ * this mode and must not be modified in place.
+ *
  * `cgltf_data` is the struct allocated and filled by `cgltf_parse()`.
  * It generally mirrors the glTF format as described by the spec (see
  * https://github.com/KhronosGroup/glTF/tree/master/specification/2.0).
@@ -38,7 +46,11 @@
  * const char* gltf_path)` can be optionally called to open and read buffer
  * files using the `FILE*` APIs. The `gltf_path` argument is the path to
  * the original glTF file, which allows the parser to resolve the path to
- * buffer files.
+ * buffer files. With `lazy_buffers` set in the options, buffer files are
+ * only resolved and are read through the data's file callbacks the first
+ * time `cgltf_buffer_data()` or `cgltf_buffer_view_data()` asks for them;
+ * this is not thread safe, and code that reads `cgltf_buffer::data`
+ * directly sees NULL until then.
  *
  * `cgltf_result cgltf_load_buffer_base64(const cgltf_options* options,
  * cgltf_size size, const char* base64, void** out_data)` decodes
@@ -80,6 +92,12 @@
  * `cgltf_accessor_read_index` is similar to its floating-point counterpart, but it returns size_t
  * and only works with single-component data types.
  *
+ * `cgltf_json_span` records where an object was found in the glTF JSON data.
+ * `cgltf_data::vrm_v0_0_spans` holds one for each member of the VRM
+ * extension, and `cgltf_write` copies those members from the source text as
+ * they were instead of serializing them again. Code that modifies one of
+ * them through `cgltf_data::vrm_v0_0` has to set its `dirty` flag.
+ *
  * `cgltf_result cgltf_copy_extras_json(const cgltf_data*, const cgltf_extras*,
  * char* dest, cgltf_size* dest_size)` allows users to retrieve the "extras" data that
  * can be attached to many glTF objects (which can be arbitrary JSON data). The
@@ -93,6 +111,7 @@
 #define CGLTF_H_INCLUDED__
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -130,6 +149,8 @@ typedef struct cgltf_memory_options
 	void* (*alloc)(void* user, cgltf_size size);
 	void (*free) (void* user, void* ptr);
 	void* user_data;
+	/* when set, cgltf_parse serves the returned data from an arena; see cgltf_parse */
+	cgltf_bool arena;
 } cgltf_memory_options;
 
 typedef struct cgltf_file_options
@@ -145,8 +166,17 @@ typedef struct cgltf_options
 	cgltf_size json_token_count; /* 0 == auto */
 	cgltf_memory_options memory;
 	cgltf_file_options file;
+	cgltf_bool lazy_buffers; /* cgltf_load_buffers defers reading buffer files to their first access */
+	cgltf_bool write_compact; /* cgltf_write omits line breaks and indentation */
 } cgltf_options;
 
+typedef enum cgltf_data_free_method
+{
+	cgltf_data_free_method_none,
+	cgltf_data_free_method_file_release,
+	cgltf_data_free_method_memory_free,
+} cgltf_data_free_method;
+
 typedef enum cgltf_buffer_view_type
 {
 	cgltf_buffer_view_type_invalid,
@@ -244,11 +274,20 @@ typedef struct cgltf_extension {
 	char* data;
 } cgltf_extension;
 
+typedef struct cgltf_json_span {
+	cgltf_size start_offset;
+	cgltf_size end_offset;
+	cgltf_bool dirty;
+} cgltf_json_span;
+
 typedef struct cgltf_buffer
 {
 	cgltf_size size;
 	char* uri;
-	void* data; /* loaded by cgltf_load_buffers */
+	void* data; /* loaded by cgltf_load_buffers, or by cgltf_buffer_data for lazy buffers */
+	cgltf_data_free_method data_free_method;
+	char* lazy_path; /* resolved path of a buffer file that is read on first access */
+	struct cgltf_data* lazy_owner; /* provides the file and memory callbacks for reading it */
 	cgltf_extras extras;
 	cgltf_size extensions_count;
 	cgltf_extension* extensions;
@@ -652,6 +691,15 @@ typedef struct cgltf_asset {
 
 #ifdef CGLTF_VRM_v0_0
 #include "vrm/vrm_types.v0_0.h"
+
+typedef struct cgltf_vrm_spans_v0_0 {
+	cgltf_json_span meta;
+	cgltf_json_span humanoid;
+	cgltf_json_span firstPerson;
+	cgltf_json_span blendShapeMaster;
+	cgltf_json_span secondaryAnimation;
+	cgltf_json_span materialProperties;
+} cgltf_vrm_spans_v0_0;
 #endif
 
 #ifdef CGLTF_VRM_v1_0
@@ -732,6 +780,7 @@ typedef struct cgltf_data
 #ifdef CGLTF_VRM_v0_0
 	cgltf_vrm_v0_0 vrm_v0_0;
 	cgltf_bool has_vrm_v0_0;
+	cgltf_vrm_spans_v0_0 vrm_v0_0_spans;
 #endif
 
 #ifdef CGLTF_VRM_v1_0
@@ -761,10 +810,16 @@ cgltf_result cgltf_load_buffer_base64(const cgltf_options* options, cgltf_size s
 
 void cgltf_decode_uri(char* uri);
 
+void* cgltf_buffer_data(cgltf_buffer* buffer);
+const uint8_t* cgltf_buffer_view_data(const cgltf_buffer_view* view);
+
 cgltf_result cgltf_validate(cgltf_data* data);
 
 void cgltf_free(cgltf_data* data);
 
+/* Releases the contents of a buffer according to its data_free_method, e.g. before replacing them */
+void cgltf_free_buffer_data(cgltf_data* data, cgltf_buffer* buffer);
+
 void cgltf_node_transform_local(const cgltf_node* node, cgltf_float* out_matrix);
 void cgltf_node_transform_world(const cgltf_node* node, cgltf_float* out_matrix);
 
@@ -803,8 +858,80 @@ cgltf_result cgltf_copy_extras_json(const cgltf_data* data, const cgltf_extras*
 #include <stdio.h>  /* For fopen */
 #include <limits.h> /* For UINT_MAX etc */
 
-#if !defined(CGLTF_MALLOC) || !defined(CGLTF_FREE) || !defined(CGLTF_ATOI) || !defined(CGLTF_ATOF)
-#include <stdlib.h> /* For malloc, free, atoi, atof */
+#include <float.h>  /* For FLT_EVAL_METHOD, FLT_MIN */
+
+#if !defined(CGLTF_MALLOC) || !defined(CGLTF_FREE) || !defined(CGLTF_ATOI) || !defined(CGLTF_ATOF) || !defined(CGLTF_STRTOF)
+#include <stdlib.h> /* For malloc, free, atoi, atof, strtof */
+#endif
+
+/* The block below detects the SIMD ISA used by the JSON scanner and the base64 decoder; define CGLTF_NO_SIMD to use scalar code only */
+#ifndef CGLTF_NO_SIMD
+
+/* The JSON scanner only needs SSE2, which is part of the x86-64 baseline */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CGLTF_SIMD_SSE2
+#endif
+
+/* The base64 decoder requires SSSE3, which can be enabled unconditionally through compiler settings */
+#if defined(__AVX__) || defined(__SSSE3__)
+#define CGLTF_SIMD_SSSE3
+#endif
+
+/* An AVX2 version of the base64 decoder is only enabled when AVX2 is enabled through compiler settings */
+#if defined(__AVX2__)
+#define CGLTF_SIMD_AVX2
+#endif
+
+/* MSVC supports compiling SSSE3 code regardless of compile options; we use a cpuid-based scalar fallback */
+#if !defined(CGLTF_SIMD_SSSE3) && defined(_MSC_VER) && !defined(__clang__) && (defined(_M_IX86) || defined(_M_X64))
+#define CGLTF_SIMD_SSSE3
+#define CGLTF_SIMD_FALLBACK
+#endif
+
+/* GCC 4.9+ and clang 3.8+ support targeting SIMD ISA from individual functions; we use a cpuid-based scalar fallback */
+#if !defined(CGLTF_SIMD_SSSE3) && ((defined(__clang__) && __clang_major__ * 100 + __clang_minor__ >= 308) || (defined(__GNUC__) && __GNUC__ * 100 + __GNUC_MINOR__ >= 409)) && (defined(__i386__) || defined(__x86_64__))
+#define CGLTF_SIMD_SSSE3
+#define CGLTF_SIMD_FALLBACK
+#define CGLTF_SIMD_TARGET __attribute__((target("ssse3")))
+#endif
+
+/* GCC/clang define these when NEON support is available; on MSVC, we assume that ARM builds always target NEON-capable devices */
+#if defined(__ARM_NEON__) || defined(__ARM_NEON) || (defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64)))
+#define CGLTF_SIMD_NEON
+#endif
+
+#endif /* !CGLTF_NO_SIMD */
+
+#ifndef CGLTF_SIMD_TARGET
+#define CGLTF_SIMD_TARGET
+#endif
+
+#ifdef CGLTF_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef CGLTF_SIMD_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#ifdef CGLTF_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+#ifdef CGLTF_SIMD_FALLBACK
+#ifdef _MSC_VER
+#include <intrin.h> /* For __cpuid */
+#else
+#include <cpuid.h> /* For __cpuid */
+#endif
+#endif
+
+#ifdef CGLTF_SIMD_NEON
+#if defined(_MSC_VER) && defined(_M_ARM64)
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
 #endif
 
 /* JSMN_PARENT_LINKS is necessary to make parsing large structures linear in input size */
@@ -841,6 +968,7 @@ typedef struct {
 #ifdef JSMN_PARENT_LINKS
 	int parent;
 #endif
+	int key; /* cgltf_json_key id of a string token, set by cgltf_parse_json */
 } jsmntok_t;
 typedef struct {
 	unsigned int pos; /* offset in the JSON string */
@@ -873,6 +1001,9 @@ static const uint32_t GlbMagicBinChunk = 0x004E4942;
 #ifndef CGLTF_ATOF
 #define CGLTF_ATOF(str) atof(str)
 #endif
+#ifndef CGLTF_STRTOF
+#define CGLTF_STRTOF(str) strtof(str, NULL)
+#endif
 
 static void* cgltf_default_alloc(void* user, cgltf_size size)
 {
@@ -901,6 +1032,228 @@ static void* cgltf_calloc(cgltf_options* options, size_t element_size, cgltf_siz
 	return result;
 }
 
+/* Arena blocks grow from the first size up to the last; allocations above the large size get blocks of their own so that freeing them returns the memory */
+#define CGLTF_ARENA_ALIGN 16
+#define CGLTF_ARENA_FIRST_BLOCK_SIZE 65536
+#define CGLTF_ARENA_LAST_BLOCK_SIZE 1048576
+#define CGLTF_ARENA_LARGE_SIZE 8192
+#define CGLTF_ARENA_INTERN_LENGTH 64
+
+typedef struct cgltf_arena_block
+{
+	struct cgltf_arena_block* next;
+	cgltf_size size;
+	cgltf_size used;
+} cgltf_arena_block;
+
+typedef struct cgltf_arena
+{
+	cgltf_memory_options upstream;
+	cgltf_arena_block* blocks; /* the block being filled comes first */
+	cgltf_arena_block* large;
+	char** strings; /* open addressing table of interned strings */
+	cgltf_size strings_capacity;
+	cgltf_size strings_count;
+} cgltf_arena;
+
+#define CGLTF_ARENA_HEADER_SIZE ((sizeof(cgltf_arena_block) + CGLTF_ARENA_ALIGN - 1) & ~(cgltf_size)(CGLTF_ARENA_ALIGN - 1))
+
+static cgltf_arena_block* cgltf_arena_add_block(cgltf_arena* arena, cgltf_arena_block** list, cgltf_size size)
+{
+	cgltf_arena_block* block = (cgltf_arena_block*)arena->upstream.alloc(arena->upstream.user_data, CGLTF_ARENA_HEADER_SIZE + size);
+	if (!block)
+	{
+		return NULL;
+	}
+	block->next = *list;
+	block->size = size;
+	block->used = 0;
+	*list = block;
+	return block;
+}
+
+static void* cgltf_arena_alloc(void* user, cgltf_size size)
+{
+	cgltf_arena* arena = (cgltf_arena*)user;
+	if (size > CGLTF_ARENA_LARGE_SIZE)
+	{
+		cgltf_arena_block* large = cgltf_arena_add_block(arena, &arena->large, size);
+		return large ? (char*)large + CGLTF_ARENA_HEADER_SIZE : NULL;
+	}
+
+	/* zero sized allocations still get a unique address inside the block */
+	size = size ? (size + CGLTF_ARENA_ALIGN - 1) & ~(cgltf_size)(CGLTF_ARENA_ALIGN - 1) : CGLTF_ARENA_ALIGN;
+
+	cgltf_arena_block* block = arena->blocks;
+	if (!block || block->size - block->used < size)
+	{
+		cgltf_size block_size = block ? block->size * 2 : CGLTF_ARENA_FIRST_BLOCK_SIZE;
+		block = cgltf_arena_add_block(arena, &arena->blocks, block_size < CGLTF_ARENA_LAST_BLOCK_SIZE ? block_size : CGLTF_ARENA_LAST_BLOCK_SIZE);
+		if (!block)
+		{
+			return NULL;
+		}
+	}
+
+	void* result = (char*)block + CGLTF_ARENA_HEADER_SIZE + block->used;
+	block->used += size;
+	return result;
+}
+
+static void cgltf_arena_free(void* user, void* ptr)
+{
+	cgltf_arena* arena = (cgltf_arena*)user;
+	if (!ptr)
+	{
+		return;
+	}
+
+	for (cgltf_arena_block* block = arena->blocks; block; block = block->next)
+	{
+		char* begin = (char*)block + CGLTF_ARENA_HEADER_SIZE;
+		if ((char*)ptr >= begin && (char*)ptr < begin + block->size)
+		{
+			return;
+		}
+	}
+
+	for (cgltf_arena_block** link = &arena->large; *link; link = &(*link)->next)
+	{
+		cgltf_arena_block* block = *link;
+		if ((char*)block + CGLTF_ARENA_HEADER_SIZE == ptr)
+		{
+			*link = block->next;
+			arena->upstream.free(arena->upstream.user_data, block);
+			return;
+		}
+	}
+
+	/* memory from outside the arena, e.g. buffers loaded with the caller's allocator */
+	arena->upstream.free(arena->upstream.user_data, ptr);
+}
+
+static cgltf_arena* cgltf_arena_of(const cgltf_memory_options* memory)
+{
+	return memory->free == &cgltf_arena_free ? (cgltf_arena*)memory->user_data : NULL;
+}
+
+static cgltf_arena* cgltf_arena_create(const cgltf_memory_options* upstream)
+{
+	cgltf_arena* arena = (cgltf_arena*)upstream->alloc(upstream->user_data, sizeof(cgltf_arena));
+	if (!arena)
+	{
+		return NULL;
+	}
+	memset(arena, 0, sizeof(cgltf_arena));
+	arena->upstream = *upstream;
+	arena->upstream.arena = 0;
+	return arena;
+}
+
+static void cgltf_arena_destroy(cgltf_arena* arena)
+{
+	cgltf_memory_options upstream = arena->upstream;
+	cgltf_arena_block* lists[2] = { arena->blocks, arena->large };
+	for (int i = 0; i < 2; ++i)
+	{
+		while (lists[i])
+		{
+			cgltf_arena_block* next = lists[i]->next;
+			upstream.free(upstream.user_data, lists[i]);
+			lists[i] = next;
+		}
+	}
+	upstream.free(upstream.user_data, arena->strings);
+	upstream.free(upstream.user_data, arena);
+}
+
+static cgltf_memory_options cgltf_arena_memory(cgltf_arena* arena)
+{
+	cgltf_memory_options memory = { &cgltf_arena_alloc, &cgltf_arena_free, arena, 0 };
+	return memory;
+}
+
+static char* cgltf_arena_intern(cgltf_arena* arena, const char* str, cgltf_size length)
+{
+	/* strings that cgltf_decode_uri may rewrite in place are never shared */
+	if (length > CGLTF_ARENA_INTERN_LENGTH || memchr(str, '%', length) || memchr(str, '\\', length))
+	{
+		char* result = (char*)cgltf_arena_alloc(arena, length + 1);
+		if (result)
+		{
+			memcpy(result, str, length);
+			result[length] = 0;
+		}
+		return result;
+	}
+
+	if (arena->strings_count * 2 >= arena->strings_capacity)
+	{
+		cgltf_size capacity = arena->strings_capacity ? arena->strings_capacity * 2 : 256;
+		char** strings = (char**)arena->upstream.alloc(arena->upstream.user_data, sizeof(char*) * capacity);
+		if (!strings)
+		{
+			return NULL;
+		}
+		memset(strings, 0, sizeof(char*) * capacity);
+
+		for (cgltf_size i = 0; i < arena->strings_capacity; ++i)
+		{
+			char* entry = arena->strings[i];
+			if (!entry)
+			{
+				continue;
+			}
+
+			/* FNV-1a */
+			uint32_t hash = 2166136261u;
+			for (const char* c = entry; *c; ++c)
+			{
+				hash = (hash ^ (uint8_t)*c) * 16777619u;
+			}
+
+			cgltf_size slot = hash & (capacity - 1);
+			while (strings[slot])
+			{
+				slot = (slot + 1) & (capacity - 1);
+			}
+			strings[slot] = entry;
+		}
+
+		arena->upstream.free(arena->upstream.user_data, arena->strings);
+		arena->strings = strings;
+		arena->strings_capacity = capacity;
+	}
+
+	uint32_t hash = 2166136261u;
+	for (cgltf_size i = 0; i < length; ++i)
+	{
+		hash = (hash ^ (uint8_t)str[i]) * 16777619u;
+	}
+
+	cgltf_size slot = hash & (arena->strings_capacity - 1);
+	for (; arena->strings[slot]; slot = (slot + 1) & (arena->strings_capacity - 1))
+	{
+		char* entry = arena->strings[slot];
+		if (strncmp(entry, str, length) == 0 && entry[length] == 0)
+		{
+			return entry;
+		}
+	}
+
+	char* result = (char*)cgltf_arena_alloc(arena, length + 1);
+	if (!result)
+	{
+		return NULL;
+	}
+	memcpy(result, str, length);
+	result[length] = 0;
+
+	arena->strings[slot] = result;
+	arena->strings_count++;
+	return result;
+}
+
 static cgltf_result cgltf_default_file_read(const struct cgltf_memory_options* memory_options, const struct cgltf_file_options* file_options, const char* path, cgltf_size* size, void** data)
 {
 	(void)file_options;
@@ -1177,6 +1530,128 @@ static cgltf_result cgltf_load_buffer_file(const cgltf_options* options, cgltf_s
 	return result;
 }
 
+/* 6-bit values of base64 characters, -1 for characters outside of the alphabet */
+static const signed char cgltf_base64_values[256] = {
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+	-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+	-1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+/* SIMD decoding follows Wojciech Mula's base64 algorithm: characters are validated and translated to 6-bit values through
+ * nibble lookup tables, then packed to bytes with multiply-add. Each call returns the number of characters it consumed,
+ * always a multiple of four; it stops early at the first block with an invalid character and leaves it to the scalar loop. */
+#ifdef CGLTF_SIMD_SSSE3
+static CGLTF_SIMD_TARGET cgltf_size cgltf_decode_base64_ssse3(const char* base64, cgltf_size length, unsigned char* data, cgltf_size size)
+{
+	const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i mask_2f = _mm_set1_epi8(0x2f);
+	const __m128i zero = _mm_setzero_si128();
+
+	cgltf_size read = 0, written = 0;
+
+	/* every block stores 16 bytes, of which 12 are decoded data */
+	while (read + 16 <= length && written + 16 <= size)
+	{
+		__m128i in = _mm_loadu_si128((const __m128i*)(base64 + read));
+
+		__m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2f);
+		__m128i lo = _mm_shuffle_epi8(lut_lo, _mm_and_si128(in, mask_2f));
+		__m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)) != 0xffff)
+			break;
+
+		__m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(in, mask_2f), hi_nibbles));
+		__m128i values = _mm_add_epi8(in, roll);
+
+		__m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+		__m128i out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+		_mm_storeu_si128((__m128i*)(data + written), out);
+
+		read += 16;
+		written += 12;
+	}
+
+	return read;
+}
+#endif
+
+#ifdef CGLTF_SIMD_AVX2
+static cgltf_size cgltf_decode_base64_avx2(const char* base64, cgltf_size length, unsigned char* data, cgltf_size size)
+{
+	const __m256i lut_lo = _mm256_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m256i lut_hi = _mm256_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m256i lut_roll = _mm256_setr_epi8(
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i shuffle = _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+
+	cgltf_size read = 0, written = 0;
+
+	/* every block stores 32 bytes, of which 24 are decoded data */
+	while (read + 32 <= length && written + 32 <= size)
+	{
+		__m256i in = _mm256_loadu_si256((const __m256i*)(base64 + read));
+
+		__m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+		__m256i lo = _mm256_shuffle_epi8(lut_lo, _mm256_and_si256(in, mask_2f));
+		__m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+
+		if (!_mm256_testz_si256(lo, hi))
+			break;
+
+		__m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2f), hi_nibbles));
+		__m256i values = _mm256_add_epi8(in, roll);
+
+		__m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+		__m256i out = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, shuffle), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+		_mm256_storeu_si256((__m256i*)(data + written), out);
+
+		read += 32;
+		written += 24;
+	}
+
+	return read;
+}
+#endif
+
+#ifdef CGLTF_SIMD_FALLBACK
+static int cgltf_has_ssse3(void)
+{
+	int cpuinfo[4] = { 0, 0, 0, 0 };
+#ifdef _MSC_VER
+	__cpuid(cpuinfo, 1);
+#else
+	__cpuid(1, cpuinfo[0], cpuinfo[1], cpuinfo[2], cpuinfo[3]);
+#endif
+	return (cpuinfo[2] & (1 << 9)) != 0;
+}
+#endif
+
 cgltf_result cgltf_load_buffer_base64(const cgltf_options* options, cgltf_size size, const char* base64, void** out_data)
 {
 	void* (*memory_alloc)(void*, cgltf_size) = options->memory.alloc ? options->memory.alloc : &cgltf_default_alloc;
@@ -1188,22 +1663,57 @@ cgltf_result cgltf_load_buffer_base64(const cgltf_options* options, cgltf_size s
 		return cgltf_result_out_of_memory;
 	}
 
+	/* block decoders load several characters at once, so they must not run past the end of the string */
+	cgltf_size length = strlen(base64);
+	cgltf_size read = 0;
+
+#ifdef CGLTF_SIMD_AVX2
+	read += cgltf_decode_base64_avx2(base64 + read, length - read, data + read / 4 * 3, size - read / 4 * 3);
+#endif
+
+#if defined(CGLTF_SIMD_SSSE3) && defined(CGLTF_SIMD_FALLBACK)
+	if (cgltf_has_ssse3())
+	{
+		read += cgltf_decode_base64_ssse3(base64 + read, length - read, data + read / 4 * 3, size - read / 4 * 3);
+	}
+#elif defined(CGLTF_SIMD_SSSE3)
+	read += cgltf_decode_base64_ssse3(base64 + read, length - read, data + read / 4 * 3, size - read / 4 * 3);
+#endif
+
+	const unsigned char* chars = (const unsigned char*)base64 + read;
+	cgltf_size i = read / 4 * 3;
+
+	for (; i + 3 <= size && read + 4 <= length; i += 3)
+	{
+		int a = cgltf_base64_values[chars[0]];
+		int b = cgltf_base64_values[chars[1]];
+		int c = cgltf_base64_values[chars[2]];
+		int d = cgltf_base64_values[chars[3]];
+
+		if ((a | b | c | d) < 0)
+		{
+			memory_free(options->memory.user_data, data);
+			return cgltf_result_io_error;
+		}
+
+		unsigned int value = (a << 18) | (b << 12) | (c << 6) | d;
+
+		data[i + 0] = (unsigned char)(value >> 16);
+		data[i + 1] = (unsigned char)(value >> 8);
+		data[i + 2] = (unsigned char)(value);
+
+		chars += 4;
+		read += 4;
+	}
+
 	unsigned int buffer = 0;
 	unsigned int buffer_bits = 0;
 
-	for (cgltf_size i = 0; i < size; ++i)
+	for (; i < size; ++i)
 	{
 		while (buffer_bits < 8)
 		{
-			char ch = *base64++;
-
-			int index =
-				(unsigned)(ch - 'A') < 26 ? (ch - 'A') :
-				(unsigned)(ch - 'a') < 26 ? (ch - 'a') + 26 :
-				(unsigned)(ch - '0') < 10 ? (ch - '0') + 52 :
-				ch == '+' ? 62 :
-				ch == '/' ? 63 :
-				-1;
+			int index = cgltf_base64_values[*chars++];
 
 			if (index < 0)
 			{
@@ -1278,6 +1788,7 @@ cgltf_result cgltf_load_buffers(const cgltf_options* options, cgltf_data* data,
 		}
 
 		data->buffers[0].data = (void*)data->bin;
+		data->buffers[0].data_free_method = cgltf_data_free_method_none;
 	}
 
 	for (cgltf_size i = 0; i < data->buffers_count; ++i)
@@ -1301,6 +1812,7 @@ cgltf_result cgltf_load_buffers(const cgltf_options* options, cgltf_data* data,
 			if (comma && comma - uri >= 7 && strncmp(comma - 7, ";base64", 7) == 0)
 			{
 				cgltf_result res = cgltf_load_buffer_base64(options, data->buffers[i].size, comma + 1, &data->buffers[i].data);
+				data->buffers[i].data_free_method = cgltf_data_free_method_memory_free;
 
 				if (res != cgltf_result_success)
 				{
@@ -1312,9 +1824,30 @@ cgltf_result cgltf_load_buffers(const cgltf_options* options, cgltf_data* data,
 				return cgltf_result_unknown_format;
 			}
 		}
+		else if (strstr(uri, "://") == NULL && gltf_path && options->lazy_buffers)
+		{
+			if (data->buffers[i].lazy_path)
+			{
+				continue;
+			}
+
+			// the path is owned by the data, which also reads and releases the file later on
+			char* path = (char*)data->memory.alloc(data->memory.user_data, strlen(uri) + strlen(gltf_path) + 1);
+			if (!path)
+			{
+				return cgltf_result_out_of_memory;
+			}
+
+			cgltf_combine_paths(path, gltf_path, uri);
+			cgltf_decode_uri(path + strlen(path) - strlen(uri));
+
+			data->buffers[i].lazy_path = path;
+			data->buffers[i].lazy_owner = data;
+		}
 		else if (strstr(uri, "://") == NULL && gltf_path)
 		{
 			cgltf_result res = cgltf_load_buffer_file(options, data->buffers[i].size, uri, gltf_path, &data->buffers[i].data);
+			data->buffers[i].data_free_method = cgltf_data_free_method_file_release;
 
 			if (res != cgltf_result_success)
 			{
@@ -1684,6 +2217,26 @@ static void cgltf_vrm_v0_0_free(const struct cgltf_memory_options* memory, cgltf
 static void cgltf_vrmc_vrm_v1_0_free(const struct cgltf_memory_options* memory, cgltf_vrmc_vrm_v1_0* data);
 #endif
 
+void cgltf_free_buffer_data(cgltf_data* data, cgltf_buffer* buffer)
+{
+	void (*file_release)(const struct cgltf_memory_options*, const struct cgltf_file_options*, void* data) = data->file.release ? data->file.release : cgltf_default_file_release;
+
+	switch (buffer->data_free_method)
+	{
+	case cgltf_data_free_method_file_release:
+		file_release(&data->memory, &data->file, buffer->data);
+		break;
+	case cgltf_data_free_method_memory_free:
+		data->memory.free(data->memory.user_data, buffer->data);
+		break;
+	default:
+		break;
+	}
+
+	buffer->data = NULL;
+	buffer->data_free_method = cgltf_data_free_method_none;
+}
+
 void cgltf_free(cgltf_data* data)
 {
 	if (!data)
@@ -1693,6 +2246,21 @@ void cgltf_free(cgltf_data* data)
 
 	void (*file_release)(const struct cgltf_memory_options*, const struct cgltf_file_options*, void* data) = data->file.release ? data->file.release : cgltf_default_file_release;
 
+	cgltf_arena* arena = cgltf_arena_of(&data->memory);
+	if (arena)
+	{
+		/* only buffers and the file data can live outside the arena; everything else goes away with its blocks */
+		for (cgltf_size i = 0; i < data->buffers_count; ++i)
+		{
+			cgltf_free_buffer_data(data, &data->buffers[i]);
+		}
+
+		file_release(&data->memory, &data->file, data->file_data);
+
+		cgltf_arena_destroy(arena);
+		return;
+	}
+
 #ifdef CGLTF_VRM_v0_0_IMPLEMENTATION
 	cgltf_vrm_v0_0_free(&data->memory, &data->vrm_v0_0);
 #endif
@@ -1730,11 +2298,9 @@ void cgltf_free(cgltf_data* data)
 
 	for (cgltf_size i = 0; i < data->buffers_count; ++i)
 	{
-		if (data->buffers[i].data != data->bin)
-		{
-			file_release(&data->memory, &data->file, data->buffers[i].data);
-		}
+		cgltf_free_buffer_data(data, &data->buffers[i]);
 		data->memory.free(data->memory.user_data, data->buffers[i].uri);
+		data->memory.free(data->memory.user_data, data->buffers[i].lazy_path);
 
 		cgltf_free_extensions(data, data->buffers[i].extensions, data->buffers[i].extensions_count);
 	}
@@ -2143,12 +2709,37 @@ static cgltf_bool cgltf_element_read_float(const uint8_t* element, cgltf_type ty
 	return 1;
 }
 
+void* cgltf_buffer_data(cgltf_buffer* buffer)
+{
+	if (buffer->data || !buffer->lazy_path)
+		return buffer->data;
+
+	cgltf_data* data = buffer->lazy_owner;
+	cgltf_result (*file_read)(const struct cgltf_memory_options*, const struct cgltf_file_options*, const char*, cgltf_size*, void**) = data->file.read ? data->file.read : &cgltf_default_file_read;
+
+	cgltf_size size = buffer->size;
+	void* file_data = NULL;
+	if (file_read(&data->memory, &data->file, buffer->lazy_path, &size, &file_data) != cgltf_result_success)
+		return NULL;
+
+	if (size < buffer->size)
+	{
+		void (*file_release)(const struct cgltf_memory_options*, const struct cgltf_file_options*, void* data) = data->file.release ? data->file.release : cgltf_default_file_release;
+		file_release(&data->memory, &data->file, file_data);
+		return NULL;
+	}
+
+	buffer->data = file_data;
+	buffer->data_free_method = cgltf_data_free_method_file_release;
+	return buffer->data;
+}
+
 const uint8_t* cgltf_buffer_view_data(const cgltf_buffer_view* view)
 {
 	if (view->data)
 		return (const uint8_t*)view->data;
 
-	if (!view->buffer->data)
+	if (!cgltf_buffer_data(view->buffer))
 		return NULL;
 
 	const uint8_t* result = (const uint8_t*)view->buffer->data;
@@ -2176,188 +2767,1001 @@ cgltf_bool cgltf_accessor_read_float(const cgltf_accessor* accessor, cgltf_size
 	return cgltf_element_read_float(element, accessor->type, accessor->component_type, accessor->normalized, out, element_size);
 }
 
-cgltf_size cgltf_accessor_unpack_floats(const cgltf_accessor* accessor, cgltf_float* out, cgltf_size float_count)
+cgltf_size cgltf_accessor_unpack_floats(const cgltf_accessor* accessor, cgltf_float* out, cgltf_size float_count)
+{
+	cgltf_size floats_per_element = cgltf_num_components(accessor->type);
+	cgltf_size available_floats = accessor->count * floats_per_element;
+	if (out == NULL)
+	{
+		return available_floats;
+	}
+
+	float_count = available_floats < float_count ? available_floats : float_count;
+	cgltf_size element_count = float_count / floats_per_element;
+
+	// First pass: convert each element in the base accessor.
+	cgltf_float* dest = out;
+	cgltf_accessor dense = *accessor;
+	dense.is_sparse = 0;
+	for (cgltf_size index = 0; index < element_count; index++, dest += floats_per_element)
+	{
+		if (!cgltf_accessor_read_float(&dense, index, dest, floats_per_element))
+		{
+			return 0;
+		}
+	}
+
+	// Second pass: write out each element in the sparse accessor.
+	if (accessor->is_sparse)
+	{
+		const cgltf_accessor_sparse* sparse = &dense.sparse;
+
+		const uint8_t* index_data = cgltf_buffer_view_data(sparse->indices_buffer_view);
+		const uint8_t* reader_head = cgltf_buffer_view_data(sparse->values_buffer_view);
+
+		if (index_data == NULL || reader_head == NULL)
+		{
+			return 0;
+		}
+
+		index_data += sparse->indices_byte_offset;
+		reader_head += sparse->values_byte_offset;
+
+		cgltf_size index_stride = cgltf_component_size(sparse->indices_component_type);
+		for (cgltf_size reader_index = 0; reader_index < sparse->count; reader_index++, index_data += index_stride)
+		{
+			size_t writer_index = cgltf_component_read_index(index_data, sparse->indices_component_type);
+			float* writer_head = out + writer_index * floats_per_element;
+
+			if (!cgltf_element_read_float(reader_head, dense.type, dense.component_type, dense.normalized, writer_head, floats_per_element))
+			{
+				return 0;
+			}
+
+			reader_head += dense.stride;
+		}
+	}
+
+	return element_count * floats_per_element;
+}
+
+static cgltf_uint cgltf_component_read_uint(const void* in, cgltf_component_type component_type)
+{
+	switch (component_type)
+	{
+		case cgltf_component_type_r_8:
+			return *((const int8_t*) in);
+
+		case cgltf_component_type_r_8u:
+			return *((const uint8_t*) in);
+
+		case cgltf_component_type_r_16:
+			return *((const int16_t*) in);
+
+		case cgltf_component_type_r_16u:
+			return *((const uint16_t*) in);
+
+		case cgltf_component_type_r_32u:
+			return *((const uint32_t*) in);
+
+		default:
+			return 0;
+	}
+}
+
+static cgltf_bool cgltf_element_read_uint(const uint8_t* element, cgltf_type type, cgltf_component_type component_type, cgltf_uint* out, cgltf_size element_size)
+{
+	cgltf_size num_components = cgltf_num_components(type);
+
+	if (element_size < num_components)
+	{
+		return 0;
+	}
+
+	// Reading integer matrices is not a valid use case
+	if (type == cgltf_type_mat2 || type == cgltf_type_mat3 || type == cgltf_type_mat4)
+	{
+		return 0;
+	}
+
+	cgltf_size component_size = cgltf_component_size(component_type);
+
+	for (cgltf_size i = 0; i < num_components; ++i)
+	{
+		out[i] = cgltf_component_read_uint(element + component_size * i, component_type);
+	}
+	return 1;
+}
+
+cgltf_bool cgltf_accessor_read_uint(const cgltf_accessor* accessor, cgltf_size index, cgltf_uint* out, cgltf_size element_size)
+{
+	if (accessor->is_sparse)
+	{
+		return 0;
+	}
+	if (accessor->buffer_view == NULL)
+	{
+		memset(out, 0, element_size * sizeof( cgltf_uint ));
+		return 1;
+	}
+	const uint8_t* element = cgltf_buffer_view_data(accessor->buffer_view);
+	if (element == NULL)
+	{
+		return 0;
+	}
+	element += accessor->offset + accessor->stride * index;
+	return cgltf_element_read_uint(element, accessor->type, accessor->component_type, out, element_size);
+}
+
+cgltf_size cgltf_accessor_read_index(const cgltf_accessor* accessor, cgltf_size index)
+{
+	if (accessor->is_sparse)
+	{
+		return 0; // This is an error case, but we can't communicate the error with existing interface.
+	}
+	if (accessor->buffer_view == NULL)
+	{
+		return 0;
+	}
+	const uint8_t* element = cgltf_buffer_view_data(accessor->buffer_view);
+	if (element == NULL)
+	{
+		return 0; // This is an error case, but we can't communicate the error with existing interface.
+	}
+	element += accessor->offset + accessor->stride * index;
+	return cgltf_component_read_index(element, accessor->component_type);
+}
+
+#define CGLTF_ERROR_JSON -1
+#define CGLTF_ERROR_NOMEM -2
+#define CGLTF_ERROR_LEGACY -3
+
+#define CGLTF_CHECK_TOKTYPE(tok_, type_) if ((tok_).type != (type_)) { return CGLTF_ERROR_JSON; }
+#define CGLTF_CHECK_KEY(tok_) if ((tok_).type != JSMN_STRING || (tok_).size == 0) { return CGLTF_ERROR_JSON; } /* checking size for 0 verifies that a value follows the key */
+
+#define CGLTF_PTRINDEX(type, idx) (type*)((cgltf_size)idx + 1)
+#define CGLTF_PTRFIXUP(var, data, size) if (var) { if ((cgltf_size)var > size) { return CGLTF_ERROR_JSON; } var = &data[(cgltf_size)var-1]; }
+#define CGLTF_PTRFIXUP_REQ(var, data, size) if (!var || (cgltf_size)var > size) { return CGLTF_ERROR_JSON; } var = &data[(cgltf_size)var-1];
+
+/* Ids of the object keys and enum values that the parsers dispatch on; generated together with cgltf_json_key_lookup */
+enum cgltf_json_key
+{
+	cgltf_json_key_unknown,
+	cgltf_json_key_ATTRIBUTES,
+	cgltf_json_key_BLEND,
+	cgltf_json_key_CUBICSPLINE,
+	cgltf_json_key_EXPONENTIAL,
+	cgltf_json_key_EXT_meshopt_compression,
+	cgltf_json_key_INDICES,
+	cgltf_json_key_KHR_draco_mesh_compression,
+	cgltf_json_key_KHR_lights_punctual,
+	cgltf_json_key_KHR_materials_clearcoat,
+	cgltf_json_key_KHR_materials_ior,
+	cgltf_json_key_KHR_materials_pbrSpecularGlossiness,
+	cgltf_json_key_KHR_materials_sheen,
+	cgltf_json_key_KHR_materials_specular,
+	cgltf_json_key_KHR_materials_transmission,
+	cgltf_json_key_KHR_materials_unlit,
+	cgltf_json_key_KHR_texture_transform,
+	cgltf_json_key_LINEAR,
+	cgltf_json_key_MASK,
+	cgltf_json_key_MAT2,
+	cgltf_json_key_MAT3,
+	cgltf_json_key_MAT4,
+	cgltf_json_key_NONE,
+	cgltf_json_key_OCTAHEDRAL,
+	cgltf_json_key_OPAQUE,
+	cgltf_json_key_QUATERNION,
+	cgltf_json_key_SCALAR,
+	cgltf_json_key_STEP,
+	cgltf_json_key_TRIANGLES,
+	cgltf_json_key_VEC2,
+	cgltf_json_key_VEC3,
+	cgltf_json_key_VEC4,
+	cgltf_json_key_VRM,
+	cgltf_json_key_VRMC_vrm,
+	cgltf_json_key_accessors,
+	cgltf_json_key_alphaCutoff,
+	cgltf_json_key_alphaMode,
+	cgltf_json_key_animations,
+	cgltf_json_key_aspectRatio,
+	cgltf_json_key_asset,
+	cgltf_json_key_attributes,
+	cgltf_json_key_baseColorFactor,
+	cgltf_json_key_baseColorTexture,
+	cgltf_json_key_buffer,
+	cgltf_json_key_bufferView,
+	cgltf_json_key_bufferViews,
+	cgltf_json_key_buffers,
+	cgltf_json_key_byteLength,
+	cgltf_json_key_byteOffset,
+	cgltf_json_key_byteStride,
+	cgltf_json_key_camera,
+	cgltf_json_key_cameras,
+	cgltf_json_key_channels,
+	cgltf_json_key_children,
+	cgltf_json_key_clearcoatFactor,
+	cgltf_json_key_clearcoatNormalTexture,
+	cgltf_json_key_clearcoatRoughnessFactor,
+	cgltf_json_key_clearcoatRoughnessTexture,
+	cgltf_json_key_clearcoatTexture,
+	cgltf_json_key_color,
+	cgltf_json_key_componentType,
+	cgltf_json_key_copyright,
+	cgltf_json_key_count,
+	cgltf_json_key_diffuseFactor,
+	cgltf_json_key_diffuseTexture,
+	cgltf_json_key_directional,
+	cgltf_json_key_doubleSided,
+	cgltf_json_key_emissiveFactor,
+	cgltf_json_key_emissiveTexture,
+	cgltf_json_key_extensions,
+	cgltf_json_key_extensionsRequired,
+	cgltf_json_key_extensionsUsed,
+	cgltf_json_key_extras,
+	cgltf_json_key_filter,
+	cgltf_json_key_generator,
+	cgltf_json_key_glossinessFactor,
+	cgltf_json_key_images,
+	cgltf_json_key_index,
+	cgltf_json_key_indices,
+	cgltf_json_key_innerConeAngle,
+	cgltf_json_key_input,
+	cgltf_json_key_intensity,
+	cgltf_json_key_interpolation,
+	cgltf_json_key_inverseBindMatrices,
+	cgltf_json_key_ior,
+	cgltf_json_key_joints,
+	cgltf_json_key_light,
+	cgltf_json_key_lights,
+	cgltf_json_key_magFilter,
+	cgltf_json_key_material,
+	cgltf_json_key_materials,
+	cgltf_json_key_matrix,
+	cgltf_json_key_max,
+	cgltf_json_key_mesh,
+	cgltf_json_key_meshes,
+	cgltf_json_key_metallicFactor,
+	cgltf_json_key_metallicRoughnessTexture,
+	cgltf_json_key_mimeType,
+	cgltf_json_key_min,
+	cgltf_json_key_minFilter,
+	cgltf_json_key_minVersion,
+	cgltf_json_key_mode,
+	cgltf_json_key_name,
+	cgltf_json_key_node,
+	cgltf_json_key_nodes,
+	cgltf_json_key_normalTexture,
+	cgltf_json_key_normalized,
+	cgltf_json_key_occlusionTexture,
+	cgltf_json_key_offset,
+	cgltf_json_key_orthographic,
+	cgltf_json_key_outerConeAngle,
+	cgltf_json_key_output,
+	cgltf_json_key_path,
+	cgltf_json_key_pbrMetallicRoughness,
+	cgltf_json_key_perspective,
+	cgltf_json_key_point,
+	cgltf_json_key_primitives,
+	cgltf_json_key_range,
+	cgltf_json_key_rotation,
+	cgltf_json_key_roughnessFactor,
+	cgltf_json_key_sampler,
+	cgltf_json_key_samplers,
+	cgltf_json_key_scale,
+	cgltf_json_key_scene,
+	cgltf_json_key_scenes,
+	cgltf_json_key_sheenColorFactor,
+	cgltf_json_key_sheenColorTexture,
+	cgltf_json_key_sheenRoughnessFactor,
+	cgltf_json_key_sheenRoughnessTexture,
+	cgltf_json_key_skeleton,
+	cgltf_json_key_skin,
+	cgltf_json_key_skins,
+	cgltf_json_key_source,
+	cgltf_json_key_sparse,
+	cgltf_json_key_specularColorFactor,
+	cgltf_json_key_specularFactor,
+	cgltf_json_key_specularGlossinessTexture,
+	cgltf_json_key_specularTexture,
+	cgltf_json_key_spot,
+	cgltf_json_key_strength,
+	cgltf_json_key_target,
+	cgltf_json_key_targetNames,
+	cgltf_json_key_targets,
+	cgltf_json_key_texCoord,
+	cgltf_json_key_textures,
+	cgltf_json_key_translation,
+	cgltf_json_key_transmissionFactor,
+	cgltf_json_key_transmissionTexture,
+	cgltf_json_key_type,
+	cgltf_json_key_uri,
+	cgltf_json_key_values,
+	cgltf_json_key_version,
+	cgltf_json_key_weights,
+	cgltf_json_key_wrapS,
+	cgltf_json_key_wrapT,
+	cgltf_json_key_x,
+	cgltf_json_key_xmag,
+	cgltf_json_key_y,
+	cgltf_json_key_yfov,
+	cgltf_json_key_ymag,
+	cgltf_json_key_z,
+	cgltf_json_key_zfar,
+	cgltf_json_key_znear,
+	cgltf_json_key_max_enum
+};
+
+/* Maps a string token to its key id with a switch on length and first character, so every string is compared at most against the few keys that share both */
+static int cgltf_json_key_lookup(const char* str, int length)
+{
+	switch (length)
+	{
+	case 1:
+		switch (str[0])
+		{
+		case 'x':
+			if (memcmp(str, "x", 1) == 0) return cgltf_json_key_x;
+			break;
+		case 'y':
+			if (memcmp(str, "y", 1) == 0) return cgltf_json_key_y;
+			break;
+		case 'z':
+			if (memcmp(str, "z", 1) == 0) return cgltf_json_key_z;
+			break;
+		}
+		break;
+	case 3:
+		switch (str[0])
+		{
+		case 'V':
+			if (memcmp(str, "VRM", 3) == 0) return cgltf_json_key_VRM;
+			break;
+		case 'i':
+			if (memcmp(str, "ior", 3) == 0) return cgltf_json_key_ior;
+			break;
+		case 'm':
+			if (memcmp(str, "max", 3) == 0) return cgltf_json_key_max;
+			if (memcmp(str, "min", 3) == 0) return cgltf_json_key_min;
+			break;
+		case 'u':
+			if (memcmp(str, "uri", 3) == 0) return cgltf_json_key_uri;
+			break;
+		}
+		break;
+	case 4:
+		switch (str[0])
+		{
+		case 'M':
+			if (memcmp(str, "MASK", 4) == 0) return cgltf_json_key_MASK;
+			if (memcmp(str, "MAT2", 4) == 0) return cgltf_json_key_MAT2;
+			if (memcmp(str, "MAT3", 4) == 0) return cgltf_json_key_MAT3;
+			if (memcmp(str, "MAT4", 4) == 0) return cgltf_json_key_MAT4;
+			break;
+		case 'N':
+			if (memcmp(str, "NONE", 4) == 0) return cgltf_json_key_NONE;
+			break;
+		case 'S':
+			if (memcmp(str, "STEP", 4) == 0) return cgltf_json_key_STEP;
+			break;
+		case 'V':
+			if (memcmp(str, "VEC2", 4) == 0) return cgltf_json_key_VEC2;
+			if (memcmp(str, "VEC3", 4) == 0) return cgltf_json_key_VEC3;
+			if (memcmp(str, "VEC4", 4) == 0) return cgltf_json_key_VEC4;
+			break;
+		case 'm':
+			if (memcmp(str, "mesh", 4) == 0) return cgltf_json_key_mesh;
+			if (memcmp(str, "mode", 4) == 0) return cgltf_json_key_mode;
+			break;
+		case 'n':
+			if (memcmp(str, "name", 4) == 0) return cgltf_json_key_name;
+			if (memcmp(str, "node", 4) == 0) return cgltf_json_key_node;
+			break;
+		case 'p':
+			if (memcmp(str, "path", 4) == 0) return cgltf_json_key_path;
+			break;
+		case 's':
+			if (memcmp(str, "skin", 4) == 0) return cgltf_json_key_skin;
+			if (memcmp(str, "spot", 4) == 0) return cgltf_json_key_spot;
+			break;
+		case 't':
+			if (memcmp(str, "type", 4) == 0) return cgltf_json_key_type;
+			break;
+		case 'x':
+			if (memcmp(str, "xmag", 4) == 0) return cgltf_json_key_xmag;
+			break;
+		case 'y':
+			if (memcmp(str, "yfov", 4) == 0) return cgltf_json_key_yfov;
+			if (memcmp(str, "ymag", 4) == 0) return cgltf_json_key_ymag;
+			break;
+		case 'z':
+			if (memcmp(str, "zfar", 4) == 0) return cgltf_json_key_zfar;
+			break;
+		}
+		break;
+	case 5:
+		switch (str[0])
+		{
+		case 'B':
+			if (memcmp(str, "BLEND", 5) == 0) return cgltf_json_key_BLEND;
+			break;
+		case 'a':
+			if (memcmp(str, "asset", 5) == 0) return cgltf_json_key_asset;
+			break;
+		case 'c':
+			if (memcmp(str, "color", 5) == 0) return cgltf_json_key_color;
+			if (memcmp(str, "count", 5) == 0) return cgltf_json_key_count;
+			break;
+		case 'i':
+			if (memcmp(str, "index", 5) == 0) return cgltf_json_key_index;
+			if (memcmp(str, "input", 5) == 0) return cgltf_json_key_input;
+			break;
+		case 'l':
+			if (memcmp(str, "light", 5) == 0) return cgltf_json_key_light;
+			break;
+		case 'n':
+			if (memcmp(str, "nodes", 5) == 0) return cgltf_json_key_nodes;
+			break;
+		case 'p':
+			if (memcmp(str, "point", 5) == 0) return cgltf_json_key_point;
+			break;
+		case 'r':
+			if (memcmp(str, "range", 5) == 0) return cgltf_json_key_range;
+			break;
+		case 's':
+			if (memcmp(str, "scale", 5) == 0) return cgltf_json_key_scale;
+			if (memcmp(str, "scene", 5) == 0) return cgltf_json_key_scene;
+			if (memcmp(str, "skins", 5) == 0) return cgltf_json_key_skins;
+			break;
+		case 'w':
+			if (memcmp(str, "wrapS", 5) == 0) return cgltf_json_key_wrapS;
+			if (memcmp(str, "wrapT", 5) == 0) return cgltf_json_key_wrapT;
+			break;
+		case 'z':
+			if (memcmp(str, "znear", 5) == 0) return cgltf_json_key_znear;
+			break;
+		}
+		break;
+	case 6:
+		switch (str[0])
+		{
+		case 'L':
+			if (memcmp(str, "LINEAR", 6) == 0) return cgltf_json_key_LINEAR;
+			break;
+		case 'O':
+			if (memcmp(str, "OPAQUE", 6) == 0) return cgltf_json_key_OPAQUE;
+			break;
+		case 'S':
+			if (memcmp(str, "SCALAR", 6) == 0) return cgltf_json_key_SCALAR;
+			break;
+		case 'b':
+			if (memcmp(str, "buffer", 6) == 0) return cgltf_json_key_buffer;
+			break;
+		case 'c':
+			if (memcmp(str, "camera", 6) == 0) return cgltf_json_key_camera;
+			break;
+		case 'e':
+			if (memcmp(str, "extras", 6) == 0) return cgltf_json_key_extras;
+			break;
+		case 'f':
+			if (memcmp(str, "filter", 6) == 0) return cgltf_json_key_filter;
+			break;
+		case 'i':
+			if (memcmp(str, "images", 6) == 0) return cgltf_json_key_images;
+			break;
+		case 'j':
+			if (memcmp(str, "joints", 6) == 0) return cgltf_json_key_joints;
+			break;
+		case 'l':
+			if (memcmp(str, "lights", 6) == 0) return cgltf_json_key_lights;
+			break;
+		case 'm':
+			if (memcmp(str, "matrix", 6) == 0) return cgltf_json_key_matrix;
+			if (memcmp(str, "meshes", 6) == 0) return cgltf_json_key_meshes;
+			break;
+		case 'o':
+			if (memcmp(str, "offset", 6) == 0) return cgltf_json_key_offset;
+			if (memcmp(str, "output", 6) == 0) return cgltf_json_key_output;
+			break;
+		case 's':
+			if (memcmp(str, "scenes", 6) == 0) return cgltf_json_key_scenes;
+			if (memcmp(str, "source", 6) == 0) return cgltf_json_key_source;
+			if (memcmp(str, "sparse", 6) == 0) return cgltf_json_key_sparse;
+			break;
+		case 't':
+			if (memcmp(str, "target", 6) == 0) return cgltf_json_key_target;
+			break;
+		case 'v':
+			if (memcmp(str, "values", 6) == 0) return cgltf_json_key_values;
+			break;
+		}
+		break;
+	case 7:
+		switch (str[0])
+		{
+		case 'I':
+			if (memcmp(str, "INDICES", 7) == 0) return cgltf_json_key_INDICES;
+			break;
+		case 'b':
+			if (memcmp(str, "buffers", 7) == 0) return cgltf_json_key_buffers;
+			break;
+		case 'c':
+			if (memcmp(str, "cameras", 7) == 0) return cgltf_json_key_cameras;
+			break;
+		case 'i':
+			if (memcmp(str, "indices", 7) == 0) return cgltf_json_key_indices;
+			break;
+		case 's':
+			if (memcmp(str, "sampler", 7) == 0) return cgltf_json_key_sampler;
+			break;
+		case 't':
+			if (memcmp(str, "targets", 7) == 0) return cgltf_json_key_targets;
+			break;
+		case 'v':
+			if (memcmp(str, "version", 7) == 0) return cgltf_json_key_version;
+			break;
+		case 'w':
+			if (memcmp(str, "weights", 7) == 0) return cgltf_json_key_weights;
+			break;
+		}
+		break;
+	case 8:
+		switch (str[0])
+		{
+		case 'V':
+			if (memcmp(str, "VRMC_vrm", 8) == 0) return cgltf_json_key_VRMC_vrm;
+			break;
+		case 'c':
+			if (memcmp(str, "channels", 8) == 0) return cgltf_json_key_channels;
+			if (memcmp(str, "children", 8) == 0) return cgltf_json_key_children;
+			break;
+		case 'm':
+			if (memcmp(str, "material", 8) == 0) return cgltf_json_key_material;
+			if (memcmp(str, "mimeType", 8) == 0) return cgltf_json_key_mimeType;
+			break;
+		case 'r':
+			if (memcmp(str, "rotation", 8) == 0) return cgltf_json_key_rotation;
+			break;
+		case 's':
+			if (memcmp(str, "samplers", 8) == 0) return cgltf_json_key_samplers;
+			if (memcmp(str, "skeleton", 8) == 0) return cgltf_json_key_skeleton;
+			if (memcmp(str, "strength", 8) == 0) return cgltf_json_key_strength;
+			break;
+		case 't':
+			if (memcmp(str, "texCoord", 8) == 0) return cgltf_json_key_texCoord;
+			if (memcmp(str, "textures", 8) == 0) return cgltf_json_key_textures;
+			break;
+		}
+		break;
+	case 9:
+		switch (str[0])
+		{
+		case 'T':
+			if (memcmp(str, "TRIANGLES", 9) == 0) return cgltf_json_key_TRIANGLES;
+			break;
+		case 'a':
+			if (memcmp(str, "accessors", 9) == 0) return cgltf_json_key_accessors;
+			if (memcmp(str, "alphaMode", 9) == 0) return cgltf_json_key_alphaMode;
+			break;
+		case 'c':
+			if (memcmp(str, "copyright", 9) == 0) return cgltf_json_key_copyright;
+			break;
+		case 'g':
+			if (memcmp(str, "generator", 9) == 0) return cgltf_json_key_generator;
+			break;
+		case 'i':
+			if (memcmp(str, "intensity", 9) == 0) return cgltf_json_key_intensity;
+			break;
+		case 'm':
+			if (memcmp(str, "magFilter", 9) == 0) return cgltf_json_key_magFilter;
+			if (memcmp(str, "materials", 9) == 0) return cgltf_json_key_materials;
+			if (memcmp(str, "minFilter", 9) == 0) return cgltf_json_key_minFilter;
+			break;
+		}
+		break;
+	case 10:
+		switch (str[0])
+		{
+		case 'A':
+			if (memcmp(str, "ATTRIBUTES", 10) == 0) return cgltf_json_key_ATTRIBUTES;
+			break;
+		case 'O':
+			if (memcmp(str, "OCTAHEDRAL", 10) == 0) return cgltf_json_key_OCTAHEDRAL;
+			break;
+		case 'Q':
+			if (memcmp(str, "QUATERNION", 10) == 0) return cgltf_json_key_QUATERNION;
+			break;
+		case 'a':
+			if (memcmp(str, "animations", 10) == 0) return cgltf_json_key_animations;
+			if (memcmp(str, "attributes", 10) == 0) return cgltf_json_key_attributes;
+			break;
+		case 'b':
+			if (memcmp(str, "bufferView", 10) == 0) return cgltf_json_key_bufferView;
+			if (memcmp(str, "byteLength", 10) == 0) return cgltf_json_key_byteLength;
+			if (memcmp(str, "byteOffset", 10) == 0) return cgltf_json_key_byteOffset;
+			if (memcmp(str, "byteStride", 10) == 0) return cgltf_json_key_byteStride;
+			break;
+		case 'e':
+			if (memcmp(str, "extensions", 10) == 0) return cgltf_json_key_extensions;
+			break;
+		case 'm':
+			if (memcmp(str, "minVersion", 10) == 0) return cgltf_json_key_minVersion;
+			break;
+		case 'n':
+			if (memcmp(str, "normalized", 10) == 0) return cgltf_json_key_normalized;
+			break;
+		case 'p':
+			if (memcmp(str, "primitives", 10) == 0) return cgltf_json_key_primitives;
+			break;
+		}
+		break;
+	case 11:
+		switch (str[0])
+		{
+		case 'C':
+			if (memcmp(str, "CUBICSPLINE", 11) == 0) return cgltf_json_key_CUBICSPLINE;
+			break;
+		case 'E':
+			if (memcmp(str, "EXPONENTIAL", 11) == 0) return cgltf_json_key_EXPONENTIAL;
+			break;
+		case 'a':
+			if (memcmp(str, "alphaCutoff", 11) == 0) return cgltf_json_key_alphaCutoff;
+			if (memcmp(str, "aspectRatio", 11) == 0) return cgltf_json_key_aspectRatio;
+			break;
+		case 'b':
+			if (memcmp(str, "bufferViews", 11) == 0) return cgltf_json_key_bufferViews;
+			break;
+		case 'd':
+			if (memcmp(str, "directional", 11) == 0) return cgltf_json_key_directional;
+			if (memcmp(str, "doubleSided", 11) == 0) return cgltf_json_key_doubleSided;
+			break;
+		case 'p':
+			if (memcmp(str, "perspective", 11) == 0) return cgltf_json_key_perspective;
+			break;
+		case 't':
+			if (memcmp(str, "targetNames", 11) == 0) return cgltf_json_key_targetNames;
+			if (memcmp(str, "translation", 11) == 0) return cgltf_json_key_translation;
+			break;
+		}
+		break;
+	case 12:
+		switch (str[0])
+		{
+		case 'o':
+			if (memcmp(str, "orthographic", 12) == 0) return cgltf_json_key_orthographic;
+			break;
+		}
+		break;
+	case 13:
+		switch (str[0])
+		{
+		case 'c':
+			if (memcmp(str, "componentType", 13) == 0) return cgltf_json_key_componentType;
+			break;
+		case 'd':
+			if (memcmp(str, "diffuseFactor", 13) == 0) return cgltf_json_key_diffuseFactor;
+			break;
+		case 'i':
+			if (memcmp(str, "interpolation", 13) == 0) return cgltf_json_key_interpolation;
+			break;
+		case 'n':
+			if (memcmp(str, "normalTexture", 13) == 0) return cgltf_json_key_normalTexture;
+			break;
+		}
+		break;
+	case 14:
+		switch (str[0])
+		{
+		case 'd':
+			if (memcmp(str, "diffuseTexture", 14) == 0) return cgltf_json_key_diffuseTexture;
+			break;
+		case 'e':
+			if (memcmp(str, "emissiveFactor", 14) == 0) return cgltf_json_key_emissiveFactor;
+			if (memcmp(str, "extensionsUsed", 14) == 0) return cgltf_json_key_extensionsUsed;
+			break;
+		case 'i':
+			if (memcmp(str, "innerConeAngle", 14) == 0) return cgltf_json_key_innerConeAngle;
+			break;
+		case 'm':
+			if (memcmp(str, "metallicFactor", 14) == 0) return cgltf_json_key_metallicFactor;
+			break;
+		case 'o':
+			if (memcmp(str, "outerConeAngle", 14) == 0) return cgltf_json_key_outerConeAngle;
+			break;
+		case 's':
+			if (memcmp(str, "specularFactor", 14) == 0) return cgltf_json_key_specularFactor;
+			break;
+		}
+		break;
+	case 15:
+		switch (str[0])
+		{
+		case 'b':
+			if (memcmp(str, "baseColorFactor", 15) == 0) return cgltf_json_key_baseColorFactor;
+			break;
+		case 'c':
+			if (memcmp(str, "clearcoatFactor", 15) == 0) return cgltf_json_key_clearcoatFactor;
+			break;
+		case 'e':
+			if (memcmp(str, "emissiveTexture", 15) == 0) return cgltf_json_key_emissiveTexture;
+			break;
+		case 'r':
+			if (memcmp(str, "roughnessFactor", 15) == 0) return cgltf_json_key_roughnessFactor;
+			break;
+		case 's':
+			if (memcmp(str, "specularTexture", 15) == 0) return cgltf_json_key_specularTexture;
+			break;
+		}
+		break;
+	case 16:
+		switch (str[0])
+		{
+		case 'b':
+			if (memcmp(str, "baseColorTexture", 16) == 0) return cgltf_json_key_baseColorTexture;
+			break;
+		case 'c':
+			if (memcmp(str, "clearcoatTexture", 16) == 0) return cgltf_json_key_clearcoatTexture;
+			break;
+		case 'g':
+			if (memcmp(str, "glossinessFactor", 16) == 0) return cgltf_json_key_glossinessFactor;
+			break;
+		case 'o':
+			if (memcmp(str, "occlusionTexture", 16) == 0) return cgltf_json_key_occlusionTexture;
+			break;
+		case 's':
+			if (memcmp(str, "sheenColorFactor", 16) == 0) return cgltf_json_key_sheenColorFactor;
+			break;
+		}
+		break;
+	case 17:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_materials_ior", 17) == 0) return cgltf_json_key_KHR_materials_ior;
+			break;
+		case 's':
+			if (memcmp(str, "sheenColorTexture", 17) == 0) return cgltf_json_key_sheenColorTexture;
+			break;
+		}
+		break;
+	case 18:
+		switch (str[0])
+		{
+		case 'e':
+			if (memcmp(str, "extensionsRequired", 18) == 0) return cgltf_json_key_extensionsRequired;
+			break;
+		case 't':
+			if (memcmp(str, "transmissionFactor", 18) == 0) return cgltf_json_key_transmissionFactor;
+			break;
+		}
+		break;
+	case 19:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_lights_punctual", 19) == 0) return cgltf_json_key_KHR_lights_punctual;
+			if (memcmp(str, "KHR_materials_sheen", 19) == 0) return cgltf_json_key_KHR_materials_sheen;
+			if (memcmp(str, "KHR_materials_unlit", 19) == 0) return cgltf_json_key_KHR_materials_unlit;
+			break;
+		case 'i':
+			if (memcmp(str, "inverseBindMatrices", 19) == 0) return cgltf_json_key_inverseBindMatrices;
+			break;
+		case 's':
+			if (memcmp(str, "specularColorFactor", 19) == 0) return cgltf_json_key_specularColorFactor;
+			break;
+		case 't':
+			if (memcmp(str, "transmissionTexture", 19) == 0) return cgltf_json_key_transmissionTexture;
+			break;
+		}
+		break;
+	case 20:
+		switch (str[0])
+		{
+		case 'p':
+			if (memcmp(str, "pbrMetallicRoughness", 20) == 0) return cgltf_json_key_pbrMetallicRoughness;
+			break;
+		case 's':
+			if (memcmp(str, "sheenRoughnessFactor", 20) == 0) return cgltf_json_key_sheenRoughnessFactor;
+			break;
+		}
+		break;
+	case 21:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_texture_transform", 21) == 0) return cgltf_json_key_KHR_texture_transform;
+			break;
+		case 's':
+			if (memcmp(str, "sheenRoughnessTexture", 21) == 0) return cgltf_json_key_sheenRoughnessTexture;
+			break;
+		}
+		break;
+	case 22:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_materials_specular", 22) == 0) return cgltf_json_key_KHR_materials_specular;
+			break;
+		case 'c':
+			if (memcmp(str, "clearcoatNormalTexture", 22) == 0) return cgltf_json_key_clearcoatNormalTexture;
+			break;
+		}
+		break;
+	case 23:
+		switch (str[0])
+		{
+		case 'E':
+			if (memcmp(str, "EXT_meshopt_compression", 23) == 0) return cgltf_json_key_EXT_meshopt_compression;
+			break;
+		case 'K':
+			if (memcmp(str, "KHR_materials_clearcoat", 23) == 0) return cgltf_json_key_KHR_materials_clearcoat;
+			break;
+		}
+		break;
+	case 24:
+		switch (str[0])
+		{
+		case 'c':
+			if (memcmp(str, "clearcoatRoughnessFactor", 24) == 0) return cgltf_json_key_clearcoatRoughnessFactor;
+			break;
+		case 'm':
+			if (memcmp(str, "metallicRoughnessTexture", 24) == 0) return cgltf_json_key_metallicRoughnessTexture;
+			break;
+		}
+		break;
+	case 25:
+		switch (str[0])
+		{
+		case 'c':
+			if (memcmp(str, "clearcoatRoughnessTexture", 25) == 0) return cgltf_json_key_clearcoatRoughnessTexture;
+			break;
+		case 's':
+			if (memcmp(str, "specularGlossinessTexture", 25) == 0) return cgltf_json_key_specularGlossinessTexture;
+			break;
+		}
+		break;
+	case 26:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_draco_mesh_compression", 26) == 0) return cgltf_json_key_KHR_draco_mesh_compression;
+			if (memcmp(str, "KHR_materials_transmission", 26) == 0) return cgltf_json_key_KHR_materials_transmission;
+			break;
+		}
+		break;
+	case 35:
+		switch (str[0])
+		{
+		case 'K':
+			if (memcmp(str, "KHR_materials_pbrSpecularGlossiness", 35) == 0) return cgltf_json_key_KHR_materials_pbrSpecularGlossiness;
+			break;
+		}
+		break;
+	}
+	return cgltf_json_key_unknown;
+}
+
+static int cgltf_json_to_int(jsmntok_t const* tok, const uint8_t* json_chunk)
+{
+	CGLTF_CHECK_TOKTYPE(*tok, JSMN_PRIMITIVE);
+	char tmp[128];
+	int size = (cgltf_size)(tok->end - tok->start) < sizeof(tmp) ? tok->end - tok->start : (int)(sizeof(tmp) - 1);
+	strncpy(tmp, (const char*)json_chunk + tok->start, size);
+	tmp[size] = 0;
+	return CGLTF_ATOI(tmp);
+}
+
+static const double cgltf_powers_of_10[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/* Parses a JSON number in place into up to 19 significant digits and a decimal exponent, the same way fast_float does.
+ * Returns 0 for tokens that are not plain numbers or have more significant digits. */
+static int cgltf_parse_decimal(const char* str, const char* end, int* out_negative, uint64_t* out_mantissa, int* out_exponent)
 {
-	cgltf_size floats_per_element = cgltf_num_components(accessor->type);
-	cgltf_size available_floats = accessor->count * floats_per_element;
-	if (out == NULL)
-	{
-		return available_floats;
-	}
+	const char* ptr = str;
+	uint64_t mantissa = 0;
+	int digits = 0, exponent = 0, any = 0;
 
-	float_count = available_floats < float_count ? available_floats : float_count;
-	cgltf_size element_count = float_count / floats_per_element;
+	int negative = ptr < end && *ptr == '-';
+	ptr += ptr < end && (*ptr == '-' || *ptr == '+');
 
-	// First pass: convert each element in the base accessor.
-	cgltf_float* dest = out;
-	cgltf_accessor dense = *accessor;
-	dense.is_sparse = 0;
-	for (cgltf_size index = 0; index < element_count; index++, dest += floats_per_element)
+	for (; ptr < end && (unsigned)(*ptr - '0') < 10; ++ptr, any = 1)
 	{
-		if (!cgltf_accessor_read_float(&dense, index, dest, floats_per_element))
-		{
+		if (digits == 19)
 			return 0;
-		}
+
+		mantissa = mantissa * 10 + (unsigned)(*ptr - '0');
+		digits += mantissa != 0;
 	}
 
-	// Second pass: write out each element in the sparse accessor.
-	if (accessor->is_sparse)
+	if (ptr < end && *ptr == '.')
 	{
-		const cgltf_accessor_sparse* sparse = &dense.sparse;
-
-		const uint8_t* index_data = cgltf_buffer_view_data(sparse->indices_buffer_view);
-		const uint8_t* reader_head = cgltf_buffer_view_data(sparse->values_buffer_view);
-
-		if (index_data == NULL || reader_head == NULL)
-		{
-			return 0;
-		}
-
-		index_data += sparse->indices_byte_offset;
-		reader_head += sparse->values_byte_offset;
-
-		cgltf_size index_stride = cgltf_component_size(sparse->indices_component_type);
-		for (cgltf_size reader_index = 0; reader_index < sparse->count; reader_index++, index_data += index_stride)
+		for (++ptr; ptr < end && (unsigned)(*ptr - '0') < 10; ++ptr, any = 1)
 		{
-			size_t writer_index = cgltf_component_read_index(index_data, sparse->indices_component_type);
-			float* writer_head = out + writer_index * floats_per_element;
-
-			if (!cgltf_element_read_float(reader_head, dense.type, dense.component_type, dense.normalized, writer_head, floats_per_element))
-			{
+			if (digits == 19)
 				return 0;
-			}
 
-			reader_head += dense.stride;
+			mantissa = mantissa * 10 + (unsigned)(*ptr - '0');
+			digits += mantissa != 0;
+			exponent--;
 		}
 	}
 
-	return element_count * floats_per_element;
-}
+	if (!any)
+		return 0;
 
-static cgltf_uint cgltf_component_read_uint(const void* in, cgltf_component_type component_type)
-{
-	switch (component_type)
+	if (ptr < end && (*ptr == 'e' || *ptr == 'E'))
 	{
-		case cgltf_component_type_r_8:
-			return *((const int8_t*) in);
+		++ptr;
 
-		case cgltf_component_type_r_8u:
-			return *((const uint8_t*) in);
-
-		case cgltf_component_type_r_16:
-			return *((const int16_t*) in);
+		int exponent_negative = ptr < end && *ptr == '-';
+		ptr += ptr < end && (*ptr == '-' || *ptr == '+');
 
-		case cgltf_component_type_r_16u:
-			return *((const uint16_t*) in);
+		int value = 0;
+		const char* exponent_start = ptr;
 
-		case cgltf_component_type_r_32u:
-			return *((const uint32_t*) in);
+		for (; ptr < end && (unsigned)(*ptr - '0') < 10; ++ptr)
+			value = value < 10000 ? value * 10 + (*ptr - '0') : value;
 
-		default:
+		if (ptr == exponent_start)
 			return 0;
-	}
-}
 
-static cgltf_bool cgltf_element_read_uint(const uint8_t* element, cgltf_type type, cgltf_component_type component_type, cgltf_uint* out, cgltf_size element_size)
-{
-	cgltf_size num_components = cgltf_num_components(type);
-
-	if (element_size < num_components)
-	{
-		return 0;
+		exponent += exponent_negative ? -value : value;
 	}
 
-	// Reading integer matrices is not a valid use case
-	if (type == cgltf_type_mat2 || type == cgltf_type_mat3 || type == cgltf_type_mat4)
-	{
+	if (ptr != end)
 		return 0;
-	}
-
-	cgltf_size component_size = cgltf_component_size(component_type);
 
-	for (cgltf_size i = 0; i < num_components; ++i)
-	{
-		out[i] = cgltf_component_read_uint(element + component_size * i, component_type);
-	}
+	*out_negative = negative;
+	*out_mantissa = mantissa;
+	*out_exponent = exponent;
 	return 1;
 }
 
-cgltf_bool cgltf_accessor_read_uint(const cgltf_accessor* accessor, cgltf_size index, cgltf_uint* out, cgltf_size element_size)
+static cgltf_float cgltf_json_to_float(jsmntok_t const* tok, const uint8_t* json_chunk)
 {
-	if (accessor->is_sparse)
-	{
-		return 0;
-	}
-	if (accessor->buffer_view == NULL)
-	{
-		memset(out, 0, element_size * sizeof( cgltf_uint ));
-		return 1;
-	}
-	const uint8_t* element = cgltf_buffer_view_data(accessor->buffer_view);
-	if (element == NULL)
-	{
-		return 0;
-	}
-	element += accessor->offset + accessor->stride * index;
-	return cgltf_element_read_uint(element, accessor->type, accessor->component_type, out, element_size);
-}
+	CGLTF_CHECK_TOKTYPE(*tok, JSMN_PRIMITIVE);
 
-cgltf_size cgltf_accessor_read_index(const cgltf_accessor* accessor, cgltf_size index)
-{
-	if (accessor->is_sparse)
-	{
-		return 0; // This is an error case, but we can't communicate the error with existing interface.
-	}
-	if (accessor->buffer_view == NULL)
-	{
-		return 0;
-	}
-	const uint8_t* element = cgltf_buffer_view_data(accessor->buffer_view);
-	if (element == NULL)
-	{
-		return 0; // This is an error case, but we can't communicate the error with existing interface.
-	}
-	element += accessor->offset + accessor->stride * index;
-	return cgltf_component_read_index(element, accessor->component_type);
-}
+	int negative = 0, exponent = 0;
+	uint64_t mantissa = 0;
+	char tmp[128];
 
-#define CGLTF_ERROR_JSON -1
-#define CGLTF_ERROR_NOMEM -2
-#define CGLTF_ERROR_LEGACY -3
+	if (cgltf_parse_decimal((const char*)json_chunk + tok->start, (const char*)json_chunk + tok->end, &negative, &mantissa, &exponent))
+	{
+		if (mantissa == 0)
+		{
+			return negative ? -0.f : 0.f;
+		}
 
-#define CGLTF_CHECK_TOKTYPE(tok_, type_) if ((tok_).type != (type_)) { return CGLTF_ERROR_JSON; }
-#define CGLTF_CHECK_KEY(tok_) if ((tok_).type != JSMN_STRING || (tok_).size == 0) { return CGLTF_ERROR_JSON; } /* checking size for 0 verifies that a value follows the key */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+		/* Clinger's fast path: both operands are exact doubles, so the single rounding of the product or quotient is exact */
+		if (mantissa <= ((uint64_t)1 << 53) && exponent >= -22 && exponent <= 22)
+		{
+			double value = (double)mantissa;
+			value = exponent < 0 ? value / cgltf_powers_of_10[-exponent] : value * cgltf_powers_of_10[exponent];
 
-#define CGLTF_PTRINDEX(type, idx) (type*)((cgltf_size)idx + 1)
-#define CGLTF_PTRFIXUP(var, data, size) if (var) { if ((cgltf_size)var > size) { return CGLTF_ERROR_JSON; } var = &data[(cgltf_size)var-1]; }
-#define CGLTF_PTRFIXUP_REQ(var, data, size) if (!var || (cgltf_size)var > size) { return CGLTF_ERROR_JSON; } var = &data[(cgltf_size)var-1];
+			/* rounding to float again is only wrong when the double lies halfway between two floats, or in the subnormal range */
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
 
-static int cgltf_json_strcmp(jsmntok_t const* tok, const uint8_t* json_chunk, const char* str)
-{
-	CGLTF_CHECK_TOKTYPE(*tok, JSMN_STRING);
-	size_t const str_len = strlen(str);
-	size_t const name_length = tok->end - tok->start;
-	return (str_len == name_length) ? strncmp((const char*)json_chunk + tok->start, str, str_len) : 128;
-}
+			if ((bits & 0x1fffffff) != 0x10000000 && value >= FLT_MIN)
+			{
+				return negative ? -(cgltf_float)value : (cgltf_float)value;
+			}
+		}
+#endif
 
-static int cgltf_json_to_int(jsmntok_t const* tok, const uint8_t* json_chunk)
-{
-	CGLTF_CHECK_TOKTYPE(*tok, JSMN_PRIMITIVE);
-	char tmp[128];
-	int size = (cgltf_size)(tok->end - tok->start) < sizeof(tmp) ? tok->end - tok->start : (int)(sizeof(tmp) - 1);
-	strncpy(tmp, (const char*)json_chunk + tok->start, size);
-	tmp[size] = 0;
-	return CGLTF_ATOI(tmp);
-}
+		/* integer mantissa and exponent without a decimal point parse the same way in every locale */
+		snprintf(tmp, sizeof(tmp), "%s%llue%d", negative ? "-" : "", (unsigned long long)mantissa, exponent);
+		return (cgltf_float)CGLTF_STRTOF(tmp);
+	}
 
-static cgltf_float cgltf_json_to_float(jsmntok_t const* tok, const uint8_t* json_chunk)
-{
-	CGLTF_CHECK_TOKTYPE(*tok, JSMN_PRIMITIVE);
-	char tmp[128];
 	int size = (cgltf_size)(tok->end - tok->start) < sizeof(tmp) ? tok->end - tok->start : (int)(sizeof(tmp) - 1);
 	strncpy(tmp, (const char*)json_chunk + tok->start, size);
 	tmp[size] = 0;
-	return (cgltf_float)CGLTF_ATOF(tmp);
+	return (cgltf_float)CGLTF_STRTOF(tmp);
 }
 
 static cgltf_bool cgltf_json_to_bool(jsmntok_t const* tok, const uint8_t* json_chunk)
@@ -2461,15 +3865,15 @@ static int cgltf_parse_json_vec3(cgltf_options* options, jsmntok_t const* tokens
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "x") == 0) {
+			else if (tokens[i].key == cgltf_json_key_x) {
 				++i; (*out_array)[0] = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 				++count;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "y") == 0) {
+			else if (tokens[i].key == cgltf_json_key_y) {
 				++i; (*out_array)[1] = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 				++count;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "z") == 0) {
+			else if (tokens[i].key == cgltf_json_key_z) {
 				++i; (*out_array)[2] = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 				++count;
 			}
@@ -2497,6 +3901,12 @@ static int cgltf_parse_json_string(cgltf_options* options, jsmntok_t const* toke
 		return CGLTF_ERROR_JSON;
 	}
 	int size = tokens[i].end - tokens[i].start;
+	cgltf_arena* arena = cgltf_arena_of(&options->memory);
+	if (arena)
+	{
+		*out_string = cgltf_arena_intern(arena, (const char*)json_chunk + tokens[i].start, size);
+		return *out_string ? i + 1 : CGLTF_ERROR_NOMEM;
+	}
 	char* result = (char*)options->memory.alloc(options->memory.user_data, size + 1);
 	if (!result)
 	{
@@ -2860,7 +4270,7 @@ static int cgltf_parse_json_attribute_list(cgltf_options* options, jsmntok_t con
 			++i;
 			if (tokens[i].type == JSMN_STRING) 
 			{
-				if (cgltf_json_strcmp(tokens + i, json_chunk, "name") == 0)
+				if (tokens[i].key == cgltf_json_key_name)
 				{
 					i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &(*out_attributes)[j].value);
 				}
@@ -2970,11 +4380,11 @@ static int cgltf_parse_json_draco_mesh_compression(cgltf_options* options, jsmnt
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "attributes") == 0)
+		if (tokens[i].key == cgltf_json_key_attributes)
 		{
 			i = cgltf_parse_json_attribute_list(options, tokens, i + 1, json_chunk, &out_draco_mesh_compression->attributes, &out_draco_mesh_compression->attributes_count);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "bufferView") == 0)
+		else if (tokens[i].key == cgltf_json_key_bufferView)
 		{
 			++i;
 			out_draco_mesh_compression->buffer_view = CGLTF_PTRINDEX(cgltf_buffer_view, cgltf_json_to_int(tokens + i, json_chunk));
@@ -2998,7 +4408,7 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "mode") == 0)
+		if (tokens[i].key == cgltf_json_key_mode)
 		{
 			++i;
 			out_prim->type
@@ -3006,13 +4416,13 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "indices") == 0)
+		else if (tokens[i].key == cgltf_json_key_indices)
 		{
 			++i;
 			out_prim->indices = CGLTF_PTRINDEX(cgltf_accessor, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "material") == 0)
+		else if (tokens[i].key == cgltf_json_key_material)
 		{
 			++i;
 			int material_index = cgltf_json_to_int(tokens + i, json_chunk);
@@ -3020,11 +4430,11 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 			out_prim->material_index = material_index;
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "attributes") == 0)
+		else if (tokens[i].key == cgltf_json_key_attributes)
 		{
 			i = cgltf_parse_json_attribute_list(options, tokens, i + 1, json_chunk, &out_prim->attributes, &out_prim->attributes_count);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "targets") == 0)
+		else if (tokens[i].key == cgltf_json_key_targets)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_morph_target), (void**)&out_prim->targets, &out_prim->targets_count);
 			if (i < 0)
@@ -3041,7 +4451,7 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			// 
 			// Extract mesh.primitives.extras.targetNames here because some tools store targetNames here instead of mesh.extras.targetNames
@@ -3057,7 +4467,7 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 				{
 					CGLTF_CHECK_KEY(tokens[i]);
 
-					if (cgltf_json_strcmp(tokens + i, json_chunk, "targetNames") == 0)
+					if (tokens[i].key == cgltf_json_key_targetNames)
 					{
 						i = cgltf_parse_json_string_array(options, tokens, i + 1, json_chunk, &out_prim->target_names, &out_prim->target_names_count);
 					}
@@ -3077,7 +4487,7 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 				i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_prim->extras);
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -3101,7 +4511,7 @@ static int cgltf_parse_json_primitive(cgltf_options* options, jsmntok_t const* t
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_draco_mesh_compression") == 0)
+				if (tokens[i].key == cgltf_json_key_KHR_draco_mesh_compression)
 				{
 					out_prim->has_draco_mesh_compression = 1;
 					i = cgltf_parse_json_draco_mesh_compression(options, tokens, i + 1, json_chunk, &out_prim->draco_mesh_compression);
@@ -3142,11 +4552,11 @@ static int cgltf_parse_json_mesh(cgltf_options* options, jsmntok_t const* tokens
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_mesh->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "primitives") == 0)
+		else if (tokens[i].key == cgltf_json_key_primitives)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_primitive), (void**)&out_mesh->primitives, &out_mesh->primitives_count);
 			if (i < 0)
@@ -3163,7 +4573,7 @@ static int cgltf_parse_json_mesh(cgltf_options* options, jsmntok_t const* tokens
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "weights") == 0)
+		else if (tokens[i].key == cgltf_json_key_weights)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_float), (void**)&out_mesh->weights, &out_mesh->weights_count);
 			if (i < 0)
@@ -3173,7 +4583,7 @@ static int cgltf_parse_json_mesh(cgltf_options* options, jsmntok_t const* tokens
 
 			i = cgltf_parse_json_float_array(tokens, i - 1, json_chunk, out_mesh->weights, (int)out_mesh->weights_count);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			++i;
 
@@ -3189,7 +4599,7 @@ static int cgltf_parse_json_mesh(cgltf_options* options, jsmntok_t const* tokens
 				{
 					CGLTF_CHECK_KEY(tokens[i]);
 
-					if (cgltf_json_strcmp(tokens+i, json_chunk, "targetNames") == 0 && tokens[i+1].type == JSMN_ARRAY)
+					if (tokens[i].key == cgltf_json_key_targetNames && tokens[i+1].type == JSMN_ARRAY)
 					{
 						i = cgltf_parse_json_string_array(options, tokens, i + 1, json_chunk, &out_mesh->target_names, &out_mesh->target_names_count);
 					}
@@ -3209,7 +4619,7 @@ static int cgltf_parse_json_mesh(cgltf_options* options, jsmntok_t const* tokens
 				i = cgltf_skip_json(tokens, i);
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_mesh->extensions_count, &out_mesh->extensions);
 		}
@@ -3280,13 +4690,13 @@ static int cgltf_parse_json_accessor_sparse(cgltf_options* options, jsmntok_t co
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "count") == 0)
+		if (tokens[i].key == cgltf_json_key_count)
 		{
 			++i;
 			out_sparse->count = cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "indices") == 0)
+		else if (tokens[i].key == cgltf_json_key_indices)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_OBJECT);
@@ -3298,29 +4708,29 @@ static int cgltf_parse_json_accessor_sparse(cgltf_options* options, jsmntok_t co
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "bufferView") == 0)
+				if (tokens[i].key == cgltf_json_key_bufferView)
 				{
 					++i;
 					out_sparse->indices_buffer_view = CGLTF_PTRINDEX(cgltf_buffer_view, cgltf_json_to_int(tokens + i, json_chunk));
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteOffset") == 0)
+				else if (tokens[i].key == cgltf_json_key_byteOffset)
 				{
 					++i;
 					out_sparse->indices_byte_offset = cgltf_json_to_int(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "componentType") == 0)
+				else if (tokens[i].key == cgltf_json_key_componentType)
 				{
 					++i;
 					out_sparse->indices_component_type = cgltf_json_to_component_type(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+				else if (tokens[i].key == cgltf_json_key_extras)
 				{
 					i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_sparse->indices_extras);
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+				else if (tokens[i].key == cgltf_json_key_extensions)
 				{
 					i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_sparse->indices_extensions_count, &out_sparse->indices_extensions);
 				}
@@ -3335,7 +4745,7 @@ static int cgltf_parse_json_accessor_sparse(cgltf_options* options, jsmntok_t co
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "values") == 0)
+		else if (tokens[i].key == cgltf_json_key_values)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_OBJECT);
@@ -3347,23 +4757,23 @@ static int cgltf_parse_json_accessor_sparse(cgltf_options* options, jsmntok_t co
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "bufferView") == 0)
+				if (tokens[i].key == cgltf_json_key_bufferView)
 				{
 					++i;
 					out_sparse->values_buffer_view = CGLTF_PTRINDEX(cgltf_buffer_view, cgltf_json_to_int(tokens + i, json_chunk));
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteOffset") == 0)
+				else if (tokens[i].key == cgltf_json_key_byteOffset)
 				{
 					++i;
 					out_sparse->values_byte_offset = cgltf_json_to_int(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+				else if (tokens[i].key == cgltf_json_key_extras)
 				{
 					i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_sparse->values_extras);
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+				else if (tokens[i].key == cgltf_json_key_extensions)
 				{
 					i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_sparse->values_extensions_count, &out_sparse->values_extensions);
 				}
@@ -3378,11 +4788,11 @@ static int cgltf_parse_json_accessor_sparse(cgltf_options* options, jsmntok_t co
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_sparse->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_sparse->extensions_count, &out_sparse->extensions);
 		}
@@ -3411,72 +4821,72 @@ static int cgltf_parse_json_accessor(cgltf_options* options, jsmntok_t const* to
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "bufferView") == 0)
+		if (tokens[i].key == cgltf_json_key_bufferView)
 		{
 			++i;
 			out_accessor->buffer_view = CGLTF_PTRINDEX(cgltf_buffer_view, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteOffset") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteOffset)
 		{
 			++i;
 			out_accessor->offset =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "componentType") == 0)
+		else if (tokens[i].key == cgltf_json_key_componentType)
 		{
 			++i;
 			out_accessor->component_type = cgltf_json_to_component_type(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "normalized") == 0)
+		else if (tokens[i].key == cgltf_json_key_normalized)
 		{
 			++i;
 			out_accessor->normalized = cgltf_json_to_bool(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "count") == 0)
+		else if (tokens[i].key == cgltf_json_key_count)
 		{
 			++i;
 			out_accessor->count =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "type") == 0)
+		else if (tokens[i].key == cgltf_json_key_type)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens+i, json_chunk, "SCALAR") == 0)
+			if (tokens[i].key == cgltf_json_key_SCALAR)
 			{
 				out_accessor->type = cgltf_type_scalar;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "VEC2") == 0)
+			else if (tokens[i].key == cgltf_json_key_VEC2)
 			{
 				out_accessor->type = cgltf_type_vec2;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "VEC3") == 0)
+			else if (tokens[i].key == cgltf_json_key_VEC3)
 			{
 				out_accessor->type = cgltf_type_vec3;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "VEC4") == 0)
+			else if (tokens[i].key == cgltf_json_key_VEC4)
 			{
 				out_accessor->type = cgltf_type_vec4;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "MAT2") == 0)
+			else if (tokens[i].key == cgltf_json_key_MAT2)
 			{
 				out_accessor->type = cgltf_type_mat2;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "MAT3") == 0)
+			else if (tokens[i].key == cgltf_json_key_MAT3)
 			{
 				out_accessor->type = cgltf_type_mat3;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "MAT4") == 0)
+			else if (tokens[i].key == cgltf_json_key_MAT4)
 			{
 				out_accessor->type = cgltf_type_mat4;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "min") == 0)
+		else if (tokens[i].key == cgltf_json_key_min)
 		{
 			++i;
 			out_accessor->has_min = 1;
@@ -3484,7 +4894,7 @@ static int cgltf_parse_json_accessor(cgltf_options* options, jsmntok_t const* to
 			int min_size = tokens[i].size > 16 ? 16 : tokens[i].size;
 			i = cgltf_parse_json_float_array(tokens, i, json_chunk, out_accessor->min, min_size);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "max") == 0)
+		else if (tokens[i].key == cgltf_json_key_max)
 		{
 			++i;
 			out_accessor->has_max = 1;
@@ -3492,16 +4902,16 @@ static int cgltf_parse_json_accessor(cgltf_options* options, jsmntok_t const* to
 			int max_size = tokens[i].size > 16 ? 16 : tokens[i].size;
 			i = cgltf_parse_json_float_array(tokens, i, json_chunk, out_accessor->max, max_size);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "sparse") == 0)
+		else if (tokens[i].key == cgltf_json_key_sparse)
 		{
 			out_accessor->is_sparse = 1;
 			i = cgltf_parse_json_accessor_sparse(options, tokens, i + 1, json_chunk, &out_accessor->sparse);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_accessor->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_accessor->extensions_count, &out_accessor->extensions);
 		}
@@ -3530,21 +4940,21 @@ static int cgltf_parse_json_texture_transform(jsmntok_t const* tokens, int i, co
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "offset") == 0)
+		if (tokens[i].key == cgltf_json_key_offset)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_texture_transform->offset, 2);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "rotation") == 0)
+		else if (tokens[i].key == cgltf_json_key_rotation)
 		{
 			++i;
 			out_texture_transform->rotation = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "scale") == 0)
+		else if (tokens[i].key == cgltf_json_key_scale)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_texture_transform->scale, 2);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "texCoord") == 0)
+		else if (tokens[i].key == cgltf_json_key_texCoord)
 		{
 			++i;
 			out_texture_transform->texcoord = cgltf_json_to_int(tokens + i, json_chunk);
@@ -3578,35 +4988,35 @@ static int cgltf_parse_json_texture_view(cgltf_options* options, jsmntok_t const
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "index") == 0)
+		if (tokens[i].key == cgltf_json_key_index)
 		{
 			++i;
 			out_texture_view->texture = CGLTF_PTRINDEX(cgltf_texture, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "texCoord") == 0)
+		else if (tokens[i].key == cgltf_json_key_texCoord)
 		{
 			++i;
 			out_texture_view->texcoord = cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "scale") == 0) 
+		else if (tokens[i].key == cgltf_json_key_scale) 
 		{
 			++i;
 			out_texture_view->scale = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "strength") == 0)
+		else if (tokens[i].key == cgltf_json_key_strength)
 		{
 			++i;
 			out_texture_view->scale = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_texture_view->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -3631,7 +5041,7 @@ static int cgltf_parse_json_texture_view(cgltf_options* options, jsmntok_t const
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_texture_transform") == 0)
+				if (tokens[i].key == cgltf_json_key_KHR_texture_transform)
 				{
 					out_texture_view->has_transform = 1;
 					i = cgltf_parse_json_texture_transform(tokens, i + 1, json_chunk, &out_texture_view->transform);
@@ -3672,35 +5082,35 @@ static int cgltf_parse_json_pbr_metallic_roughness(cgltf_options* options, jsmnt
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "metallicFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_metallicFactor)
 		{
 			++i;
 			out_pbr->metallic_factor = 
 				cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "roughnessFactor") == 0) 
+		else if (tokens[i].key == cgltf_json_key_roughnessFactor) 
 		{
 			++i;
 			out_pbr->roughness_factor =
 				cgltf_json_to_float(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "baseColorFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_baseColorFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_pbr->base_color_factor, 4);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "baseColorTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_baseColorTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk,
 				&out_pbr->base_color_texture);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "metallicRoughnessTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_metallicRoughnessTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk,
 				&out_pbr->metallic_roughness_texture);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_pbr->extras);
 		}
@@ -3728,25 +5138,25 @@ static int cgltf_parse_json_pbr_specular_glossiness(cgltf_options* options, jsmn
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "diffuseFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_diffuseFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_pbr->diffuse_factor, 4);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "specularFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_specularFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_pbr->specular_factor, 3);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "glossinessFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_glossinessFactor)
 		{
 			++i;
 			out_pbr->glossiness_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "diffuseTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_diffuseTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_pbr->diffuse_texture);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "specularGlossinessTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_specularGlossinessTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_pbr->specular_glossiness_texture);
 		}
@@ -3774,27 +5184,27 @@ static int cgltf_parse_json_clearcoat(cgltf_options* options, jsmntok_t const* t
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "clearcoatFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_clearcoatFactor)
 		{
 			++i;
 			out_clearcoat->clearcoat_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "clearcoatRoughnessFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_clearcoatRoughnessFactor)
 		{
 			++i;
 			out_clearcoat->clearcoat_roughness_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "clearcoatTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_clearcoatTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_clearcoat->clearcoat_texture);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "clearcoatRoughnessTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_clearcoatRoughnessTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_clearcoat->clearcoat_roughness_texture);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "clearcoatNormalTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_clearcoatNormalTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_clearcoat->clearcoat_normal_texture);
 		}
@@ -3825,7 +5235,7 @@ static int cgltf_parse_json_ior(jsmntok_t const* tokens, int i, const uint8_t* j
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "ior") == 0)
+		if (tokens[i].key == cgltf_json_key_ior)
 		{
 			++i;
 			out_ior->ior = cgltf_json_to_float(tokens + i, json_chunk);
@@ -3859,17 +5269,17 @@ static int cgltf_parse_json_specular(cgltf_options* options, jsmntok_t const* to
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "specularFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_specularFactor)
 		{
 			++i;
 			out_specular->specular_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "specularColorFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_specularColorFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_specular->specular_color_factor, 3);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "specularTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_specularTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_specular->specular_texture);
 		}
@@ -3897,13 +5307,13 @@ static int cgltf_parse_json_transmission(cgltf_options* options, jsmntok_t const
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "transmissionFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_transmissionFactor)
 		{
 			++i;
 			out_transmission->transmission_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "transmissionTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_transmissionTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_transmission->transmission_texture);
 		}
@@ -3931,21 +5341,21 @@ static int cgltf_parse_json_sheen(cgltf_options* options, jsmntok_t const* token
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "sheenColorFactor") == 0)
+		if (tokens[i].key == cgltf_json_key_sheenColorFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_sheen->sheen_color_factor, 3);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "sheenColorTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_sheenColorTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_sheen->sheen_color_texture);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "sheenRoughnessFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_sheenRoughnessFactor)
 		{
 			++i;
 			out_sheen->sheen_roughness_factor = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "sheenRoughnessTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_sheenRoughnessTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk, &out_sheen->sheen_roughness_texture);
 		}
@@ -3974,29 +5384,29 @@ static int cgltf_parse_json_image(cgltf_options* options, jsmntok_t const* token
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "uri") == 0) 
+		if (tokens[i].key == cgltf_json_key_uri) 
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_image->uri);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "bufferView") == 0)
+		else if (tokens[i].key == cgltf_json_key_bufferView)
 		{
 			++i;
 			out_image->buffer_view = CGLTF_PTRINDEX(cgltf_buffer_view, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "mimeType") == 0)
+		else if (tokens[i].key == cgltf_json_key_mimeType)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_image->mime_type);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "name") == 0)
+		else if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_image->name);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_image->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_image->extensions_count, &out_image->extensions);
 		}
@@ -4029,39 +5439,39 @@ static int cgltf_parse_json_sampler(cgltf_options* options, jsmntok_t const* tok
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "magFilter") == 0) 
+		if (tokens[i].key == cgltf_json_key_magFilter) 
 		{
 			++i;
 			out_sampler->mag_filter
 				= cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "minFilter") == 0)
+		else if (tokens[i].key == cgltf_json_key_minFilter)
 		{
 			++i;
 			out_sampler->min_filter
 				= cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "wrapS") == 0)
+		else if (tokens[i].key == cgltf_json_key_wrapS)
 		{
 			++i;
 			out_sampler->wrap_s
 				= cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "wrapT") == 0) 
+		else if (tokens[i].key == cgltf_json_key_wrapT) 
 		{
 			++i;
 			out_sampler->wrap_t
 				= cgltf_json_to_int(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_sampler->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_sampler->extensions_count, &out_sampler->extensions);
 		}
@@ -4090,17 +5500,17 @@ static int cgltf_parse_json_texture(cgltf_options* options, jsmntok_t const* tok
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_texture->name);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "sampler") == 0)
+		else if (tokens[i].key == cgltf_json_key_sampler)
 		{
 			++i;
 			out_texture->sampler = CGLTF_PTRINDEX(cgltf_sampler, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "source") == 0) 
+		else if (tokens[i].key == cgltf_json_key_source) 
 		{
 			++i;
 			cgltf_int index = cgltf_json_to_int(tokens + i, json_chunk);
@@ -4108,11 +5518,11 @@ static int cgltf_parse_json_texture(cgltf_options* options, jsmntok_t const* tok
 			out_texture->image = CGLTF_PTRINDEX(cgltf_image, index);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_texture->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_texture->extensions_count, &out_texture->extensions);
 		}
@@ -4151,69 +5561,69 @@ static int cgltf_parse_json_material(cgltf_options* options, jsmntok_t const* to
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_material->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "pbrMetallicRoughness") == 0)
+		else if (tokens[i].key == cgltf_json_key_pbrMetallicRoughness)
 		{
 			out_material->has_pbr_metallic_roughness = 1;
 			i = cgltf_parse_json_pbr_metallic_roughness(options, tokens, i + 1, json_chunk, &out_material->pbr_metallic_roughness);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "emissiveFactor") == 0)
+		else if (tokens[i].key == cgltf_json_key_emissiveFactor)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_material->emissive_factor, 3);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "normalTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_normalTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk,
 				&out_material->normal_texture);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "occlusionTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_occlusionTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk,
 				&out_material->occlusion_texture);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "emissiveTexture") == 0)
+		else if (tokens[i].key == cgltf_json_key_emissiveTexture)
 		{
 			i = cgltf_parse_json_texture_view(options, tokens, i + 1, json_chunk,
 				&out_material->emissive_texture);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "alphaMode") == 0)
+		else if (tokens[i].key == cgltf_json_key_alphaMode)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens + i, json_chunk, "OPAQUE") == 0)
+			if (tokens[i].key == cgltf_json_key_OPAQUE)
 			{
 				out_material->alpha_mode = cgltf_alpha_mode_opaque;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "MASK") == 0)
+			else if (tokens[i].key == cgltf_json_key_MASK)
 			{
 				out_material->alpha_mode = cgltf_alpha_mode_mask;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "BLEND") == 0)
+			else if (tokens[i].key == cgltf_json_key_BLEND)
 			{
 				out_material->alpha_mode = cgltf_alpha_mode_blend;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "alphaCutoff") == 0)
+		else if (tokens[i].key == cgltf_json_key_alphaCutoff)
 		{
 			++i;
 			out_material->alpha_cutoff = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "doubleSided") == 0)
+		else if (tokens[i].key == cgltf_json_key_doubleSided)
 		{
 			++i;
 			out_material->double_sided =
 				cgltf_json_to_bool(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_material->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -4237,37 +5647,37 @@ static int cgltf_parse_json_material(cgltf_options* options, jsmntok_t const* to
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_pbrSpecularGlossiness") == 0)
+				if (tokens[i].key == cgltf_json_key_KHR_materials_pbrSpecularGlossiness)
 				{
 					out_material->has_pbr_specular_glossiness = 1;
 					i = cgltf_parse_json_pbr_specular_glossiness(options, tokens, i + 1, json_chunk, &out_material->pbr_specular_glossiness);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_unlit") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_unlit)
 				{
 					out_material->unlit = 1;
 					i = cgltf_skip_json(tokens, i+1);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_clearcoat") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_clearcoat)
 				{
 					out_material->has_clearcoat = 1;
 					i = cgltf_parse_json_clearcoat(options, tokens, i + 1, json_chunk, &out_material->clearcoat);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_ior") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_ior)
 				{
 					out_material->has_ior = 1;
 					i = cgltf_parse_json_ior(tokens, i + 1, json_chunk, &out_material->ior);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_specular") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_specular)
 				{
 					out_material->has_specular = 1;
 					i = cgltf_parse_json_specular(options, tokens, i + 1, json_chunk, &out_material->specular);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_transmission") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_transmission)
 				{
 					out_material->has_transmission = 1;
 					i = cgltf_parse_json_transmission(options, tokens, i + 1, json_chunk, &out_material->transmission);
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_materials_sheen") == 0)
+				else if (tokens[i].key == cgltf_json_key_KHR_materials_sheen)
 				{
 					out_material->has_sheen = 1;
 					i = cgltf_parse_json_sheen(options, tokens, i + 1, json_chunk, &out_material->sheen);
@@ -4404,69 +5814,69 @@ static int cgltf_parse_json_meshopt_compression(cgltf_options* options, jsmntok_
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "buffer") == 0)
+		if (tokens[i].key == cgltf_json_key_buffer)
 		{
 			++i;
 			out_meshopt_compression->buffer = CGLTF_PTRINDEX(cgltf_buffer, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteOffset") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteOffset)
 		{
 			++i;
 			out_meshopt_compression->offset = cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteLength") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteLength)
 		{
 			++i;
 			out_meshopt_compression->size = cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteStride") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteStride)
 		{
 			++i;
 			out_meshopt_compression->stride = cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "count") == 0)
+		else if (tokens[i].key == cgltf_json_key_count)
 		{
 			++i;
 			out_meshopt_compression->count = cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "mode") == 0)
+		else if (tokens[i].key == cgltf_json_key_mode)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens+i, json_chunk, "ATTRIBUTES") == 0)
+			if (tokens[i].key == cgltf_json_key_ATTRIBUTES)
 			{
 				out_meshopt_compression->mode = cgltf_meshopt_compression_mode_attributes;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "TRIANGLES") == 0)
+			else if (tokens[i].key == cgltf_json_key_TRIANGLES)
 			{
 				out_meshopt_compression->mode = cgltf_meshopt_compression_mode_triangles;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "INDICES") == 0)
+			else if (tokens[i].key == cgltf_json_key_INDICES)
 			{
 				out_meshopt_compression->mode = cgltf_meshopt_compression_mode_indices;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "filter") == 0)
+		else if (tokens[i].key == cgltf_json_key_filter)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens+i, json_chunk, "NONE") == 0)
+			if (tokens[i].key == cgltf_json_key_NONE)
 			{
 				out_meshopt_compression->filter = cgltf_meshopt_compression_filter_none;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "OCTAHEDRAL") == 0)
+			else if (tokens[i].key == cgltf_json_key_OCTAHEDRAL)
 			{
 				out_meshopt_compression->filter = cgltf_meshopt_compression_filter_octahedral;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "QUATERNION") == 0)
+			else if (tokens[i].key == cgltf_json_key_QUATERNION)
 			{
 				out_meshopt_compression->filter = cgltf_meshopt_compression_filter_quaternion;
 			}
-			else if (cgltf_json_strcmp(tokens+i, json_chunk, "EXPONENTIAL") == 0)
+			else if (tokens[i].key == cgltf_json_key_EXPONENTIAL)
 			{
 				out_meshopt_compression->filter = cgltf_meshopt_compression_filter_exponential;
 			}
@@ -4497,7 +5907,7 @@ static int cgltf_parse_json_buffer_view(cgltf_options* options, jsmntok_t const*
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "buffer") == 0)
+		if (tokens[i].key == cgltf_json_key_buffer)
 		{
 			++i;
 			int buffer_index = cgltf_json_to_int(tokens + i, json_chunk);
@@ -4505,28 +5915,28 @@ static int cgltf_parse_json_buffer_view(cgltf_options* options, jsmntok_t const*
 			out_buffer_view->buffer_index = buffer_index;
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteOffset") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteOffset)
 		{
 			++i;
 			out_buffer_view->offset =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteLength") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteLength)
 		{
 			++i;
 			out_buffer_view->size =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "byteStride") == 0)
+		else if (tokens[i].key == cgltf_json_key_byteStride)
 		{
 			++i;
 			out_buffer_view->stride =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "target") == 0)
+		else if (tokens[i].key == cgltf_json_key_target)
 		{
 			++i;
 			int type = cgltf_json_to_int(tokens+i, json_chunk);
@@ -4545,11 +5955,11 @@ static int cgltf_parse_json_buffer_view(cgltf_options* options, jsmntok_t const*
 			out_buffer_view->type = (cgltf_buffer_view_type)type;
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_buffer_view->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -4573,7 +5983,7 @@ static int cgltf_parse_json_buffer_view(cgltf_options* options, jsmntok_t const*
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "EXT_meshopt_compression") == 0)
+				if (tokens[i].key == cgltf_json_key_EXT_meshopt_compression)
 				{
 					out_buffer_view->has_meshopt_compression = 1;
 					i = cgltf_parse_json_meshopt_compression(options, tokens, i + 1, json_chunk, &out_buffer_view->meshopt_compression);
@@ -4633,22 +6043,22 @@ static int cgltf_parse_json_buffer(cgltf_options* options, jsmntok_t const* toke
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "byteLength") == 0)
+		if (tokens[i].key == cgltf_json_key_byteLength)
 		{
 			++i;
 			out_buffer->size =
 					cgltf_json_to_int(tokens+i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "uri") == 0)
+		else if (tokens[i].key == cgltf_json_key_uri)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_buffer->uri);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_buffer->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_buffer->extensions_count, &out_buffer->extensions);
 		}
@@ -4696,11 +6106,11 @@ static int cgltf_parse_json_skin(cgltf_options* options, jsmntok_t const* tokens
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_skin->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "joints") == 0)
+		else if (tokens[i].key == cgltf_json_key_joints)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_node*), (void**)&out_skin->joints, &out_skin->joints_count);
 			if (i < 0)
@@ -4714,25 +6124,25 @@ static int cgltf_parse_json_skin(cgltf_options* options, jsmntok_t const* tokens
 				++i;
 			}
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "skeleton") == 0)
+		else if (tokens[i].key == cgltf_json_key_skeleton)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
 			out_skin->skeleton = CGLTF_PTRINDEX(cgltf_node, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "inverseBindMatrices") == 0)
+		else if (tokens[i].key == cgltf_json_key_inverseBindMatrices)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
 			out_skin->inverse_bind_matrices = CGLTF_PTRINDEX(cgltf_accessor, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_skin->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_skin->extensions_count, &out_skin->extensions);
 		}
@@ -4780,24 +6190,24 @@ static int cgltf_parse_json_camera(cgltf_options* options, jsmntok_t const* toke
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_camera->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "type") == 0)
+		else if (tokens[i].key == cgltf_json_key_type)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens + i, json_chunk, "perspective") == 0)
+			if (tokens[i].key == cgltf_json_key_perspective)
 			{
 				out_camera->type = cgltf_camera_type_perspective;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "orthographic") == 0)
+			else if (tokens[i].key == cgltf_json_key_orthographic)
 			{
 				out_camera->type = cgltf_camera_type_orthographic;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "perspective") == 0)
+		else if (tokens[i].key == cgltf_json_key_perspective)
 		{
 			++i;
 
@@ -4812,31 +6222,31 @@ static int cgltf_parse_json_camera(cgltf_options* options, jsmntok_t const* toke
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "aspectRatio") == 0)
+				if (tokens[i].key == cgltf_json_key_aspectRatio)
 				{
 					++i;
 					out_camera->data.perspective.aspect_ratio = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "yfov") == 0)
+				else if (tokens[i].key == cgltf_json_key_yfov)
 				{
 					++i;
 					out_camera->data.perspective.yfov = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "zfar") == 0)
+				else if (tokens[i].key == cgltf_json_key_zfar)
 				{
 					++i;
 					out_camera->data.perspective.zfar = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "znear") == 0)
+				else if (tokens[i].key == cgltf_json_key_znear)
 				{
 					++i;
 					out_camera->data.perspective.znear = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+				else if (tokens[i].key == cgltf_json_key_extras)
 				{
 					i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_camera->data.perspective.extras);
 				}
@@ -4851,7 +6261,7 @@ static int cgltf_parse_json_camera(cgltf_options* options, jsmntok_t const* toke
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "orthographic") == 0)
+		else if (tokens[i].key == cgltf_json_key_orthographic)
 		{
 			++i;
 
@@ -4866,31 +6276,31 @@ static int cgltf_parse_json_camera(cgltf_options* options, jsmntok_t const* toke
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "xmag") == 0)
+				if (tokens[i].key == cgltf_json_key_xmag)
 				{
 					++i;
 					out_camera->data.orthographic.xmag = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "ymag") == 0)
+				else if (tokens[i].key == cgltf_json_key_ymag)
 				{
 					++i;
 					out_camera->data.orthographic.ymag = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "zfar") == 0)
+				else if (tokens[i].key == cgltf_json_key_zfar)
 				{
 					++i;
 					out_camera->data.orthographic.zfar = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "znear") == 0)
+				else if (tokens[i].key == cgltf_json_key_znear)
 				{
 					++i;
 					out_camera->data.orthographic.znear = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+				else if (tokens[i].key == cgltf_json_key_extras)
 				{
 					i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_camera->data.orthographic.extras);
 				}
@@ -4905,11 +6315,11 @@ static int cgltf_parse_json_camera(cgltf_options* options, jsmntok_t const* toke
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_camera->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_camera->extensions_count, &out_camera->extensions);
 		}
@@ -4957,44 +6367,44 @@ static int cgltf_parse_json_light(cgltf_options* options, jsmntok_t const* token
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_light->name);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "color") == 0)
+		else if (tokens[i].key == cgltf_json_key_color)
 		{
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_light->color, 3);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "intensity") == 0)
+		else if (tokens[i].key == cgltf_json_key_intensity)
 		{
 			++i;
 			out_light->intensity = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "type") == 0)
+		else if (tokens[i].key == cgltf_json_key_type)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens + i, json_chunk, "directional") == 0)
+			if (tokens[i].key == cgltf_json_key_directional)
 			{
 				out_light->type = cgltf_light_type_directional;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "point") == 0)
+			else if (tokens[i].key == cgltf_json_key_point)
 			{
 				out_light->type = cgltf_light_type_point;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "spot") == 0)
+			else if (tokens[i].key == cgltf_json_key_spot)
 			{
 				out_light->type = cgltf_light_type_spot;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "range") == 0)
+		else if (tokens[i].key == cgltf_json_key_range)
 		{
 			++i;
 			out_light->range = cgltf_json_to_float(tokens + i, json_chunk);
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "spot") == 0)
+		else if (tokens[i].key == cgltf_json_key_spot)
 		{
 			++i;
 
@@ -5007,13 +6417,13 @@ static int cgltf_parse_json_light(cgltf_options* options, jsmntok_t const* token
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "innerConeAngle") == 0)
+				if (tokens[i].key == cgltf_json_key_innerConeAngle)
 				{
 					++i;
 					out_light->spot_inner_cone_angle = cgltf_json_to_float(tokens + i, json_chunk);
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "outerConeAngle") == 0)
+				else if (tokens[i].key == cgltf_json_key_outerConeAngle)
 				{
 					++i;
 					out_light->spot_outer_cone_angle = cgltf_json_to_float(tokens + i, json_chunk);
@@ -5083,11 +6493,11 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_node->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "children") == 0)
+		else if (tokens[i].key == cgltf_json_key_children)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_node*), (void**)&out_node->children, &out_node->children_count);
 			if (i < 0)
@@ -5101,7 +6511,7 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 				++i;
 			}
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "mesh") == 0)
+		else if (tokens[i].key == cgltf_json_key_mesh)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
@@ -5110,41 +6520,41 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 			out_node->mesh_index = mesh_index;
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "skin") == 0)
+		else if (tokens[i].key == cgltf_json_key_skin)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
 			out_node->skin = CGLTF_PTRINDEX(cgltf_skin, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "camera") == 0)
+		else if (tokens[i].key == cgltf_json_key_camera)
 		{
 			++i;
 			CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
 			out_node->camera = CGLTF_PTRINDEX(cgltf_camera, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "translation") == 0)
+		else if (tokens[i].key == cgltf_json_key_translation)
 		{
 			out_node->has_translation = 1;
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_node->translation, 3);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "rotation") == 0)
+		else if (tokens[i].key == cgltf_json_key_rotation)
 		{
 			out_node->has_rotation = 1;
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_node->rotation, 4);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "scale") == 0)
+		else if (tokens[i].key == cgltf_json_key_scale)
 		{
 			out_node->has_scale = 1;
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_node->scale, 3);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "matrix") == 0)
+		else if (tokens[i].key == cgltf_json_key_matrix)
 		{
 			out_node->has_matrix = 1;
 			i = cgltf_parse_json_float_array(tokens, i + 1, json_chunk, out_node->matrix, 16);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "weights") == 0)
+		else if (tokens[i].key == cgltf_json_key_weights)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_float), (void**)&out_node->weights, &out_node->weights_count);
 			if (i < 0)
@@ -5154,11 +6564,11 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 
 			i = cgltf_parse_json_float_array(tokens, i - 1, json_chunk, out_node->weights, (int)out_node->weights_count);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_node->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -5183,7 +6593,7 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_lights_punctual") == 0)
+				if (tokens[i].key == cgltf_json_key_KHR_lights_punctual)
 				{
 					++i;
 
@@ -5196,7 +6606,7 @@ static int cgltf_parse_json_node(cgltf_options* options, jsmntok_t const* tokens
 					{
 						CGLTF_CHECK_KEY(tokens[i]);
 
-						if (cgltf_json_strcmp(tokens + i, json_chunk, "light") == 0)
+						if (tokens[i].key == cgltf_json_key_light)
 						{
 							++i;
 							CGLTF_CHECK_TOKTYPE(tokens[i], JSMN_PRIMITIVE);
@@ -5269,11 +6679,11 @@ static int cgltf_parse_json_scene(cgltf_options* options, jsmntok_t const* token
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_scene->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "nodes") == 0)
+		else if (tokens[i].key == cgltf_json_key_nodes)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_node*), (void**)&out_scene->nodes, &out_scene->nodes_count);
 			if (i < 0)
@@ -5287,11 +6697,11 @@ static int cgltf_parse_json_scene(cgltf_options* options, jsmntok_t const* token
 				++i;
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_scene->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_scene->extensions_count, &out_scene->extensions);
 		}
@@ -5340,40 +6750,40 @@ static int cgltf_parse_json_animation_sampler(cgltf_options* options, jsmntok_t
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "input") == 0)
+		if (tokens[i].key == cgltf_json_key_input)
 		{
 			++i;
 			out_sampler->input = CGLTF_PTRINDEX(cgltf_accessor, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "output") == 0)
+		else if (tokens[i].key == cgltf_json_key_output)
 		{
 			++i;
 			out_sampler->output = CGLTF_PTRINDEX(cgltf_accessor, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "interpolation") == 0)
+		else if (tokens[i].key == cgltf_json_key_interpolation)
 		{
 			++i;
-			if (cgltf_json_strcmp(tokens + i, json_chunk, "LINEAR") == 0)
+			if (tokens[i].key == cgltf_json_key_LINEAR)
 			{
 				out_sampler->interpolation = cgltf_interpolation_type_linear;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "STEP") == 0)
+			else if (tokens[i].key == cgltf_json_key_STEP)
 			{
 				out_sampler->interpolation = cgltf_interpolation_type_step;
 			}
-			else if (cgltf_json_strcmp(tokens + i, json_chunk, "CUBICSPLINE") == 0)
+			else if (tokens[i].key == cgltf_json_key_CUBICSPLINE)
 			{
 				out_sampler->interpolation = cgltf_interpolation_type_cubic_spline;
 			}
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_sampler->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_sampler->extensions_count, &out_sampler->extensions);
 		}
@@ -5403,13 +6813,13 @@ static int cgltf_parse_json_animation_channel(cgltf_options* options, jsmntok_t
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "sampler") == 0)
+		if (tokens[i].key == cgltf_json_key_sampler)
 		{
 			++i;
 			out_channel->sampler = CGLTF_PTRINDEX(cgltf_animation_sampler, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "target") == 0)
+		else if (tokens[i].key == cgltf_json_key_target)
 		{
 			++i;
 
@@ -5422,38 +6832,38 @@ static int cgltf_parse_json_animation_channel(cgltf_options* options, jsmntok_t
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "node") == 0)
+				if (tokens[i].key == cgltf_json_key_node)
 				{
 					++i;
 					out_channel->target_node = CGLTF_PTRINDEX(cgltf_node, cgltf_json_to_int(tokens + i, json_chunk));
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens+i, json_chunk, "path") == 0)
+				else if (tokens[i].key == cgltf_json_key_path)
 				{
 					++i;
-					if (cgltf_json_strcmp(tokens+i, json_chunk, "translation") == 0)
+					if (tokens[i].key == cgltf_json_key_translation)
 					{
 						out_channel->target_path = cgltf_animation_path_type_translation;
 					}
-					else if (cgltf_json_strcmp(tokens+i, json_chunk, "rotation") == 0)
+					else if (tokens[i].key == cgltf_json_key_rotation)
 					{
 						out_channel->target_path = cgltf_animation_path_type_rotation;
 					}
-					else if (cgltf_json_strcmp(tokens+i, json_chunk, "scale") == 0)
+					else if (tokens[i].key == cgltf_json_key_scale)
 					{
 						out_channel->target_path = cgltf_animation_path_type_scale;
 					}
-					else if (cgltf_json_strcmp(tokens+i, json_chunk, "weights") == 0)
+					else if (tokens[i].key == cgltf_json_key_weights)
 					{
 						out_channel->target_path = cgltf_animation_path_type_weights;
 					}
 					++i;
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+				else if (tokens[i].key == cgltf_json_key_extras)
 				{
 					i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_channel->extras);
 				}
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+				else if (tokens[i].key == cgltf_json_key_extensions)
 				{
 					i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_channel->extensions_count, &out_channel->extensions);
 				}
@@ -5493,11 +6903,11 @@ static int cgltf_parse_json_animation(cgltf_options* options, jsmntok_t const* t
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "name") == 0)
+		if (tokens[i].key == cgltf_json_key_name)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_animation->name);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "samplers") == 0)
+		else if (tokens[i].key == cgltf_json_key_samplers)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_animation_sampler), (void**)&out_animation->samplers, &out_animation->samplers_count);
 			if (i < 0)
@@ -5514,7 +6924,7 @@ static int cgltf_parse_json_animation(cgltf_options* options, jsmntok_t const* t
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "channels") == 0)
+		else if (tokens[i].key == cgltf_json_key_channels)
 		{
 			i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_animation_channel), (void**)&out_animation->channels, &out_animation->channels_count);
 			if (i < 0)
@@ -5531,11 +6941,11 @@ static int cgltf_parse_json_animation(cgltf_options* options, jsmntok_t const* t
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_animation->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_animation->extensions_count, &out_animation->extensions);
 		}
@@ -5583,27 +6993,27 @@ static int cgltf_parse_json_asset(cgltf_options* options, jsmntok_t const* token
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens+i, json_chunk, "copyright") == 0)
+		if (tokens[i].key == cgltf_json_key_copyright)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_asset->copyright);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "generator") == 0)
+		else if (tokens[i].key == cgltf_json_key_generator)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_asset->generator);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "version") == 0)
+		else if (tokens[i].key == cgltf_json_key_version)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_asset->version);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "minVersion") == 0)
+		else if (tokens[i].key == cgltf_json_key_minVersion)
 		{
 			i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_asset->min_version);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_asset->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			i = cgltf_parse_json_unprocessed_extensions(options, tokens, i, json_chunk, &out_asset->extensions_count, &out_asset->extensions);
 		}
@@ -5682,6 +7092,46 @@ static cgltf_size cgltf_calc_size(cgltf_type type, cgltf_component_type componen
 
 #ifdef CGLTF_VRM_v0_0_IMPLEMENTATION
 #include "vrm/vrm_types.v0_0.inl"
+
+static int cgltf_parse_json_vrm_spans_v0_0(jsmntok_t const* tokens, int i, cgltf_vrm_spans_v0_0* out_spans)
+{
+	if (tokens[i].type != JSMN_OBJECT)
+	{
+		return i;
+	}
+
+	int size = tokens[i].size;
+	++i;
+
+	for (int j = 0; j < size; ++j)
+	{
+		cgltf_json_span* span = NULL;
+		switch (tokens[i].key)
+		{
+		case cgltf_vrm_json_key_v0_0_meta: span = &out_spans->meta; break;
+		case cgltf_vrm_json_key_v0_0_humanoid: span = &out_spans->humanoid; break;
+		case cgltf_vrm_json_key_v0_0_firstPerson: span = &out_spans->firstPerson; break;
+		case cgltf_vrm_json_key_v0_0_blendShapeMaster: span = &out_spans->blendShapeMaster; break;
+		case cgltf_vrm_json_key_v0_0_secondaryAnimation: span = &out_spans->secondaryAnimation; break;
+		case cgltf_vrm_json_key_v0_0_materialProperties: span = &out_spans->materialProperties; break;
+		default: break;
+		}
+
+		if (span)
+		{
+			span->start_offset = tokens[i + 1].start;
+			span->end_offset = tokens[i + 1].end;
+		}
+
+		i = cgltf_skip_json(tokens, i + 1);
+		if (i < 0)
+		{
+			return i;
+		}
+	}
+
+	return i;
+}
 #endif
 
 #ifdef CGLTF_VRM_v1_0_IMPLEMENTATION
@@ -5701,73 +7151,73 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 	{
 		CGLTF_CHECK_KEY(tokens[i]);
 
-		if (cgltf_json_strcmp(tokens + i, json_chunk, "asset") == 0)
+		if (tokens[i].key == cgltf_json_key_asset)
 		{
 			i = cgltf_parse_json_asset(options, tokens, i + 1, json_chunk, &out_data->asset);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "meshes") == 0)
+		else if (tokens[i].key == cgltf_json_key_meshes)
 		{
 			i = cgltf_parse_json_meshes(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "accessors") == 0)
+		else if (tokens[i].key == cgltf_json_key_accessors)
 		{
 			i = cgltf_parse_json_accessors(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "bufferViews") == 0)
+		else if (tokens[i].key == cgltf_json_key_bufferViews)
 		{
 			i = cgltf_parse_json_buffer_views(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "buffers") == 0)
+		else if (tokens[i].key == cgltf_json_key_buffers)
 		{
 			i = cgltf_parse_json_buffers(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "materials") == 0)
+		else if (tokens[i].key == cgltf_json_key_materials)
 		{
 			i = cgltf_parse_json_materials(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "images") == 0)
+		else if (tokens[i].key == cgltf_json_key_images)
 		{
 			i = cgltf_parse_json_images(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "textures") == 0)
+		else if (tokens[i].key == cgltf_json_key_textures)
 		{
 			i = cgltf_parse_json_textures(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "samplers") == 0)
+		else if (tokens[i].key == cgltf_json_key_samplers)
 		{
 			i = cgltf_parse_json_samplers(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "skins") == 0)
+		else if (tokens[i].key == cgltf_json_key_skins)
 		{
 			i = cgltf_parse_json_skins(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "cameras") == 0)
+		else if (tokens[i].key == cgltf_json_key_cameras)
 		{
 			i = cgltf_parse_json_cameras(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "nodes") == 0)
+		else if (tokens[i].key == cgltf_json_key_nodes)
 		{
 			i = cgltf_parse_json_nodes(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "scenes") == 0)
+		else if (tokens[i].key == cgltf_json_key_scenes)
 		{
 			i = cgltf_parse_json_scenes(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "scene") == 0)
+		else if (tokens[i].key == cgltf_json_key_scene)
 		{
 			++i;
 			out_data->scene = CGLTF_PTRINDEX(cgltf_scene, cgltf_json_to_int(tokens + i, json_chunk));
 			++i;
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "animations") == 0)
+		else if (tokens[i].key == cgltf_json_key_animations)
 		{
 			i = cgltf_parse_json_animations(options, tokens, i + 1, json_chunk, out_data);
 		}
-		else if (cgltf_json_strcmp(tokens+i, json_chunk, "extras") == 0)
+		else if (tokens[i].key == cgltf_json_key_extras)
 		{
 			i = cgltf_parse_json_extras(tokens, i + 1, json_chunk, &out_data->extras);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensions") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensions)
 		{
 			++i;
 
@@ -5792,7 +7242,7 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 			{
 				CGLTF_CHECK_KEY(tokens[i]);
 
-				if (cgltf_json_strcmp(tokens+i, json_chunk, "KHR_lights_punctual") == 0)
+				if (tokens[i].key == cgltf_json_key_KHR_lights_punctual)
 				{
 					++i;
 
@@ -5805,7 +7255,7 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 					{
 						CGLTF_CHECK_KEY(tokens[i]);
 
-						if (cgltf_json_strcmp(tokens + i, json_chunk, "lights") == 0)
+						if (tokens[i].key == cgltf_json_key_lights)
 						{
 							i = cgltf_parse_json_lights(options, tokens, i + 1, json_chunk, out_data);
 						}
@@ -5821,15 +7271,19 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 					}
 				}
 #ifdef CGLTF_VRM_v0_0_IMPLEMENTATION
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "VRM") == 0)
+				else if (tokens[i].key == cgltf_json_key_VRM)
 				{
+					if (cgltf_parse_json_vrm_spans_v0_0(tokens, i + 1, &out_data->vrm_v0_0_spans) < 0)
+					{
+						return CGLTF_ERROR_JSON;
+					}
 					i = cgltf_parse_json_vrm_v0_0(options, tokens, i + 1, json_chunk, &out_data->vrm_v0_0);
 					out_data->has_vrm_v0_0 = 1;
 				}
 #endif
 
 #ifdef CGLTF_VRM_v1_0_IMPLEMENTATION
-				else if (cgltf_json_strcmp(tokens + i, json_chunk, "VRMC_vrm") == 0)
+				else if (tokens[i].key == cgltf_json_key_VRMC_vrm)
 				{
 					i = cgltf_parse_json_vrmc_vrm_v1_0(options, tokens, i + 1, json_chunk, &out_data->vrm_v1_0);
 					out_data->has_vrm_v1_0 = 1;
@@ -5847,11 +7301,11 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 				}
 			}
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensionsUsed") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensionsUsed)
 		{
 			i = cgltf_parse_json_string_array(options, tokens, i + 1, json_chunk, &out_data->extensions_used, &out_data->extensions_used_count);
 		}
-		else if (cgltf_json_strcmp(tokens + i, json_chunk, "extensionsRequired") == 0)
+		else if (tokens[i].key == cgltf_json_key_extensionsRequired)
 		{
 			i = cgltf_parse_json_string_array(options, tokens, i + 1, json_chunk, &out_data->extensions_required, &out_data->extensions_required_count);
 		}
@@ -5869,23 +7323,62 @@ static int cgltf_parse_json_root(cgltf_options* options, jsmntok_t const* tokens
 	return i;
 }
 
+static int cgltf_json_lookup_key(const uint8_t* str, int length)
+{
+	int key = cgltf_json_key_lookup((const char*)str, length);
+#ifdef CGLTF_VRM_v0_0_IMPLEMENTATION
+	if (key == cgltf_json_key_unknown)
+	{
+		key = cgltf_vrm_json_key_lookup_v0_0((const char*)str, length);
+	}
+#endif
+	return key;
+}
+
+static cgltf_result cgltf_parse_json_document(cgltf_options* options, const uint8_t* json_chunk, cgltf_size size, cgltf_data** out_data);
+
 cgltf_result cgltf_parse_json(cgltf_options* options, const uint8_t* json_chunk, cgltf_size size, cgltf_data** out_data)
 {
-	jsmn_parser parser = { 0, 0, 0 };
+	if (!options->memory.arena)
+	{
+		return cgltf_parse_json_document(options, json_chunk, size, out_data);
+	}
 
-	if (options->json_token_count == 0)
+	cgltf_arena* arena = cgltf_arena_create(&options->memory);
+	if (!arena)
 	{
-		int token_count = jsmn_parse(&parser, (const char*)json_chunk, size, NULL, 0);
+		return cgltf_result_out_of_memory;
+	}
 
-		if (token_count <= 0)
-		{
-			return cgltf_result_invalid_json;
-		}
+	// the data keeps the arena as its allocator, so whatever is added to it later is released along with it
+	cgltf_options arena_options = *options;
+	arena_options.memory = cgltf_arena_memory(arena);
 
-		options->json_token_count = token_count;
+	cgltf_result result = cgltf_parse_json_document(&arena_options, json_chunk, size, out_data);
+	if (result != cgltf_result_success)
+	{
+		cgltf_arena_destroy(arena);
 	}
 
-	jsmntok_t* tokens = (jsmntok_t*)options->memory.alloc(options->memory.user_data, sizeof(jsmntok_t) * (options->json_token_count + 1));
+	return result;
+}
+
+#define CGLTF_JSON_TOKEN_ESTIMATE_MAX 65536
+
+static cgltf_result cgltf_parse_json_document(cgltf_options* options, const uint8_t* json_chunk, cgltf_size size, cgltf_data** out_data)
+{
+	jsmn_parser parser = { 0, 0, 0 };
+
+	// tokens are parsed in a single pass: the initial capacity is an estimate (compact glTF JSON averages 7-8 bytes per token),
+	// and when it runs out jsmn stops with JSMN_ERROR_NOMEM and resumes where it left off once the array has grown;
+	// the estimate is capped because .gltf files with data: URIs are mostly a few long string tokens
+	cgltf_size token_capacity = size / 8 + 64;
+	if (token_capacity > CGLTF_JSON_TOKEN_ESTIMATE_MAX)
+		token_capacity = CGLTF_JSON_TOKEN_ESTIMATE_MAX;
+	if (options->json_token_count)
+		token_capacity = options->json_token_count;
+
+	jsmntok_t* tokens = (jsmntok_t*)options->memory.alloc(options->memory.user_data, sizeof(jsmntok_t) * (token_capacity + 1));
 
 	if (!tokens)
 	{
@@ -5894,7 +7387,27 @@ cgltf_result cgltf_parse_json(cgltf_options* options, const uint8_t* json_chunk,
 
 	jsmn_init(&parser);
 
-	int token_count = jsmn_parse(&parser, (const char*)json_chunk, size, tokens, options->json_token_count);
+	int token_count = jsmn_parse(&parser, (const char*)json_chunk, size, tokens, token_capacity);
+
+	while (token_count == JSMN_ERROR_NOMEM)
+	{
+		cgltf_size new_capacity = token_capacity * 2;
+		jsmntok_t* new_tokens = (jsmntok_t*)options->memory.alloc(options->memory.user_data, sizeof(jsmntok_t) * (new_capacity + 1));
+
+		if (!new_tokens)
+		{
+			options->memory.free(options->memory.user_data, tokens);
+			return cgltf_result_out_of_memory;
+		}
+
+		memcpy(new_tokens, tokens, sizeof(jsmntok_t) * token_capacity);
+		options->memory.free(options->memory.user_data, tokens);
+
+		tokens = new_tokens;
+		token_capacity = new_capacity;
+
+		token_count = jsmn_parse(&parser, (const char*)json_chunk, size, tokens, token_capacity);
+	}
 
 	if (token_count <= 0)
 	{
@@ -5905,6 +7418,13 @@ cgltf_result cgltf_parse_json(cgltf_options* options, const uint8_t* json_chunk,
 	// this makes sure that we always have an UNDEFINED token at the end of the stream
 	// for invalid JSON inputs this makes sure we don't perform out of bound reads of token data
 	tokens[token_count].type = JSMN_UNDEFINED;
+	tokens[token_count].key = cgltf_json_key_unknown;
+
+	// every string is matched against the known keys once, so the object parsers dispatch on integer ids instead of comparing strings
+	for (int k = 0; k < token_count; ++k)
+	{
+		tokens[k].key = tokens[k].type == JSMN_STRING ? cgltf_json_lookup_key(json_chunk + tokens[k].start, tokens[k].end - tokens[k].start) : cgltf_json_key_unknown;
+	}
 
 	cgltf_data* data = (cgltf_data*)options->memory.alloc(options->memory.user_data, sizeof(cgltf_data));
 
@@ -5924,7 +7444,11 @@ cgltf_result cgltf_parse_json(cgltf_options* options, const uint8_t* json_chunk,
 
 	if (i < 0)
 	{
-		cgltf_free(data);
+		// an arena is released as a whole by cgltf_parse_json
+		if (!cgltf_arena_of(&data->memory))
+		{
+			cgltf_free(data);
+		}
 
 		switch (i)
 		{
@@ -5936,7 +7460,11 @@ cgltf_result cgltf_parse_json(cgltf_options* options, const uint8_t* json_chunk,
 
 	if (cgltf_fixup_pointers(data) < 0)
 	{
-		cgltf_free(data);
+		// an arena is released as a whole by cgltf_parse_json
+		if (!cgltf_arena_of(&data->memory))
+		{
+			cgltf_free(data);
+		}
 		return cgltf_result_invalid_gltf;
 	}
 
@@ -6139,6 +7667,77 @@ static int cgltf_fixup_pointers(cgltf_data* data)
  * THE SOFTWARE.
  */
 
+/*
+ * Structural scanning: strings and whitespace runs are skipped 16 bytes at a
+ * time while a block holds nothing the parser has to look at; the scalar
+ * loops below handle the remaining bytes, so results are identical.
+ */
+
+/**
+ * Skips blocks of string contents without quotes, backslashes and NUL bytes.
+ */
+static size_t jsmn_skip_string(const char *js, size_t pos, size_t len) {
+#if defined(CGLTF_SIMD_SSE2)
+	const __m128i quote = _mm_set1_epi8('\"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	const __m128i zero = _mm_setzero_si128();
+	for (; pos + 16 <= len; pos += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(js + pos));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)), _mm_cmpeq_epi8(v, zero));
+		if (_mm_movemask_epi8(m) != 0)
+			break;
+	}
+#elif defined(CGLTF_SIMD_NEON)
+	const uint8x16_t quote = vdupq_n_u8('\"');
+	const uint8x16_t backslash = vdupq_n_u8('\\');
+	const uint8x16_t zero = vdupq_n_u8(0);
+	for (; pos + 16 <= len; pos += 16) {
+		uint8x16_t v = vld1q_u8((const uint8_t *)(js + pos));
+		uint64x2_t m = vreinterpretq_u64_u8(vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)), vceqq_u8(v, zero)));
+		if ((vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0)
+			break;
+	}
+#else
+	(void)js;
+	(void)len;
+#endif
+	return pos;
+}
+
+/**
+ * Skips blocks that only contain JSON whitespace.
+ */
+static size_t jsmn_skip_whitespace(const char *js, size_t pos, size_t len) {
+#if defined(CGLTF_SIMD_SSE2)
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i tab = _mm_set1_epi8('\t');
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i lf = _mm_set1_epi8('\n');
+	for (; pos + 16 <= len; pos += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(js + pos));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)), _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+		if (_mm_movemask_epi8(m) != 0xffff)
+			break;
+	}
+#elif defined(CGLTF_SIMD_NEON)
+	const uint8x16_t space = vdupq_n_u8(' ');
+	const uint8x16_t tab = vdupq_n_u8('\t');
+	const uint8x16_t cr = vdupq_n_u8('\r');
+	const uint8x16_t lf = vdupq_n_u8('\n');
+	for (; pos + 16 <= len; pos += 16) {
+		uint8x16_t v = vld1q_u8((const uint8_t *)(js + pos));
+		uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, space), vceqq_u8(v, tab)), vorrq_u8(vceqq_u8(v, cr), vceqq_u8(v, lf)));
+		uint64x2_t n = vreinterpretq_u64_u8(vmvnq_u8(m));
+		if ((vgetq_lane_u64(n, 0) | vgetq_lane_u64(n, 1)) != 0)
+			break;
+	}
+#else
+	(void)js;
+	(void)len;
+#endif
+	return pos;
+}
+
 /**
  * Allocates a fresh unused token from the token pull.
  */
@@ -6228,7 +7827,9 @@ static int jsmn_parse_string(jsmn_parser *parser, const char *js,
 
 	parser->pos++;
 
-	/* Skip starting quote */
+	/* Skip starting quote, and long runs of plain characters after it */
+	parser->pos = (unsigned int)jsmn_skip_string(js, parser->pos, len);
+
 	for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
 		char c = js[parser->pos];
 
@@ -6375,6 +7976,8 @@ static int jsmn_parse(jsmn_parser *parser, const char *js, size_t len,
 				tokens[parser->toksuper].size++;
 			break;
 		case '\t' : case '\r' : case '\n' : case ' ':
+			/* Leaves pos on the last byte of the run */
+			parser->pos = (unsigned int)jsmn_skip_whitespace(js, parser->pos + 1, len) - 1;
 			break;
 		case ':':
 			parser->toksuper = parser->toknext - 1;
@@ -24,6 +24,22 @@
  * terminator. If buffer is null, returns the number of bytes that would have
  * been written. `data` is not deallocated.
  *
+ * `cgltf_result cgltf_write_json(const cgltf_options* options, const
+ * cgltf_data* data, char** out_json, cgltf_size* out_size)` writes JSON in a
+ * single pass into a buffer that grows as needed, allocated through
+ * `options->memory`. The size excludes the null terminator that follows the
+ * JSON. Release the buffer with `cgltf_write_free_json`. The functions above
+ * are built on it.
+ *
+ * With `write_compact` set in the options, no line breaks, indentation or
+ * spaces are written.
+ *
+ * Floats are written with the fewest digits that read back as the same value.
+ *
+ * Top-level extensions that cgltf does not parse (`data_extensions`) are
+ * written back as JSON text. Indices inside them are not updated, so code
+ * that removes or reorders objects must drop such extensions first.
+ *
  * To write custom JSON into the `extras` field, aggregate all the custom JSON
  * into a single buffer, then set `file_data` to this buffer. By supplying
  * start_offset and end_offset values for various objects, you can select a
@@ -43,6 +59,8 @@ extern "C" {
 
 cgltf_result cgltf_write_file(const cgltf_options* options, const char* path, const cgltf_data* data);
 cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size size, const cgltf_data* data);
+cgltf_result cgltf_write_json(const cgltf_options* options, const cgltf_data* data, char** out_json, cgltf_size* out_size);
+void cgltf_write_free_json(const cgltf_options* options, char* json);
 
 #ifdef __cplusplus
 }
@@ -82,58 +100,449 @@ cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size si
 
 typedef struct {
 	char* buffer;
-	cgltf_size buffer_size;
-	cgltf_size remaining;
-	char* cursor;
-	cgltf_size tmp;
-	cgltf_size chars_written;
+	cgltf_size size;
+	cgltf_size capacity;
+	cgltf_memory_options memory;
+	int failed;
 	const cgltf_data* data;
 	int depth;
 	const char* indent;
+	int compact;
 	int needs_comma;
 	uint32_t extension_flags;
 	uint32_t required_extension_flags;
 } cgltf_write_context;
 
-#define CGLTF_MIN(a, b) (a < b ? a : b)
+static void* cgltf_write_default_alloc(void* user, cgltf_size size)
+{
+	(void)user;
+	return malloc(size);
+}
 
-#ifdef FLT_DECIMAL_DIG
-	// FLT_DECIMAL_DIG is C11
-	#define CGLTF_DECIMAL_DIG (FLT_DECIMAL_DIG)
-#else
-	#define CGLTF_DECIMAL_DIG 9
-#endif
+static void cgltf_write_default_free(void* user, void* ptr)
+{
+	(void)user;
+	free(ptr);
+}
+
+static int cgltf_write_reserve(cgltf_write_context* context, cgltf_size count)
+{
+	if (context->size + count <= context->capacity)
+	{
+		return 1;
+	}
+	if (context->failed)
+	{
+		return 0;
+	}
+
+	cgltf_size capacity = context->capacity ? context->capacity * 2 : 4096;
+	while (capacity < context->size + count)
+	{
+		capacity *= 2;
+	}
+
+	char* buffer = (char*)context->memory.alloc(context->memory.user_data, capacity);
+	if (!buffer)
+	{
+		context->failed = 1;
+		return 0;
+	}
+
+	if (context->buffer)
+	{
+		memcpy(buffer, context->buffer, context->size);
+		context->memory.free(context->memory.user_data, context->buffer);
+	}
+
+	context->buffer = buffer;
+	context->capacity = capacity;
+	return 1;
+}
+
+static void cgltf_write_chars(cgltf_write_context* context, const char* chars, cgltf_size count)
+{
+	if (cgltf_write_reserve(context, count))
+	{
+		memcpy(context->buffer + context->size, chars, count);
+		context->size += count;
+	}
+}
+
+#define CGLTF_WRITE_LITERAL(literal) cgltf_write_chars(context, literal, sizeof(literal) - 1)
+
+static void cgltf_write_string(cgltf_write_context* context, const char* str)
+{
+	cgltf_write_chars(context, str, strlen(str));
+}
+
+static void cgltf_write_int(cgltf_write_context* context, int value)
+{
+	char digits[12];
+	int count = 0;
+	unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+	do
+	{
+		digits[sizeof(digits) - 1 - count++] = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude);
+	if (value < 0)
+	{
+		digits[sizeof(digits) - 1 - count++] = '-';
+	}
+	cgltf_write_chars(context, digits + sizeof(digits) - count, count);
+}
+
+/* Shortest round-trip float formatting, after Ulf Adams' Ryu (f2s). The
+ * tables hold 5^-i and 5^i scaled to 59 and 61 significant bits, which keeps
+ * every product within 64-bit arithmetic. */
+#define CGLTF_WRITE_POW5_INV_BITCOUNT 59
+#define CGLTF_WRITE_POW5_BITCOUNT 61
+
+static const uint64_t cgltf_write_pow5_inv_split[31] = {
+	576460752303423489u, 461168601842738791u, 368934881474191033u, 295147905179352826u,
+	472236648286964522u, 377789318629571618u, 302231454903657294u, 483570327845851670u,
+	386856262276681336u, 309485009821345069u, 495176015714152110u, 396140812571321688u,
+	316912650057057351u, 507060240091291761u, 405648192073033409u, 324518553658426727u,
+	519229685853482763u, 415383748682786211u, 332306998946228969u, 531691198313966350u,
+	425352958651173080u, 340282366920938464u, 544451787073501542u, 435561429658801234u,
+	348449143727040987u, 557518629963265579u, 446014903970612463u, 356811923176489971u,
+	570899077082383953u, 456719261665907162u, 365375409332725730u
+};
+
+static const uint64_t cgltf_write_pow5_split[47] = {
+	1152921504606846976u, 1441151880758558720u, 1801439850948198400u, 2251799813685248000u,
+	1407374883553280000u, 1759218604441600000u, 2199023255552000000u, 1374389534720000000u,
+	1717986918400000000u, 2147483648000000000u, 1342177280000000000u, 1677721600000000000u,
+	2097152000000000000u, 1310720000000000000u, 1638400000000000000u, 2048000000000000000u,
+	1280000000000000000u, 1600000000000000000u, 2000000000000000000u, 1250000000000000000u,
+	1562500000000000000u, 1953125000000000000u, 1220703125000000000u, 1525878906250000000u,
+	1907348632812500000u, 1192092895507812500u, 1490116119384765625u, 1862645149230957031u,
+	1164153218269348144u, 1455191522836685180u, 1818989403545856475u, 2273736754432320594u,
+	1421085471520200371u, 1776356839400250464u, 2220446049250313080u, 1387778780781445675u,
+	1734723475976807094u, 2168404344971008868u, 1355252715606880542u, 1694065894508600678u,
+	2117582368135750847u, 1323488980084844279u, 1654361225106055349u, 2067951531382569187u,
+	1292469707114105741u, 1615587133892632177u, 2019483917365790221u
+};
+
+static int cgltf_write_pow5bits(int e)
+{
+	return (int)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+static int cgltf_write_log10_pow2(int e)
+{
+	return (int)(((uint32_t)e * 78913) >> 18);
+}
+
+static int cgltf_write_log10_pow5(int e)
+{
+	return (int)(((uint32_t)e * 732923) >> 20);
+}
+
+static int cgltf_write_multiple_of_pow5(uint32_t value, int p)
+{
+	int count = 0;
+	while (value % 5 == 0)
+	{
+		value /= 5;
+		++count;
+	}
+	return count >= p;
+}
+
+static int cgltf_write_multiple_of_pow2(uint32_t value, int p)
+{
+	return (value & ((1u << p) - 1)) == 0;
+}
+
+static uint32_t cgltf_write_mul_shift(uint32_t m, uint64_t factor, int shift)
+{
+	uint64_t bits0 = (uint64_t)m * (uint32_t)factor;
+	uint64_t bits1 = (uint64_t)m * (uint32_t)(factor >> 32);
+	uint64_t sum = (bits0 >> 32) + bits1;
+	return (uint32_t)(sum >> (shift - 32));
+}
+
+/* Finds the shortest digits * 10^exponent that reads back as the float with
+ * the given mantissa and biased exponent bits. */
+static void cgltf_write_shortest(uint32_t ieee_mantissa, uint32_t ieee_exponent, uint32_t* out_digits, int* out_exponent)
+{
+	int e2;
+	uint32_t m2;
+	if (ieee_exponent == 0)
+	{
+		e2 = 1 - 127 - 23 - 2;
+		m2 = ieee_mantissa;
+	}
+	else
+	{
+		e2 = (int)ieee_exponent - 127 - 23 - 2;
+		m2 = (1u << 23) | ieee_mantissa;
+	}
+
+	// bounds halfway to the neighbouring floats are included when the mantissa is even
+	int accept_bounds = (m2 & 1) == 0;
+	uint32_t mv = 4 * m2;
+	uint32_t mp = 4 * m2 + 2;
+	uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+	uint32_t mm = 4 * m2 - 1 - mm_shift;
+
+	uint32_t vr, vp, vm;
+	int e10;
+	int vm_trailing_zeros = 0;
+	int vr_trailing_zeros = 0;
+	uint32_t last_removed_digit = 0;
+
+	if (e2 >= 0)
+	{
+		int q = cgltf_write_log10_pow2(e2);
+		e10 = q;
+		int k = CGLTF_WRITE_POW5_INV_BITCOUNT + cgltf_write_pow5bits(q) - 1;
+		int i = -e2 + q + k;
+		vr = cgltf_write_mul_shift(mv, cgltf_write_pow5_inv_split[q], i);
+		vp = cgltf_write_mul_shift(mp, cgltf_write_pow5_inv_split[q], i);
+		vm = cgltf_write_mul_shift(mm, cgltf_write_pow5_inv_split[q], i);
+		if (q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			// the loop below removes at most one digit, so compute it here
+			int l = CGLTF_WRITE_POW5_INV_BITCOUNT + cgltf_write_pow5bits(q - 1) - 1;
+			last_removed_digit = cgltf_write_mul_shift(mv, cgltf_write_pow5_inv_split[q - 1], -e2 + q - 1 + l) % 10;
+		}
+		if (q <= 9)
+		{
+			if (mv % 5 == 0)
+			{
+				vr_trailing_zeros = cgltf_write_multiple_of_pow5(mv, q);
+			}
+			else if (accept_bounds)
+			{
+				vm_trailing_zeros = cgltf_write_multiple_of_pow5(mm, q);
+			}
+			else
+			{
+				vp -= cgltf_write_multiple_of_pow5(mp, q);
+			}
+		}
+	}
+	else
+	{
+		int q = cgltf_write_log10_pow5(-e2);
+		e10 = q + e2;
+		int i = -e2 - q;
+		int k = cgltf_write_pow5bits(i) - CGLTF_WRITE_POW5_BITCOUNT;
+		int j = q - k;
+		vr = cgltf_write_mul_shift(mv, cgltf_write_pow5_split[i], j);
+		vp = cgltf_write_mul_shift(mp, cgltf_write_pow5_split[i], j);
+		vm = cgltf_write_mul_shift(mm, cgltf_write_pow5_split[i], j);
+		if (q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			j = q - 1 - (cgltf_write_pow5bits(i + 1) - CGLTF_WRITE_POW5_BITCOUNT);
+			last_removed_digit = cgltf_write_mul_shift(mv, cgltf_write_pow5_split[i + 1], j) % 10;
+		}
+		if (q <= 1)
+		{
+			vr_trailing_zeros = 1;
+			if (accept_bounds)
+			{
+				vm_trailing_zeros = mm_shift == 1;
+			}
+			else
+			{
+				--vp;
+			}
+		}
+		else if (q < 31)
+		{
+			vr_trailing_zeros = cgltf_write_multiple_of_pow2(mv, q - 1);
+		}
+	}
+
+	int removed = 0;
+	uint32_t output;
+	if (vm_trailing_zeros || vr_trailing_zeros)
+	{
+		while (vp / 10 > vm / 10)
+		{
+			vm_trailing_zeros &= vm % 10 == 0;
+			vr_trailing_zeros &= last_removed_digit == 0;
+			last_removed_digit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			++removed;
+		}
+		if (vm_trailing_zeros)
+		{
+			while (vm % 10 == 0)
+			{
+				vr_trailing_zeros &= last_removed_digit == 0;
+				last_removed_digit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				++removed;
+			}
+		}
+		if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+		{
+			// exactly halfway, round to even
+			last_removed_digit = 4;
+		}
+		output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+	}
+	else
+	{
+		while (vp / 10 > vm / 10)
+		{
+			last_removed_digit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			++removed;
+		}
+		output = vr + (vr == vm || last_removed_digit >= 5);
+	}
+
+	*out_digits = output;
+	*out_exponent = e10 + removed;
+}
+
+static void cgltf_write_float(cgltf_write_context* context, float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t ieee_mantissa = bits & ((1u << 23) - 1);
+	uint32_t ieee_exponent = (bits >> 23) & 0xff;
+
+	char text[32];
+	int length = 0;
+	if (bits >> 31)
+	{
+		text[length++] = '-';
+	}
+
+	if (ieee_exponent == 0xff)
+	{
+		// not representable in JSON; matches what printf used to produce
+		cgltf_write_chars(context, text, length);
+		cgltf_write_string(context, ieee_mantissa ? "nan" : "inf");
+		return;
+	}
+	if (ieee_exponent == 0 && ieee_mantissa == 0)
+	{
+		text[length++] = '0';
+		cgltf_write_chars(context, text, length);
+		return;
+	}
+
+	uint32_t digits;
+	int exponent;
+	cgltf_write_shortest(ieee_mantissa, ieee_exponent, &digits, &exponent);
+
+	char significand[10];
+	int count = 0;
+	do
+	{
+		significand[sizeof(significand) - 1 - count++] = (char)('0' + digits % 10);
+		digits /= 10;
+	} while (digits);
+	const char* first = significand + sizeof(significand) - count;
+
+	// the value is 0.<first> * 10^point; pick whichever notation is shorter
+	int point = count + exponent;
+	int positional_length = point >= count ? point : point > 0 ? count + 1 : count + 2 - point;
+	int scientific_exponent = point - 1;
+	int magnitude = scientific_exponent < 0 ? -scientific_exponent : scientific_exponent;
+	int scientific_length = count + (count > 1) + 1 + (scientific_exponent < 0) + (magnitude >= 10 ? 2 : 1);
+
+	if (positional_length <= scientific_length)
+	{
+		if (point >= count)
+		{
+			memcpy(text + length, first, count);
+			length += count;
+			for (int i = count; i < point; ++i)
+			{
+				text[length++] = '0';
+			}
+		}
+		else if (point > 0)
+		{
+			memcpy(text + length, first, point);
+			length += point;
+			text[length++] = '.';
+			memcpy(text + length, first + point, count - point);
+			length += count - point;
+		}
+		else
+		{
+			text[length++] = '0';
+			text[length++] = '.';
+			for (int i = point; i < 0; ++i)
+			{
+				text[length++] = '0';
+			}
+			memcpy(text + length, first, count);
+			length += count;
+		}
+	}
+	else
+	{
+		text[length++] = first[0];
+		if (count > 1)
+		{
+			text[length++] = '.';
+			memcpy(text + length, first + 1, count - 1);
+			length += count - 1;
+		}
+		text[length++] = 'e';
+		if (scientific_exponent < 0)
+		{
+			text[length++] = '-';
+		}
+		if (magnitude >= 10)
+		{
+			text[length++] = (char)('0' + magnitude / 10);
+		}
+		text[length++] = (char)('0' + magnitude % 10);
+	}
+
+	cgltf_write_chars(context, text, length);
+}
 
-#define CGLTF_SPRINTF(...) { \
-		context->tmp = snprintf ( context->cursor, context->remaining, __VA_ARGS__ ); \
-		context->chars_written += context->tmp; \
-		if (context->cursor) { \
-			context->cursor += context->tmp; \
-			context->remaining -= context->tmp; \
-		} }
-
-#define CGLTF_SNPRINTF(length, ...) { \
-		context->tmp = snprintf ( context->cursor, CGLTF_MIN(length + 1, context->remaining), __VA_ARGS__ ); \
-		context->chars_written += length; \
-		if (context->cursor) { \
-			context->cursor += length; \
-			context->remaining -= length; \
-		} }
+static void cgltf_write_label(cgltf_write_context* context, const char* label)
+{
+	CGLTF_WRITE_LITERAL("\"");
+	cgltf_write_string(context, label);
+	if (context->compact)
+	{
+		CGLTF_WRITE_LITERAL("\":");
+	}
+	else
+	{
+		CGLTF_WRITE_LITERAL("\": ");
+	}
+}
 
 #define CGLTF_WRITE_IDXPROP(label, val, start) if (val) { \
 		cgltf_write_indent(context); \
-		CGLTF_SPRINTF("\"%s\": %d", label, (int) (val - start)); \
+		cgltf_write_label(context, label); \
+		cgltf_write_int(context, (int) (val - start)); \
 		context->needs_comma = 1; }
 
 #define CGLTF_WRITE_IDXARRPROP(label, dim, vals, start) if (vals) { \
 		cgltf_write_indent(context); \
-		CGLTF_SPRINTF("\"%s\": [", label); \
+		cgltf_write_label(context, label); \
+		CGLTF_WRITE_LITERAL("["); \
 		for (int i = 0; i < (int)(dim); ++i) { \
 			int idx = (int) (vals[i] - start); \
-			if (i != 0) CGLTF_SPRINTF(","); \
-			CGLTF_SPRINTF(" %d", idx); \
+			if (i != 0) CGLTF_WRITE_LITERAL(","); \
+			if (!context->compact) CGLTF_WRITE_LITERAL(" "); \
+			cgltf_write_int(context, idx); \
 		} \
-		CGLTF_SPRINTF(" ]"); \
+		if (!context->compact) CGLTF_WRITE_LITERAL(" "); \
+		CGLTF_WRITE_LITERAL("]"); \
 		context->needs_comma = 1; }
 
 #define CGLTF_WRITE_TEXTURE_INFO(label, info) if (info.texture) { \
@@ -152,16 +561,17 @@ static void cgltf_write_indent(cgltf_write_context* context)
 {
 	if (context->needs_comma)
 	{
-		CGLTF_SPRINTF(",\n");
+		CGLTF_WRITE_LITERAL(",");
 		context->needs_comma = 0;
 	}
-	else
+	if (context->compact)
 	{
-		CGLTF_SPRINTF("\n");
+		return;
 	}
+	CGLTF_WRITE_LITERAL("\n");
 	for (int i = 0; i < context->depth; ++i)
 	{
-		CGLTF_SPRINTF("%s", context->indent);
+		cgltf_write_string(context, context->indent);
 	}
 }
 
@@ -173,8 +583,23 @@ static void cgltf_write_line(cgltf_write_context* context, const char* line)
 		context->needs_comma = 0;
 	}
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("%s", line);
-	cgltf_size last = (cgltf_size)(strlen(line) - 1);
+	cgltf_size length = (cgltf_size)strlen(line);
+	if (context->compact)
+	{
+		// lines are literals whose only spaces follow the key
+		for (cgltf_size i = 0; i < length; ++i)
+		{
+			if (line[i] != ' ')
+			{
+				cgltf_write_chars(context, line + i, 1);
+			}
+		}
+	}
+	else
+	{
+		cgltf_write_chars(context, line, length);
+	}
+	cgltf_size last = length - 1;
 	if (line[0] == ']' || line[0] == '}')
 	{
 		context->needs_comma = 1;
@@ -191,28 +616,89 @@ static void cgltf_write_strprop(cgltf_write_context* context, const char* label,
 	if (val)
 	{
 		cgltf_write_indent(context);
-		CGLTF_SPRINTF("\"%s\": \"%s\"", label, val);
+		cgltf_write_label(context, label);
+		CGLTF_WRITE_LITERAL("\"");
+		cgltf_write_string(context, val);
+		CGLTF_WRITE_LITERAL("\"");
 		context->needs_comma = 1;
 	}
 }
 
+static void cgltf_write_json_text(cgltf_write_context* context, const char* text, cgltf_size length)
+{
+	if (!context->compact)
+	{
+		cgltf_write_chars(context, text, length);
+		return;
+	}
+	if (!cgltf_write_reserve(context, length))
+	{
+		return;
+	}
+
+	// drop whitespace outside of strings
+	char* out = context->buffer + context->size;
+	int in_string = 0;
+	for (cgltf_size i = 0; i < length; ++i)
+	{
+		char c = text[i];
+		if (in_string)
+		{
+			if (c == '\\' && i + 1 < length)
+			{
+				*out++ = c;
+				c = text[++i];
+			}
+			else if (c == '"')
+			{
+				in_string = 0;
+			}
+		}
+		else if (c == '"')
+		{
+			in_string = 1;
+		}
+		else if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+		{
+			continue;
+		}
+		*out++ = c;
+	}
+	context->size = (cgltf_size)(out - context->buffer);
+}
+
 static void cgltf_write_extras(cgltf_write_context* context, const cgltf_extras* extras)
 {
 	cgltf_size length = extras->end_offset - extras->start_offset;
 	if (length > 0 && context->data->json)
 	{
-		char* json_string = ((char*) context->data->json) + extras->start_offset;
+		const char* json_string = context->data->json + extras->start_offset;
 		cgltf_write_indent(context);
-		CGLTF_SPRINTF("%s", "\"extras\": ");
-		CGLTF_SNPRINTF(length, "%s", json_string);
+		cgltf_write_label(context, "extras");
+		cgltf_write_json_text(context, json_string, length);
 		context->needs_comma = 1;
 	}
 }
 
+static int cgltf_write_span(cgltf_write_context* context, const char* label, const cgltf_json_span* span)
+{
+	if (span->dirty || span->end_offset <= span->start_offset || !context->data->json)
+	{
+		return 0;
+	}
+	cgltf_write_indent(context);
+	cgltf_write_label(context, label);
+	cgltf_write_json_text(context, context->data->json + span->start_offset, span->end_offset - span->start_offset);
+	context->needs_comma = 1;
+	return 1;
+}
+
 static void cgltf_write_stritem(cgltf_write_context* context, const char* item)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\"", item);
+	CGLTF_WRITE_LITERAL("\"");
+	cgltf_write_string(context, item);
+	CGLTF_WRITE_LITERAL("\"");
 	context->needs_comma = 1;
 }
 
@@ -221,7 +707,8 @@ static void cgltf_write_intprop(cgltf_write_context* context, const char* label,
 	if (val != def)
 	{
 		cgltf_write_indent(context);
-		CGLTF_SPRINTF("\"%s\": %d", label, val);
+		cgltf_write_label(context, label);
+		cgltf_write_int(context, val);
 		context->needs_comma = 1;
 	}
 }
@@ -231,18 +718,9 @@ static void cgltf_write_floatprop(cgltf_write_context* context, const char* labe
 	if (val != def)
 	{
 		cgltf_write_indent(context);
-		CGLTF_SPRINTF("\"%s\": ", label);
-		CGLTF_SPRINTF("%.*g", CGLTF_DECIMAL_DIG, val);
+		cgltf_write_label(context, label);
+		cgltf_write_float(context, val);
 		context->needs_comma = 1;
-
-		if (context->cursor)
-		{
-			char *decimal_comma = strchr(context->cursor - context->tmp, ',');
-			if (decimal_comma)
-			{
-				*decimal_comma = '.';
-			}
-		}
 	}
 }
 
@@ -251,7 +729,8 @@ static void cgltf_write_boolprop_optional(cgltf_write_context* context, const ch
 	if (val != def)
 	{
 		cgltf_write_indent(context);
-		CGLTF_SPRINTF("\"%s\": %s", label, val ? "true" : "false");
+		cgltf_write_label(context, label);
+		cgltf_write_string(context, val ? "true" : "false");
 		context->needs_comma = 1;
 	}
 }
@@ -259,69 +738,70 @@ static void cgltf_write_boolprop_optional(cgltf_write_context* context, const ch
 static void cgltf_write_intprop_strict(cgltf_write_context* context, const char* label, int val)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\": %d", label, val);
+	cgltf_write_label(context, label);
+	cgltf_write_int(context, val);
 	context->needs_comma = 1;
 }
 
 static void cgltf_write_floatprop_strict(cgltf_write_context* context, const char* label, float val)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\": ", label);
-	CGLTF_SPRINTF("%g", val);
+	cgltf_write_label(context, label);
+	cgltf_write_float(context, val);
 	context->needs_comma = 1;
-
-	if (context->cursor)
-	{
-		char *decimal_comma = strchr(context->cursor - context->tmp, ',');
-		if (decimal_comma)
-		{
-			*decimal_comma = '.';
-		}
-	}
 }
 
 static void cgltf_write_boolprop_strict(cgltf_write_context* context, const char* label, bool val)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\": %s", label, val ? "true" : "false");
+	cgltf_write_label(context, label);
+	cgltf_write_string(context, val ? "true" : "false");
 	context->needs_comma = 1;
 }
 
+static void cgltf_write_separator(cgltf_write_context* context)
+{
+	if (context->compact)
+	{
+		CGLTF_WRITE_LITERAL(",");
+	}
+	else
+	{
+		CGLTF_WRITE_LITERAL(", ");
+	}
+}
+
 static void cgltf_write_intarrayprop(cgltf_write_context* context, const char* label, const cgltf_int* vals, cgltf_size dim)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\": [", label);
+	cgltf_write_label(context, label);
+	CGLTF_WRITE_LITERAL("[");
 	for (cgltf_size i = 0; i < dim; ++i)
 	{
 		if (i != 0)
 		{
-			CGLTF_SPRINTF(", %d", vals[i]);
-		}
-		else
-		{
-			CGLTF_SPRINTF("%d", vals[i]);
+			cgltf_write_separator(context);
 		}
+		cgltf_write_int(context, vals[i]);
 	}
-	CGLTF_SPRINTF("]");
+	CGLTF_WRITE_LITERAL("]");
 	context->needs_comma = 1;
 }
 
 static void cgltf_write_floatarrayprop(cgltf_write_context* context, const char* label, const cgltf_float* vals, cgltf_size dim)
 {
 	cgltf_write_indent(context);
-	CGLTF_SPRINTF("\"%s\": [", label);
+	cgltf_write_label(context, label);
+	CGLTF_WRITE_LITERAL("[");
 	for (cgltf_size i = 0; i < dim; ++i)
 	{
 		if (i != 0)
 		{
-			CGLTF_SPRINTF(", %.*g", CGLTF_DECIMAL_DIG, vals[i]);
-		}
-		else
-		{
-			CGLTF_SPRINTF("%.*g", CGLTF_DECIMAL_DIG, vals[i]);
+			cgltf_write_separator(context);
 		}
+		cgltf_write_float(context, vals[i]);
 	}
-	CGLTF_SPRINTF("]");
+	CGLTF_WRITE_LITERAL("]");
 	context->needs_comma = 1;
 }
 
@@ -981,37 +1461,37 @@ static void cgltf_write_light(cgltf_write_context* context, const cgltf_light* l
 	cgltf_write_line(context, "}");
 }
 
-cgltf_result cgltf_write_json(const cgltf_options* options, const char* path, const cgltf_data* data)
+cgltf_result cgltf_write_file(const cgltf_options* options, const char* path, const cgltf_data* data)
 {
-	(void)options;
+	char* json = NULL;
+	cgltf_size size = 0;
+	cgltf_result result = cgltf_write_json(options, data, &json, &size);
+	if (result != cgltf_result_success)
+	{
+		return result;
+	}
 	FILE* file = fopen(path, "wt");
 	if (!file)
 	{
+		cgltf_write_free_json(options, json);
 		return cgltf_result_file_not_found;
 	}
-	fwrite(data->json, data->json_size, 1, file);
+	fwrite(json, size, 1, file);
 	fclose(file);
+	cgltf_write_free_json(options, json);
 	return cgltf_result_success;
 }
 
-cgltf_result cgltf_write_file(const cgltf_options* options, const char* path, const cgltf_data* data)
+static int cgltf_is_required_extension(const cgltf_data* data, const char* name)
 {
-	cgltf_size expected = cgltf_write(options, NULL, 0, data);
-	char* buffer = (char*) malloc(expected);
-	cgltf_size actual = cgltf_write(options, buffer, expected, data);
-	if (expected != actual) {
-		fprintf(stderr, "Error: expected %zu bytes but wrote %zu bytes.\n", expected, actual);
-	}
-	FILE* file = fopen(path, "wt");
-	if (!file)
+	for (cgltf_size i = 0; i < data->extensions_required_count; ++i)
 	{
-		return cgltf_result_file_not_found;
+		if (strcmp(data->extensions_required[i], name) == 0)
+		{
+			return 1;
+		}
 	}
-	// Note that cgltf_write() includes a null terminator, which we omit from the file content.
-	fwrite(buffer, actual - 1, 1, file);
-	fclose(file);
-	free(buffer);
-	return cgltf_result_success;
+	return 0;
 }
 
 static void cgltf_write_extensions(cgltf_write_context* context, uint32_t extension_flags)
@@ -1052,25 +1532,11 @@ static void cgltf_write_extensions(cgltf_write_context* context, uint32_t extens
 #include "vrm/vrm_write.v0_0.inl"
 #endif
 
-cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size size, const cgltf_data* data)
+static void cgltf_write_document(cgltf_write_context* context)
 {
-	(void)options;
-	cgltf_write_context ctx;
-	ctx.buffer = buffer;
-	ctx.buffer_size = size;
-	ctx.remaining = size;
-	ctx.cursor = buffer;
-	ctx.chars_written = 0;
-	ctx.data = data;
-	ctx.depth = 1;
-	ctx.indent = "  ";
-	ctx.needs_comma = 0;
-	ctx.extension_flags = 0;
-	ctx.required_extension_flags = 0;
+	const cgltf_data* data = context->data;
 
-	cgltf_write_context* context = &ctx;
-
-	CGLTF_SPRINTF("{");
+	CGLTF_WRITE_LITERAL("{");
 
 	if (data->accessors_count > 0)
 	{
@@ -1222,18 +1688,31 @@ cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size si
 		cgltf_write_line(context, "}");
 	}
 
-	if (context->data->has_vrm_v0_0 || context->extension_flags != 0) {
+	if (context->data->has_vrm_v0_0 || context->extension_flags != 0 || data->data_extensions_count > 0) {
 		cgltf_write_line(context, "\"extensionsUsed\": [");
 		cgltf_write_extensions(context, context->extension_flags);
 		if (context->data->has_vrm_v0_0) {
 			cgltf_write_stritem(context, "VRM");
 		}
+		for (cgltf_size i = 0; i < data->data_extensions_count; ++i) {
+			cgltf_write_stritem(context, data->data_extensions[i].name);
+		}
 		cgltf_write_line(context, "]");
 	}
 
-	if (context->required_extension_flags != 0) {
+	int required_data_extensions = 0;
+	for (cgltf_size i = 0; i < data->data_extensions_count; ++i) {
+		required_data_extensions += cgltf_is_required_extension(data, data->data_extensions[i].name);
+	}
+
+	if (context->required_extension_flags != 0 || required_data_extensions > 0) {
 		cgltf_write_line(context, "\"extensionsRequired\": [");
 		cgltf_write_extensions(context, context->required_extension_flags);
+		for (cgltf_size i = 0; i < data->data_extensions_count; ++i) {
+			if (cgltf_is_required_extension(data, data->data_extensions[i].name)) {
+				cgltf_write_stritem(context, data->data_extensions[i].name);
+			}
+		}
 		cgltf_write_line(context, "]");
 	}
 
@@ -1242,15 +1721,102 @@ cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size si
 		cgltf_write_line(context, "\"VRM\": ");
 		cgltf_write_vrm_v0_0(context, &context->data->vrm_v0_0);
 	}
+	// extensions that cgltf does not parse were kept as JSON text
+	for (cgltf_size i = 0; i < data->data_extensions_count; ++i) {
+		const cgltf_extension* extension = &data->data_extensions[i];
+		cgltf_write_indent(context);
+		cgltf_write_label(context, extension->name);
+		cgltf_write_json_text(context, extension->data, strlen(extension->data));
+		context->needs_comma = 1;
+	}
 	cgltf_write_line(context, "}");
 
 	cgltf_write_extras(context, &data->extras);
 
-	CGLTF_SPRINTF("\n}\n");
+	if (context->compact)
+	{
+		CGLTF_WRITE_LITERAL("}");
+	}
+	else
+	{
+		CGLTF_WRITE_LITERAL("\n}\n");
+	}
+}
+
+static cgltf_memory_options cgltf_write_memory(const cgltf_options* options)
+{
+	cgltf_memory_options memory;
+	memset(&memory, 0, sizeof(memory));
+	if (options)
+	{
+		memory = options->memory;
+	}
+	if (!memory.alloc || !memory.free)
+	{
+		memory.alloc = &cgltf_write_default_alloc;
+		memory.free = &cgltf_write_default_free;
+		memory.user_data = NULL;
+	}
+	return memory;
+}
+
+cgltf_result cgltf_write_json(const cgltf_options* options, const cgltf_data* data, char** out_json, cgltf_size* out_size)
+{
+	cgltf_write_context ctx;
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.memory = cgltf_write_memory(options);
+	ctx.data = data;
+	ctx.depth = 1;
+	ctx.indent = "  ";
+	ctx.compact = options && options->write_compact;
+
+	cgltf_write_context* context = &ctx;
+
+	cgltf_write_document(context);
+
+	// the terminator is not part of the size, which makes the result usable both as a C string and as a JSON chunk
+	cgltf_write_chars(context, "", 1);
+
+	if (ctx.failed)
+	{
+		if (ctx.buffer)
+		{
+			ctx.memory.free(ctx.memory.user_data, ctx.buffer);
+		}
+		return cgltf_result_out_of_memory;
+	}
+
+	*out_json = ctx.buffer;
+	*out_size = ctx.size - 1;
+	return cgltf_result_success;
+}
+
+void cgltf_write_free_json(const cgltf_options* options, char* json)
+{
+	cgltf_memory_options memory = cgltf_write_memory(options);
+	memory.free(memory.user_data, json);
+}
+
+cgltf_size cgltf_write(const cgltf_options* options, char* buffer, cgltf_size size, const cgltf_data* data)
+{
+	char* json = NULL;
+	cgltf_size json_size = 0;
+	if (cgltf_write_json(options, data, &json, &json_size) != cgltf_result_success)
+	{
+		return 0;
+	}
+
+	if (buffer && size > 0)
+	{
+		cgltf_size count = json_size < size - 1 ? json_size : size - 1;
+		memcpy(buffer, json, count);
+		buffer[count] = 0;
+	}
+
+	cgltf_write_free_json(options, json);
 
-	// snprintf does not include the null terminator in its return value, so be sure to include it
-	// in the returned byte count.
-	return 1 + ctx.chars_written;
+	// the returned byte count includes the null terminator
+	return json_size + 1;
 }
 
 #endif /* #ifdef CGLTF_WRITE_IMPLEMENTATION */
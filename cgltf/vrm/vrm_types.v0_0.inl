@@ -146,339 +146,793 @@ static void cgltf_vrm_v0_0_free(const struct cgltf_memory_options* memory, cgltf
 	}
 	memory->free(memory->user_data, data->materialProperties);
 }
-static cgltf_bool select_cgltf_vrm_blendshape_group_presetName_v0_0(const char* name, cgltf_vrm_blendshape_group_presetName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 7 && strncmp(name, "unknown", 7) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_unknown;
-		return 1;
-	} else if (strlen(name) == 7 && strncmp(name, "neutral", 7) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_neutral;
-		return 1;
-	} else if (strlen(name) == 1 && strncmp(name, "a", 1) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_a;
-		return 1;
-	} else if (strlen(name) == 1 && strncmp(name, "i", 1) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_i;
-		return 1;
-	} else if (strlen(name) == 1 && strncmp(name, "u", 1) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_u;
-		return 1;
-	} else if (strlen(name) == 1 && strncmp(name, "e", 1) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_e;
-		return 1;
-	} else if (strlen(name) == 1 && strncmp(name, "o", 1) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_o;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "blink", 5) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_blink;
-		return 1;
-	} else if (strlen(name) == 3 && strncmp(name, "joy", 3) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_joy;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "angry", 5) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_angry;
-		return 1;
-	} else if (strlen(name) == 6 && strncmp(name, "sorrow", 6) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_sorrow;
-		return 1;
-	} else if (strlen(name) == 3 && strncmp(name, "fun", 3) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_fun;
-		return 1;
-	} else if (strlen(name) == 6 && strncmp(name, "lookup", 6) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_lookup;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "lookdown", 8) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_lookdown;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "lookleft", 8) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_lookleft;
-		return 1;
-	} else if (strlen(name) == 9 && strncmp(name, "lookright", 9) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_lookright;
-		return 1;
-	} else if (strlen(name) == 7 && strncmp(name, "blink_l", 7) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_blink_l;
-		return 1;
-	} else if (strlen(name) == 7 && strncmp(name, "blink_r", 7) == 0) {
-		*out = cgltf_vrm_blendshape_group_presetName_v0_0_blink_r;
-		return 1;
-	}
-	return 0;
+/* Ids of VRM keys and enum values that are not glTF keys; they continue after the cgltf_json_key ids */
+enum cgltf_vrm_json_key_v0_0 {
+	cgltf_vrm_json_key_v0_0_Allow = cgltf_json_key_max_enum,
+	cgltf_vrm_json_key_v0_0_BlendShape,
+	cgltf_vrm_json_key_v0_0_Bone,
+	cgltf_vrm_json_key_v0_0_CC0,
+	cgltf_vrm_json_key_v0_0_CC_BY,
+	cgltf_vrm_json_key_v0_0_CC_BY_NC,
+	cgltf_vrm_json_key_v0_0_CC_BY_NC_ND,
+	cgltf_vrm_json_key_v0_0_CC_BY_NC_SA,
+	cgltf_vrm_json_key_v0_0_CC_BY_ND,
+	cgltf_vrm_json_key_v0_0_CC_BY_SA,
+	cgltf_vrm_json_key_v0_0_Disallow,
+	cgltf_vrm_json_key_v0_0_Everyone,
+	cgltf_vrm_json_key_v0_0_ExplicitlyLicensedPerson,
+	cgltf_vrm_json_key_v0_0_OnlyAuthor,
+	cgltf_vrm_json_key_v0_0_Other,
+	cgltf_vrm_json_key_v0_0_Redistribution_Prohibited,
+	cgltf_vrm_json_key_v0_0_a,
+	cgltf_vrm_json_key_v0_0_allowedUserName,
+	cgltf_vrm_json_key_v0_0_angry,
+	cgltf_vrm_json_key_v0_0_armStretch,
+	cgltf_vrm_json_key_v0_0_author,
+	cgltf_vrm_json_key_v0_0_axisLength,
+	cgltf_vrm_json_key_v0_0_binds,
+	cgltf_vrm_json_key_v0_0_blendShapeGroups,
+	cgltf_vrm_json_key_v0_0_blendShapeMaster,
+	cgltf_vrm_json_key_v0_0_blink,
+	cgltf_vrm_json_key_v0_0_blink_l,
+	cgltf_vrm_json_key_v0_0_blink_r,
+	cgltf_vrm_json_key_v0_0_bone,
+	cgltf_vrm_json_key_v0_0_boneGroups,
+	cgltf_vrm_json_key_v0_0_bones,
+	cgltf_vrm_json_key_v0_0_center,
+	cgltf_vrm_json_key_v0_0_chest,
+	cgltf_vrm_json_key_v0_0_colliderGroups,
+	cgltf_vrm_json_key_v0_0_colliders,
+	cgltf_vrm_json_key_v0_0_comment,
+	cgltf_vrm_json_key_v0_0_commercialUssageName,
+	cgltf_vrm_json_key_v0_0_contactInformation,
+	cgltf_vrm_json_key_v0_0_curve,
+	cgltf_vrm_json_key_v0_0_dragForce,
+	cgltf_vrm_json_key_v0_0_e,
+	cgltf_vrm_json_key_v0_0_exporterVersion,
+	cgltf_vrm_json_key_v0_0_feetSpacing,
+	cgltf_vrm_json_key_v0_0_firstPerson,
+	cgltf_vrm_json_key_v0_0_firstPersonBone,
+	cgltf_vrm_json_key_v0_0_firstPersonBoneOffset,
+	cgltf_vrm_json_key_v0_0_firstPersonFlag,
+	cgltf_vrm_json_key_v0_0_floatProperties,
+	cgltf_vrm_json_key_v0_0_fun,
+	cgltf_vrm_json_key_v0_0_gravityDir,
+	cgltf_vrm_json_key_v0_0_gravityPower,
+	cgltf_vrm_json_key_v0_0_hasTranslationDoF,
+	cgltf_vrm_json_key_v0_0_head,
+	cgltf_vrm_json_key_v0_0_hips,
+	cgltf_vrm_json_key_v0_0_hitRadius,
+	cgltf_vrm_json_key_v0_0_humanBones,
+	cgltf_vrm_json_key_v0_0_humanoid,
+	cgltf_vrm_json_key_v0_0_i,
+	cgltf_vrm_json_key_v0_0_isBinary,
+	cgltf_vrm_json_key_v0_0_jaw,
+	cgltf_vrm_json_key_v0_0_joy,
+	cgltf_vrm_json_key_v0_0_keywordMap,
+	cgltf_vrm_json_key_v0_0_leftEye,
+	cgltf_vrm_json_key_v0_0_leftFoot,
+	cgltf_vrm_json_key_v0_0_leftHand,
+	cgltf_vrm_json_key_v0_0_leftIndexDistal,
+	cgltf_vrm_json_key_v0_0_leftIndexIntermediate,
+	cgltf_vrm_json_key_v0_0_leftIndexProximal,
+	cgltf_vrm_json_key_v0_0_leftLittleDistal,
+	cgltf_vrm_json_key_v0_0_leftLittleIntermediate,
+	cgltf_vrm_json_key_v0_0_leftLittleProximal,
+	cgltf_vrm_json_key_v0_0_leftLowerArm,
+	cgltf_vrm_json_key_v0_0_leftLowerLeg,
+	cgltf_vrm_json_key_v0_0_leftMiddleDistal,
+	cgltf_vrm_json_key_v0_0_leftMiddleIntermediate,
+	cgltf_vrm_json_key_v0_0_leftMiddleProximal,
+	cgltf_vrm_json_key_v0_0_leftRingDistal,
+	cgltf_vrm_json_key_v0_0_leftRingIntermediate,
+	cgltf_vrm_json_key_v0_0_leftRingProximal,
+	cgltf_vrm_json_key_v0_0_leftShoulder,
+	cgltf_vrm_json_key_v0_0_leftThumbDistal,
+	cgltf_vrm_json_key_v0_0_leftThumbIntermediate,
+	cgltf_vrm_json_key_v0_0_leftThumbProximal,
+	cgltf_vrm_json_key_v0_0_leftToes,
+	cgltf_vrm_json_key_v0_0_leftUpperArm,
+	cgltf_vrm_json_key_v0_0_leftUpperLeg,
+	cgltf_vrm_json_key_v0_0_legStretch,
+	cgltf_vrm_json_key_v0_0_licenseName,
+	cgltf_vrm_json_key_v0_0_lookAtHorizontalInner,
+	cgltf_vrm_json_key_v0_0_lookAtHorizontalOuter,
+	cgltf_vrm_json_key_v0_0_lookAtTypeName,
+	cgltf_vrm_json_key_v0_0_lookAtVerticalDown,
+	cgltf_vrm_json_key_v0_0_lookAtVerticalUp,
+	cgltf_vrm_json_key_v0_0_lookdown,
+	cgltf_vrm_json_key_v0_0_lookleft,
+	cgltf_vrm_json_key_v0_0_lookright,
+	cgltf_vrm_json_key_v0_0_lookup,
+	cgltf_vrm_json_key_v0_0_lowerArmTwist,
+	cgltf_vrm_json_key_v0_0_lowerLegTwist,
+	cgltf_vrm_json_key_v0_0_materialName,
+	cgltf_vrm_json_key_v0_0_materialProperties,
+	cgltf_vrm_json_key_v0_0_materialValues,
+	cgltf_vrm_json_key_v0_0_meshAnnotations,
+	cgltf_vrm_json_key_v0_0_meta,
+	cgltf_vrm_json_key_v0_0_neck,
+	cgltf_vrm_json_key_v0_0_neutral,
+	cgltf_vrm_json_key_v0_0_o,
+	cgltf_vrm_json_key_v0_0_otherLicenseUrl,
+	cgltf_vrm_json_key_v0_0_otherPermissionUrl,
+	cgltf_vrm_json_key_v0_0_presetName,
+	cgltf_vrm_json_key_v0_0_propertyName,
+	cgltf_vrm_json_key_v0_0_radius,
+	cgltf_vrm_json_key_v0_0_reference,
+	cgltf_vrm_json_key_v0_0_renderQueue,
+	cgltf_vrm_json_key_v0_0_rightEye,
+	cgltf_vrm_json_key_v0_0_rightFoot,
+	cgltf_vrm_json_key_v0_0_rightHand,
+	cgltf_vrm_json_key_v0_0_rightIndexDistal,
+	cgltf_vrm_json_key_v0_0_rightIndexIntermediate,
+	cgltf_vrm_json_key_v0_0_rightIndexProximal,
+	cgltf_vrm_json_key_v0_0_rightLittleDistal,
+	cgltf_vrm_json_key_v0_0_rightLittleIntermediate,
+	cgltf_vrm_json_key_v0_0_rightLittleProximal,
+	cgltf_vrm_json_key_v0_0_rightLowerArm,
+	cgltf_vrm_json_key_v0_0_rightLowerLeg,
+	cgltf_vrm_json_key_v0_0_rightMiddleDistal,
+	cgltf_vrm_json_key_v0_0_rightMiddleIntermediate,
+	cgltf_vrm_json_key_v0_0_rightMiddleProximal,
+	cgltf_vrm_json_key_v0_0_rightRingDistal,
+	cgltf_vrm_json_key_v0_0_rightRingIntermediate,
+	cgltf_vrm_json_key_v0_0_rightRingProximal,
+	cgltf_vrm_json_key_v0_0_rightShoulder,
+	cgltf_vrm_json_key_v0_0_rightThumbDistal,
+	cgltf_vrm_json_key_v0_0_rightThumbIntermediate,
+	cgltf_vrm_json_key_v0_0_rightThumbProximal,
+	cgltf_vrm_json_key_v0_0_rightToes,
+	cgltf_vrm_json_key_v0_0_rightUpperArm,
+	cgltf_vrm_json_key_v0_0_rightUpperLeg,
+	cgltf_vrm_json_key_v0_0_secondaryAnimation,
+	cgltf_vrm_json_key_v0_0_sexualUssageName,
+	cgltf_vrm_json_key_v0_0_shader,
+	cgltf_vrm_json_key_v0_0_sorrow,
+	cgltf_vrm_json_key_v0_0_specVersion,
+	cgltf_vrm_json_key_v0_0_spine,
+	cgltf_vrm_json_key_v0_0_stiffiness,
+	cgltf_vrm_json_key_v0_0_tagMap,
+	cgltf_vrm_json_key_v0_0_targetValue,
+	cgltf_vrm_json_key_v0_0_texture,
+	cgltf_vrm_json_key_v0_0_textureProperties,
+	cgltf_vrm_json_key_v0_0_title,
+	cgltf_vrm_json_key_v0_0_u,
+	cgltf_vrm_json_key_v0_0_unknown,
+	cgltf_vrm_json_key_v0_0_upperArmTwist,
+	cgltf_vrm_json_key_v0_0_upperChest,
+	cgltf_vrm_json_key_v0_0_upperLegTwist,
+	cgltf_vrm_json_key_v0_0_useDefaultValues,
+	cgltf_vrm_json_key_v0_0_vectorProperties,
+	cgltf_vrm_json_key_v0_0_violentUssageName,
+	cgltf_vrm_json_key_v0_0_weight,
+	cgltf_vrm_json_key_v0_0_xRange,
+	cgltf_vrm_json_key_v0_0_yRange,
+};
+
+static int cgltf_vrm_json_key_lookup_v0_0(const char* str, int length) {
+	switch (length) {
+	case 1:
+		switch (str[0]) {
+		case 'a':
+			if (memcmp(str, "a", 1) == 0) return cgltf_vrm_json_key_v0_0_a;
+			break;
+		case 'e':
+			if (memcmp(str, "e", 1) == 0) return cgltf_vrm_json_key_v0_0_e;
+			break;
+		case 'i':
+			if (memcmp(str, "i", 1) == 0) return cgltf_vrm_json_key_v0_0_i;
+			break;
+		case 'o':
+			if (memcmp(str, "o", 1) == 0) return cgltf_vrm_json_key_v0_0_o;
+			break;
+		case 'u':
+			if (memcmp(str, "u", 1) == 0) return cgltf_vrm_json_key_v0_0_u;
+			break;
+		}
+		break;
+	case 3:
+		switch (str[0]) {
+		case 'C':
+			if (memcmp(str, "CC0", 3) == 0) return cgltf_vrm_json_key_v0_0_CC0;
+			break;
+		case 'f':
+			if (memcmp(str, "fun", 3) == 0) return cgltf_vrm_json_key_v0_0_fun;
+			break;
+		case 'j':
+			if (memcmp(str, "jaw", 3) == 0) return cgltf_vrm_json_key_v0_0_jaw;
+			if (memcmp(str, "joy", 3) == 0) return cgltf_vrm_json_key_v0_0_joy;
+			break;
+		}
+		break;
+	case 4:
+		switch (str[0]) {
+		case 'B':
+			if (memcmp(str, "Bone", 4) == 0) return cgltf_vrm_json_key_v0_0_Bone;
+			break;
+		case 'b':
+			if (memcmp(str, "bone", 4) == 0) return cgltf_vrm_json_key_v0_0_bone;
+			break;
+		case 'h':
+			if (memcmp(str, "head", 4) == 0) return cgltf_vrm_json_key_v0_0_head;
+			if (memcmp(str, "hips", 4) == 0) return cgltf_vrm_json_key_v0_0_hips;
+			break;
+		case 'm':
+			if (memcmp(str, "meta", 4) == 0) return cgltf_vrm_json_key_v0_0_meta;
+			break;
+		case 'n':
+			if (memcmp(str, "neck", 4) == 0) return cgltf_vrm_json_key_v0_0_neck;
+			break;
+		}
+		break;
+	case 5:
+		switch (str[0]) {
+		case 'A':
+			if (memcmp(str, "Allow", 5) == 0) return cgltf_vrm_json_key_v0_0_Allow;
+			break;
+		case 'C':
+			if (memcmp(str, "CC_BY", 5) == 0) return cgltf_vrm_json_key_v0_0_CC_BY;
+			break;
+		case 'O':
+			if (memcmp(str, "Other", 5) == 0) return cgltf_vrm_json_key_v0_0_Other;
+			break;
+		case 'a':
+			if (memcmp(str, "angry", 5) == 0) return cgltf_vrm_json_key_v0_0_angry;
+			break;
+		case 'b':
+			if (memcmp(str, "binds", 5) == 0) return cgltf_vrm_json_key_v0_0_binds;
+			if (memcmp(str, "blink", 5) == 0) return cgltf_vrm_json_key_v0_0_blink;
+			if (memcmp(str, "bones", 5) == 0) return cgltf_vrm_json_key_v0_0_bones;
+			break;
+		case 'c':
+			if (memcmp(str, "chest", 5) == 0) return cgltf_vrm_json_key_v0_0_chest;
+			if (memcmp(str, "curve", 5) == 0) return cgltf_vrm_json_key_v0_0_curve;
+			break;
+		case 's':
+			if (memcmp(str, "spine", 5) == 0) return cgltf_vrm_json_key_v0_0_spine;
+			break;
+		case 't':
+			if (memcmp(str, "title", 5) == 0) return cgltf_vrm_json_key_v0_0_title;
+			break;
+		}
+		break;
+	case 6:
+		switch (str[0]) {
+		case 'a':
+			if (memcmp(str, "author", 6) == 0) return cgltf_vrm_json_key_v0_0_author;
+			break;
+		case 'c':
+			if (memcmp(str, "center", 6) == 0) return cgltf_vrm_json_key_v0_0_center;
+			break;
+		case 'l':
+			if (memcmp(str, "lookup", 6) == 0) return cgltf_vrm_json_key_v0_0_lookup;
+			break;
+		case 'r':
+			if (memcmp(str, "radius", 6) == 0) return cgltf_vrm_json_key_v0_0_radius;
+			break;
+		case 's':
+			if (memcmp(str, "shader", 6) == 0) return cgltf_vrm_json_key_v0_0_shader;
+			if (memcmp(str, "sorrow", 6) == 0) return cgltf_vrm_json_key_v0_0_sorrow;
+			break;
+		case 't':
+			if (memcmp(str, "tagMap", 6) == 0) return cgltf_vrm_json_key_v0_0_tagMap;
+			break;
+		case 'w':
+			if (memcmp(str, "weight", 6) == 0) return cgltf_vrm_json_key_v0_0_weight;
+			break;
+		case 'x':
+			if (memcmp(str, "xRange", 6) == 0) return cgltf_vrm_json_key_v0_0_xRange;
+			break;
+		case 'y':
+			if (memcmp(str, "yRange", 6) == 0) return cgltf_vrm_json_key_v0_0_yRange;
+			break;
+		}
+		break;
+	case 7:
+		switch (str[0]) {
+		case 'b':
+			if (memcmp(str, "blink_l", 7) == 0) return cgltf_vrm_json_key_v0_0_blink_l;
+			if (memcmp(str, "blink_r", 7) == 0) return cgltf_vrm_json_key_v0_0_blink_r;
+			break;
+		case 'c':
+			if (memcmp(str, "comment", 7) == 0) return cgltf_vrm_json_key_v0_0_comment;
+			break;
+		case 'l':
+			if (memcmp(str, "leftEye", 7) == 0) return cgltf_vrm_json_key_v0_0_leftEye;
+			break;
+		case 'n':
+			if (memcmp(str, "neutral", 7) == 0) return cgltf_vrm_json_key_v0_0_neutral;
+			break;
+		case 't':
+			if (memcmp(str, "texture", 7) == 0) return cgltf_vrm_json_key_v0_0_texture;
+			break;
+		case 'u':
+			if (memcmp(str, "unknown", 7) == 0) return cgltf_vrm_json_key_v0_0_unknown;
+			break;
+		}
+		break;
+	case 8:
+		switch (str[0]) {
+		case 'C':
+			if (memcmp(str, "CC_BY_NC", 8) == 0) return cgltf_vrm_json_key_v0_0_CC_BY_NC;
+			if (memcmp(str, "CC_BY_ND", 8) == 0) return cgltf_vrm_json_key_v0_0_CC_BY_ND;
+			if (memcmp(str, "CC_BY_SA", 8) == 0) return cgltf_vrm_json_key_v0_0_CC_BY_SA;
+			break;
+		case 'D':
+			if (memcmp(str, "Disallow", 8) == 0) return cgltf_vrm_json_key_v0_0_Disallow;
+			break;
+		case 'E':
+			if (memcmp(str, "Everyone", 8) == 0) return cgltf_vrm_json_key_v0_0_Everyone;
+			break;
+		case 'h':
+			if (memcmp(str, "humanoid", 8) == 0) return cgltf_vrm_json_key_v0_0_humanoid;
+			break;
+		case 'i':
+			if (memcmp(str, "isBinary", 8) == 0) return cgltf_vrm_json_key_v0_0_isBinary;
+			break;
+		case 'l':
+			if (memcmp(str, "leftFoot", 8) == 0) return cgltf_vrm_json_key_v0_0_leftFoot;
+			if (memcmp(str, "leftHand", 8) == 0) return cgltf_vrm_json_key_v0_0_leftHand;
+			if (memcmp(str, "leftToes", 8) == 0) return cgltf_vrm_json_key_v0_0_leftToes;
+			if (memcmp(str, "lookdown", 8) == 0) return cgltf_vrm_json_key_v0_0_lookdown;
+			if (memcmp(str, "lookleft", 8) == 0) return cgltf_vrm_json_key_v0_0_lookleft;
+			break;
+		case 'r':
+			if (memcmp(str, "rightEye", 8) == 0) return cgltf_vrm_json_key_v0_0_rightEye;
+			break;
+		}
+		break;
+	case 9:
+		switch (str[0]) {
+		case 'c':
+			if (memcmp(str, "colliders", 9) == 0) return cgltf_vrm_json_key_v0_0_colliders;
+			break;
+		case 'd':
+			if (memcmp(str, "dragForce", 9) == 0) return cgltf_vrm_json_key_v0_0_dragForce;
+			break;
+		case 'h':
+			if (memcmp(str, "hitRadius", 9) == 0) return cgltf_vrm_json_key_v0_0_hitRadius;
+			break;
+		case 'l':
+			if (memcmp(str, "lookright", 9) == 0) return cgltf_vrm_json_key_v0_0_lookright;
+			break;
+		case 'r':
+			if (memcmp(str, "reference", 9) == 0) return cgltf_vrm_json_key_v0_0_reference;
+			if (memcmp(str, "rightFoot", 9) == 0) return cgltf_vrm_json_key_v0_0_rightFoot;
+			if (memcmp(str, "rightHand", 9) == 0) return cgltf_vrm_json_key_v0_0_rightHand;
+			if (memcmp(str, "rightToes", 9) == 0) return cgltf_vrm_json_key_v0_0_rightToes;
+			break;
+		}
+		break;
+	case 10:
+		switch (str[0]) {
+		case 'B':
+			if (memcmp(str, "BlendShape", 10) == 0) return cgltf_vrm_json_key_v0_0_BlendShape;
+			break;
+		case 'O':
+			if (memcmp(str, "OnlyAuthor", 10) == 0) return cgltf_vrm_json_key_v0_0_OnlyAuthor;
+			break;
+		case 'a':
+			if (memcmp(str, "armStretch", 10) == 0) return cgltf_vrm_json_key_v0_0_armStretch;
+			if (memcmp(str, "axisLength", 10) == 0) return cgltf_vrm_json_key_v0_0_axisLength;
+			break;
+		case 'b':
+			if (memcmp(str, "boneGroups", 10) == 0) return cgltf_vrm_json_key_v0_0_boneGroups;
+			break;
+		case 'g':
+			if (memcmp(str, "gravityDir", 10) == 0) return cgltf_vrm_json_key_v0_0_gravityDir;
+			break;
+		case 'h':
+			if (memcmp(str, "humanBones", 10) == 0) return cgltf_vrm_json_key_v0_0_humanBones;
+			break;
+		case 'k':
+			if (memcmp(str, "keywordMap", 10) == 0) return cgltf_vrm_json_key_v0_0_keywordMap;
+			break;
+		case 'l':
+			if (memcmp(str, "legStretch", 10) == 0) return cgltf_vrm_json_key_v0_0_legStretch;
+			break;
+		case 'p':
+			if (memcmp(str, "presetName", 10) == 0) return cgltf_vrm_json_key_v0_0_presetName;
+			break;
+		case 's':
+			if (memcmp(str, "stiffiness", 10) == 0) return cgltf_vrm_json_key_v0_0_stiffiness;
+			break;
+		case 'u':
+			if (memcmp(str, "upperChest", 10) == 0) return cgltf_vrm_json_key_v0_0_upperChest;
+			break;
+		}
+		break;
+	case 11:
+		switch (str[0]) {
+		case 'C':
+			if (memcmp(str, "CC_BY_NC_ND", 11) == 0) return cgltf_vrm_json_key_v0_0_CC_BY_NC_ND;
+			if (memcmp(str, "CC_BY_NC_SA", 11) == 0) return cgltf_vrm_json_key_v0_0_CC_BY_NC_SA;
+			break;
+		case 'f':
+			if (memcmp(str, "feetSpacing", 11) == 0) return cgltf_vrm_json_key_v0_0_feetSpacing;
+			if (memcmp(str, "firstPerson", 11) == 0) return cgltf_vrm_json_key_v0_0_firstPerson;
+			break;
+		case 'l':
+			if (memcmp(str, "licenseName", 11) == 0) return cgltf_vrm_json_key_v0_0_licenseName;
+			break;
+		case 'r':
+			if (memcmp(str, "renderQueue", 11) == 0) return cgltf_vrm_json_key_v0_0_renderQueue;
+			break;
+		case 's':
+			if (memcmp(str, "specVersion", 11) == 0) return cgltf_vrm_json_key_v0_0_specVersion;
+			break;
+		case 't':
+			if (memcmp(str, "targetValue", 11) == 0) return cgltf_vrm_json_key_v0_0_targetValue;
+			break;
+		}
+		break;
+	case 12:
+		switch (str[0]) {
+		case 'g':
+			if (memcmp(str, "gravityPower", 12) == 0) return cgltf_vrm_json_key_v0_0_gravityPower;
+			break;
+		case 'l':
+			if (memcmp(str, "leftLowerArm", 12) == 0) return cgltf_vrm_json_key_v0_0_leftLowerArm;
+			if (memcmp(str, "leftLowerLeg", 12) == 0) return cgltf_vrm_json_key_v0_0_leftLowerLeg;
+			if (memcmp(str, "leftShoulder", 12) == 0) return cgltf_vrm_json_key_v0_0_leftShoulder;
+			if (memcmp(str, "leftUpperArm", 12) == 0) return cgltf_vrm_json_key_v0_0_leftUpperArm;
+			if (memcmp(str, "leftUpperLeg", 12) == 0) return cgltf_vrm_json_key_v0_0_leftUpperLeg;
+			break;
+		case 'm':
+			if (memcmp(str, "materialName", 12) == 0) return cgltf_vrm_json_key_v0_0_materialName;
+			break;
+		case 'p':
+			if (memcmp(str, "propertyName", 12) == 0) return cgltf_vrm_json_key_v0_0_propertyName;
+			break;
+		}
+		break;
+	case 13:
+		switch (str[0]) {
+		case 'l':
+			if (memcmp(str, "lowerArmTwist", 13) == 0) return cgltf_vrm_json_key_v0_0_lowerArmTwist;
+			if (memcmp(str, "lowerLegTwist", 13) == 0) return cgltf_vrm_json_key_v0_0_lowerLegTwist;
+			break;
+		case 'r':
+			if (memcmp(str, "rightLowerArm", 13) == 0) return cgltf_vrm_json_key_v0_0_rightLowerArm;
+			if (memcmp(str, "rightLowerLeg", 13) == 0) return cgltf_vrm_json_key_v0_0_rightLowerLeg;
+			if (memcmp(str, "rightShoulder", 13) == 0) return cgltf_vrm_json_key_v0_0_rightShoulder;
+			if (memcmp(str, "rightUpperArm", 13) == 0) return cgltf_vrm_json_key_v0_0_rightUpperArm;
+			if (memcmp(str, "rightUpperLeg", 13) == 0) return cgltf_vrm_json_key_v0_0_rightUpperLeg;
+			break;
+		case 'u':
+			if (memcmp(str, "upperArmTwist", 13) == 0) return cgltf_vrm_json_key_v0_0_upperArmTwist;
+			if (memcmp(str, "upperLegTwist", 13) == 0) return cgltf_vrm_json_key_v0_0_upperLegTwist;
+			break;
+		}
+		break;
+	case 14:
+		switch (str[0]) {
+		case 'c':
+			if (memcmp(str, "colliderGroups", 14) == 0) return cgltf_vrm_json_key_v0_0_colliderGroups;
+			break;
+		case 'l':
+			if (memcmp(str, "leftRingDistal", 14) == 0) return cgltf_vrm_json_key_v0_0_leftRingDistal;
+			if (memcmp(str, "lookAtTypeName", 14) == 0) return cgltf_vrm_json_key_v0_0_lookAtTypeName;
+			break;
+		case 'm':
+			if (memcmp(str, "materialValues", 14) == 0) return cgltf_vrm_json_key_v0_0_materialValues;
+			break;
+		}
+		break;
+	case 15:
+		switch (str[0]) {
+		case 'a':
+			if (memcmp(str, "allowedUserName", 15) == 0) return cgltf_vrm_json_key_v0_0_allowedUserName;
+			break;
+		case 'e':
+			if (memcmp(str, "exporterVersion", 15) == 0) return cgltf_vrm_json_key_v0_0_exporterVersion;
+			break;
+		case 'f':
+			if (memcmp(str, "firstPersonBone", 15) == 0) return cgltf_vrm_json_key_v0_0_firstPersonBone;
+			if (memcmp(str, "firstPersonFlag", 15) == 0) return cgltf_vrm_json_key_v0_0_firstPersonFlag;
+			if (memcmp(str, "floatProperties", 15) == 0) return cgltf_vrm_json_key_v0_0_floatProperties;
+			break;
+		case 'l':
+			if (memcmp(str, "leftIndexDistal", 15) == 0) return cgltf_vrm_json_key_v0_0_leftIndexDistal;
+			if (memcmp(str, "leftThumbDistal", 15) == 0) return cgltf_vrm_json_key_v0_0_leftThumbDistal;
+			break;
+		case 'm':
+			if (memcmp(str, "meshAnnotations", 15) == 0) return cgltf_vrm_json_key_v0_0_meshAnnotations;
+			break;
+		case 'o':
+			if (memcmp(str, "otherLicenseUrl", 15) == 0) return cgltf_vrm_json_key_v0_0_otherLicenseUrl;
+			break;
+		case 'r':
+			if (memcmp(str, "rightRingDistal", 15) == 0) return cgltf_vrm_json_key_v0_0_rightRingDistal;
+			break;
+		}
+		break;
+	case 16:
+		switch (str[0]) {
+		case 'b':
+			if (memcmp(str, "blendShapeGroups", 16) == 0) return cgltf_vrm_json_key_v0_0_blendShapeGroups;
+			if (memcmp(str, "blendShapeMaster", 16) == 0) return cgltf_vrm_json_key_v0_0_blendShapeMaster;
+			break;
+		case 'l':
+			if (memcmp(str, "leftLittleDistal", 16) == 0) return cgltf_vrm_json_key_v0_0_leftLittleDistal;
+			if (memcmp(str, "leftMiddleDistal", 16) == 0) return cgltf_vrm_json_key_v0_0_leftMiddleDistal;
+			if (memcmp(str, "leftRingProximal", 16) == 0) return cgltf_vrm_json_key_v0_0_leftRingProximal;
+			if (memcmp(str, "lookAtVerticalUp", 16) == 0) return cgltf_vrm_json_key_v0_0_lookAtVerticalUp;
+			break;
+		case 'r':
+			if (memcmp(str, "rightIndexDistal", 16) == 0) return cgltf_vrm_json_key_v0_0_rightIndexDistal;
+			if (memcmp(str, "rightThumbDistal", 16) == 0) return cgltf_vrm_json_key_v0_0_rightThumbDistal;
+			break;
+		case 's':
+			if (memcmp(str, "sexualUssageName", 16) == 0) return cgltf_vrm_json_key_v0_0_sexualUssageName;
+			break;
+		case 'u':
+			if (memcmp(str, "useDefaultValues", 16) == 0) return cgltf_vrm_json_key_v0_0_useDefaultValues;
+			break;
+		case 'v':
+			if (memcmp(str, "vectorProperties", 16) == 0) return cgltf_vrm_json_key_v0_0_vectorProperties;
+			break;
+		}
+		break;
+	case 17:
+		switch (str[0]) {
+		case 'h':
+			if (memcmp(str, "hasTranslationDoF", 17) == 0) return cgltf_vrm_json_key_v0_0_hasTranslationDoF;
+			break;
+		case 'l':
+			if (memcmp(str, "leftIndexProximal", 17) == 0) return cgltf_vrm_json_key_v0_0_leftIndexProximal;
+			if (memcmp(str, "leftThumbProximal", 17) == 0) return cgltf_vrm_json_key_v0_0_leftThumbProximal;
+			break;
+		case 'r':
+			if (memcmp(str, "rightLittleDistal", 17) == 0) return cgltf_vrm_json_key_v0_0_rightLittleDistal;
+			if (memcmp(str, "rightMiddleDistal", 17) == 0) return cgltf_vrm_json_key_v0_0_rightMiddleDistal;
+			if (memcmp(str, "rightRingProximal", 17) == 0) return cgltf_vrm_json_key_v0_0_rightRingProximal;
+			break;
+		case 't':
+			if (memcmp(str, "textureProperties", 17) == 0) return cgltf_vrm_json_key_v0_0_textureProperties;
+			break;
+		case 'v':
+			if (memcmp(str, "violentUssageName", 17) == 0) return cgltf_vrm_json_key_v0_0_violentUssageName;
+			break;
+		}
+		break;
+	case 18:
+		switch (str[0]) {
+		case 'c':
+			if (memcmp(str, "contactInformation", 18) == 0) return cgltf_vrm_json_key_v0_0_contactInformation;
+			break;
+		case 'l':
+			if (memcmp(str, "leftLittleProximal", 18) == 0) return cgltf_vrm_json_key_v0_0_leftLittleProximal;
+			if (memcmp(str, "leftMiddleProximal", 18) == 0) return cgltf_vrm_json_key_v0_0_leftMiddleProximal;
+			if (memcmp(str, "lookAtVerticalDown", 18) == 0) return cgltf_vrm_json_key_v0_0_lookAtVerticalDown;
+			break;
+		case 'm':
+			if (memcmp(str, "materialProperties", 18) == 0) return cgltf_vrm_json_key_v0_0_materialProperties;
+			break;
+		case 'o':
+			if (memcmp(str, "otherPermissionUrl", 18) == 0) return cgltf_vrm_json_key_v0_0_otherPermissionUrl;
+			break;
+		case 'r':
+			if (memcmp(str, "rightIndexProximal", 18) == 0) return cgltf_vrm_json_key_v0_0_rightIndexProximal;
+			if (memcmp(str, "rightThumbProximal", 18) == 0) return cgltf_vrm_json_key_v0_0_rightThumbProximal;
+			break;
+		case 's':
+			if (memcmp(str, "secondaryAnimation", 18) == 0) return cgltf_vrm_json_key_v0_0_secondaryAnimation;
+			break;
+		}
+		break;
+	case 19:
+		switch (str[0]) {
+		case 'r':
+			if (memcmp(str, "rightLittleProximal", 19) == 0) return cgltf_vrm_json_key_v0_0_rightLittleProximal;
+			if (memcmp(str, "rightMiddleProximal", 19) == 0) return cgltf_vrm_json_key_v0_0_rightMiddleProximal;
+			break;
+		}
+		break;
+	case 20:
+		switch (str[0]) {
+		case 'c':
+			if (memcmp(str, "commercialUssageName", 20) == 0) return cgltf_vrm_json_key_v0_0_commercialUssageName;
+			break;
+		case 'l':
+			if (memcmp(str, "leftRingIntermediate", 20) == 0) return cgltf_vrm_json_key_v0_0_leftRingIntermediate;
+			break;
+		}
+		break;
+	case 21:
+		switch (str[0]) {
+		case 'f':
+			if (memcmp(str, "firstPersonBoneOffset", 21) == 0) return cgltf_vrm_json_key_v0_0_firstPersonBoneOffset;
+			break;
+		case 'l':
+			if (memcmp(str, "leftIndexIntermediate", 21) == 0) return cgltf_vrm_json_key_v0_0_leftIndexIntermediate;
+			if (memcmp(str, "leftThumbIntermediate", 21) == 0) return cgltf_vrm_json_key_v0_0_leftThumbIntermediate;
+			if (memcmp(str, "lookAtHorizontalInner", 21) == 0) return cgltf_vrm_json_key_v0_0_lookAtHorizontalInner;
+			if (memcmp(str, "lookAtHorizontalOuter", 21) == 0) return cgltf_vrm_json_key_v0_0_lookAtHorizontalOuter;
+			break;
+		case 'r':
+			if (memcmp(str, "rightRingIntermediate", 21) == 0) return cgltf_vrm_json_key_v0_0_rightRingIntermediate;
+			break;
+		}
+		break;
+	case 22:
+		switch (str[0]) {
+		case 'l':
+			if (memcmp(str, "leftLittleIntermediate", 22) == 0) return cgltf_vrm_json_key_v0_0_leftLittleIntermediate;
+			if (memcmp(str, "leftMiddleIntermediate", 22) == 0) return cgltf_vrm_json_key_v0_0_leftMiddleIntermediate;
+			break;
+		case 'r':
+			if (memcmp(str, "rightIndexIntermediate", 22) == 0) return cgltf_vrm_json_key_v0_0_rightIndexIntermediate;
+			if (memcmp(str, "rightThumbIntermediate", 22) == 0) return cgltf_vrm_json_key_v0_0_rightThumbIntermediate;
+			break;
+		}
+		break;
+	case 23:
+		switch (str[0]) {
+		case 'r':
+			if (memcmp(str, "rightLittleIntermediate", 23) == 0) return cgltf_vrm_json_key_v0_0_rightLittleIntermediate;
+			if (memcmp(str, "rightMiddleIntermediate", 23) == 0) return cgltf_vrm_json_key_v0_0_rightMiddleIntermediate;
+			break;
+		}
+		break;
+	case 24:
+		switch (str[0]) {
+		case 'E':
+			if (memcmp(str, "ExplicitlyLicensedPerson", 24) == 0) return cgltf_vrm_json_key_v0_0_ExplicitlyLicensedPerson;
+			break;
+		}
+		break;
+	case 25:
+		switch (str[0]) {
+		case 'R':
+			if (memcmp(str, "Redistribution_Prohibited", 25) == 0) return cgltf_vrm_json_key_v0_0_Redistribution_Prohibited;
+			break;
+		}
+		break;
+	}
+	return cgltf_json_key_unknown;
+}
+
+static cgltf_bool select_cgltf_vrm_blendshape_group_presetName_v0_0(int key, cgltf_vrm_blendshape_group_presetName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_unknown: *out = cgltf_vrm_blendshape_group_presetName_v0_0_unknown; return 1;
+	case cgltf_vrm_json_key_v0_0_neutral: *out = cgltf_vrm_blendshape_group_presetName_v0_0_neutral; return 1;
+	case cgltf_vrm_json_key_v0_0_a: *out = cgltf_vrm_blendshape_group_presetName_v0_0_a; return 1;
+	case cgltf_vrm_json_key_v0_0_i: *out = cgltf_vrm_blendshape_group_presetName_v0_0_i; return 1;
+	case cgltf_vrm_json_key_v0_0_u: *out = cgltf_vrm_blendshape_group_presetName_v0_0_u; return 1;
+	case cgltf_vrm_json_key_v0_0_e: *out = cgltf_vrm_blendshape_group_presetName_v0_0_e; return 1;
+	case cgltf_vrm_json_key_v0_0_o: *out = cgltf_vrm_blendshape_group_presetName_v0_0_o; return 1;
+	case cgltf_vrm_json_key_v0_0_blink: *out = cgltf_vrm_blendshape_group_presetName_v0_0_blink; return 1;
+	case cgltf_vrm_json_key_v0_0_joy: *out = cgltf_vrm_blendshape_group_presetName_v0_0_joy; return 1;
+	case cgltf_vrm_json_key_v0_0_angry: *out = cgltf_vrm_blendshape_group_presetName_v0_0_angry; return 1;
+	case cgltf_vrm_json_key_v0_0_sorrow: *out = cgltf_vrm_blendshape_group_presetName_v0_0_sorrow; return 1;
+	case cgltf_vrm_json_key_v0_0_fun: *out = cgltf_vrm_blendshape_group_presetName_v0_0_fun; return 1;
+	case cgltf_vrm_json_key_v0_0_lookup: *out = cgltf_vrm_blendshape_group_presetName_v0_0_lookup; return 1;
+	case cgltf_vrm_json_key_v0_0_lookdown: *out = cgltf_vrm_blendshape_group_presetName_v0_0_lookdown; return 1;
+	case cgltf_vrm_json_key_v0_0_lookleft: *out = cgltf_vrm_blendshape_group_presetName_v0_0_lookleft; return 1;
+	case cgltf_vrm_json_key_v0_0_lookright: *out = cgltf_vrm_blendshape_group_presetName_v0_0_lookright; return 1;
+	case cgltf_vrm_json_key_v0_0_blink_l: *out = cgltf_vrm_blendshape_group_presetName_v0_0_blink_l; return 1;
+	case cgltf_vrm_json_key_v0_0_blink_r: *out = cgltf_vrm_blendshape_group_presetName_v0_0_blink_r; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_firstperson_lookAtTypeName_v0_0(const char* name, cgltf_vrm_firstperson_lookAtTypeName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 4 && strncmp(name, "Bone", 4) == 0) {
-		*out = cgltf_vrm_firstperson_lookAtTypeName_v0_0_Bone;
-		return 1;
-	} else if (strlen(name) == 10 && strncmp(name, "BlendShape", 10) == 0) {
-		*out = cgltf_vrm_firstperson_lookAtTypeName_v0_0_BlendShape;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_firstperson_lookAtTypeName_v0_0(int key, cgltf_vrm_firstperson_lookAtTypeName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_Bone: *out = cgltf_vrm_firstperson_lookAtTypeName_v0_0_Bone; return 1;
+	case cgltf_vrm_json_key_v0_0_BlendShape: *out = cgltf_vrm_firstperson_lookAtTypeName_v0_0_BlendShape; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_humanoid_bone_bone_v0_0(const char* name, cgltf_vrm_humanoid_bone_bone_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 4 && strncmp(name, "hips", 4) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_hips;
-		return 1;
-	} else if (strlen(name) == 12 && strncmp(name, "leftUpperLeg", 12) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftUpperLeg;
-		return 1;
-	} else if (strlen(name) == 13 && strncmp(name, "rightUpperLeg", 13) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightUpperLeg;
-		return 1;
-	} else if (strlen(name) == 12 && strncmp(name, "leftLowerLeg", 12) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLowerLeg;
-		return 1;
-	} else if (strlen(name) == 13 && strncmp(name, "rightLowerLeg", 13) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLowerLeg;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "leftFoot", 8) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftFoot;
-		return 1;
-	} else if (strlen(name) == 9 && strncmp(name, "rightFoot", 9) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightFoot;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "spine", 5) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_spine;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "chest", 5) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_chest;
-		return 1;
-	} else if (strlen(name) == 4 && strncmp(name, "neck", 4) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_neck;
-		return 1;
-	} else if (strlen(name) == 4 && strncmp(name, "head", 4) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_head;
-		return 1;
-	} else if (strlen(name) == 12 && strncmp(name, "leftShoulder", 12) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftShoulder;
-		return 1;
-	} else if (strlen(name) == 13 && strncmp(name, "rightShoulder", 13) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightShoulder;
-		return 1;
-	} else if (strlen(name) == 12 && strncmp(name, "leftUpperArm", 12) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftUpperArm;
-		return 1;
-	} else if (strlen(name) == 13 && strncmp(name, "rightUpperArm", 13) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightUpperArm;
-		return 1;
-	} else if (strlen(name) == 12 && strncmp(name, "leftLowerArm", 12) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLowerArm;
-		return 1;
-	} else if (strlen(name) == 13 && strncmp(name, "rightLowerArm", 13) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLowerArm;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "leftHand", 8) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftHand;
-		return 1;
-	} else if (strlen(name) == 9 && strncmp(name, "rightHand", 9) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightHand;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "leftToes", 8) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftToes;
-		return 1;
-	} else if (strlen(name) == 9 && strncmp(name, "rightToes", 9) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightToes;
-		return 1;
-	} else if (strlen(name) == 7 && strncmp(name, "leftEye", 7) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftEye;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "rightEye", 8) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightEye;
-		return 1;
-	} else if (strlen(name) == 3 && strncmp(name, "jaw", 3) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_jaw;
-		return 1;
-	} else if (strlen(name) == 17 && strncmp(name, "leftThumbProximal", 17) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbProximal;
-		return 1;
-	} else if (strlen(name) == 21 && strncmp(name, "leftThumbIntermediate", 21) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbIntermediate;
-		return 1;
-	} else if (strlen(name) == 15 && strncmp(name, "leftThumbDistal", 15) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbDistal;
-		return 1;
-	} else if (strlen(name) == 17 && strncmp(name, "leftIndexProximal", 17) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexProximal;
-		return 1;
-	} else if (strlen(name) == 21 && strncmp(name, "leftIndexIntermediate", 21) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexIntermediate;
-		return 1;
-	} else if (strlen(name) == 15 && strncmp(name, "leftIndexDistal", 15) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexDistal;
-		return 1;
-	} else if (strlen(name) == 18 && strncmp(name, "leftMiddleProximal", 18) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleProximal;
-		return 1;
-	} else if (strlen(name) == 22 && strncmp(name, "leftMiddleIntermediate", 22) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleIntermediate;
-		return 1;
-	} else if (strlen(name) == 16 && strncmp(name, "leftMiddleDistal", 16) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleDistal;
-		return 1;
-	} else if (strlen(name) == 16 && strncmp(name, "leftRingProximal", 16) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingProximal;
-		return 1;
-	} else if (strlen(name) == 20 && strncmp(name, "leftRingIntermediate", 20) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingIntermediate;
-		return 1;
-	} else if (strlen(name) == 14 && strncmp(name, "leftRingDistal", 14) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingDistal;
-		return 1;
-	} else if (strlen(name) == 18 && strncmp(name, "leftLittleProximal", 18) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleProximal;
-		return 1;
-	} else if (strlen(name) == 22 && strncmp(name, "leftLittleIntermediate", 22) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleIntermediate;
-		return 1;
-	} else if (strlen(name) == 16 && strncmp(name, "leftLittleDistal", 16) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleDistal;
-		return 1;
-	} else if (strlen(name) == 18 && strncmp(name, "rightThumbProximal", 18) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbProximal;
-		return 1;
-	} else if (strlen(name) == 22 && strncmp(name, "rightThumbIntermediate", 22) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbIntermediate;
-		return 1;
-	} else if (strlen(name) == 16 && strncmp(name, "rightThumbDistal", 16) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbDistal;
-		return 1;
-	} else if (strlen(name) == 18 && strncmp(name, "rightIndexProximal", 18) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexProximal;
-		return 1;
-	} else if (strlen(name) == 22 && strncmp(name, "rightIndexIntermediate", 22) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexIntermediate;
-		return 1;
-	} else if (strlen(name) == 16 && strncmp(name, "rightIndexDistal", 16) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexDistal;
-		return 1;
-	} else if (strlen(name) == 19 && strncmp(name, "rightMiddleProximal", 19) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleProximal;
-		return 1;
-	} else if (strlen(name) == 23 && strncmp(name, "rightMiddleIntermediate", 23) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleIntermediate;
-		return 1;
-	} else if (strlen(name) == 17 && strncmp(name, "rightMiddleDistal", 17) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleDistal;
-		return 1;
-	} else if (strlen(name) == 17 && strncmp(name, "rightRingProximal", 17) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingProximal;
-		return 1;
-	} else if (strlen(name) == 21 && strncmp(name, "rightRingIntermediate", 21) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingIntermediate;
-		return 1;
-	} else if (strlen(name) == 15 && strncmp(name, "rightRingDistal", 15) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingDistal;
-		return 1;
-	} else if (strlen(name) == 19 && strncmp(name, "rightLittleProximal", 19) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleProximal;
-		return 1;
-	} else if (strlen(name) == 23 && strncmp(name, "rightLittleIntermediate", 23) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleIntermediate;
-		return 1;
-	} else if (strlen(name) == 17 && strncmp(name, "rightLittleDistal", 17) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleDistal;
-		return 1;
-	} else if (strlen(name) == 10 && strncmp(name, "upperChest", 10) == 0) {
-		*out = cgltf_vrm_humanoid_bone_bone_v0_0_upperChest;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_humanoid_bone_bone_v0_0(int key, cgltf_vrm_humanoid_bone_bone_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_hips: *out = cgltf_vrm_humanoid_bone_bone_v0_0_hips; return 1;
+	case cgltf_vrm_json_key_v0_0_leftUpperLeg: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftUpperLeg; return 1;
+	case cgltf_vrm_json_key_v0_0_rightUpperLeg: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightUpperLeg; return 1;
+	case cgltf_vrm_json_key_v0_0_leftLowerLeg: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLowerLeg; return 1;
+	case cgltf_vrm_json_key_v0_0_rightLowerLeg: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLowerLeg; return 1;
+	case cgltf_vrm_json_key_v0_0_leftFoot: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftFoot; return 1;
+	case cgltf_vrm_json_key_v0_0_rightFoot: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightFoot; return 1;
+	case cgltf_vrm_json_key_v0_0_spine: *out = cgltf_vrm_humanoid_bone_bone_v0_0_spine; return 1;
+	case cgltf_vrm_json_key_v0_0_chest: *out = cgltf_vrm_humanoid_bone_bone_v0_0_chest; return 1;
+	case cgltf_vrm_json_key_v0_0_neck: *out = cgltf_vrm_humanoid_bone_bone_v0_0_neck; return 1;
+	case cgltf_vrm_json_key_v0_0_head: *out = cgltf_vrm_humanoid_bone_bone_v0_0_head; return 1;
+	case cgltf_vrm_json_key_v0_0_leftShoulder: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftShoulder; return 1;
+	case cgltf_vrm_json_key_v0_0_rightShoulder: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightShoulder; return 1;
+	case cgltf_vrm_json_key_v0_0_leftUpperArm: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftUpperArm; return 1;
+	case cgltf_vrm_json_key_v0_0_rightUpperArm: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightUpperArm; return 1;
+	case cgltf_vrm_json_key_v0_0_leftLowerArm: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLowerArm; return 1;
+	case cgltf_vrm_json_key_v0_0_rightLowerArm: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLowerArm; return 1;
+	case cgltf_vrm_json_key_v0_0_leftHand: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftHand; return 1;
+	case cgltf_vrm_json_key_v0_0_rightHand: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightHand; return 1;
+	case cgltf_vrm_json_key_v0_0_leftToes: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftToes; return 1;
+	case cgltf_vrm_json_key_v0_0_rightToes: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightToes; return 1;
+	case cgltf_vrm_json_key_v0_0_leftEye: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftEye; return 1;
+	case cgltf_vrm_json_key_v0_0_rightEye: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightEye; return 1;
+	case cgltf_vrm_json_key_v0_0_jaw: *out = cgltf_vrm_humanoid_bone_bone_v0_0_jaw; return 1;
+	case cgltf_vrm_json_key_v0_0_leftThumbProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftThumbIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_leftThumbDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftThumbDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftIndexProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftIndexIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_leftIndexDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftIndexDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftMiddleProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftMiddleIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_leftMiddleDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftMiddleDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftRingProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftRingIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_leftRingDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftRingDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftLittleProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_leftLittleIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_leftLittleDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_leftLittleDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightThumbProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightThumbIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_rightThumbDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightThumbDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightIndexProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightIndexIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_rightIndexDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightIndexDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightMiddleProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightMiddleIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_rightMiddleDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightMiddleDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightRingProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightRingIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_rightRingDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightRingDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightLittleProximal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleProximal; return 1;
+	case cgltf_vrm_json_key_v0_0_rightLittleIntermediate: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleIntermediate; return 1;
+	case cgltf_vrm_json_key_v0_0_rightLittleDistal: *out = cgltf_vrm_humanoid_bone_bone_v0_0_rightLittleDistal; return 1;
+	case cgltf_vrm_json_key_v0_0_upperChest: *out = cgltf_vrm_humanoid_bone_bone_v0_0_upperChest; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_meta_allowedUserName_v0_0(const char* name, cgltf_vrm_meta_allowedUserName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 10 && strncmp(name, "OnlyAuthor", 10) == 0) {
-		*out = cgltf_vrm_meta_allowedUserName_v0_0_OnlyAuthor;
-		return 1;
-	} else if (strlen(name) == 24 && strncmp(name, "ExplicitlyLicensedPerson", 24) == 0) {
-		*out = cgltf_vrm_meta_allowedUserName_v0_0_ExplicitlyLicensedPerson;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "Everyone", 8) == 0) {
-		*out = cgltf_vrm_meta_allowedUserName_v0_0_Everyone;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_meta_allowedUserName_v0_0(int key, cgltf_vrm_meta_allowedUserName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_OnlyAuthor: *out = cgltf_vrm_meta_allowedUserName_v0_0_OnlyAuthor; return 1;
+	case cgltf_vrm_json_key_v0_0_ExplicitlyLicensedPerson: *out = cgltf_vrm_meta_allowedUserName_v0_0_ExplicitlyLicensedPerson; return 1;
+	case cgltf_vrm_json_key_v0_0_Everyone: *out = cgltf_vrm_meta_allowedUserName_v0_0_Everyone; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_meta_violentUssageName_v0_0(const char* name, cgltf_vrm_meta_violentUssageName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 8 && strncmp(name, "Disallow", 8) == 0) {
-		*out = cgltf_vrm_meta_violentUssageName_v0_0_Disallow;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "Allow", 5) == 0) {
-		*out = cgltf_vrm_meta_violentUssageName_v0_0_Allow;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_meta_violentUssageName_v0_0(int key, cgltf_vrm_meta_violentUssageName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_Disallow: *out = cgltf_vrm_meta_violentUssageName_v0_0_Disallow; return 1;
+	case cgltf_vrm_json_key_v0_0_Allow: *out = cgltf_vrm_meta_violentUssageName_v0_0_Allow; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_meta_sexualUssageName_v0_0(const char* name, cgltf_vrm_meta_sexualUssageName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 8 && strncmp(name, "Disallow", 8) == 0) {
-		*out = cgltf_vrm_meta_sexualUssageName_v0_0_Disallow;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "Allow", 5) == 0) {
-		*out = cgltf_vrm_meta_sexualUssageName_v0_0_Allow;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_meta_sexualUssageName_v0_0(int key, cgltf_vrm_meta_sexualUssageName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_Disallow: *out = cgltf_vrm_meta_sexualUssageName_v0_0_Disallow; return 1;
+	case cgltf_vrm_json_key_v0_0_Allow: *out = cgltf_vrm_meta_sexualUssageName_v0_0_Allow; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_meta_commercialUssageName_v0_0(const char* name, cgltf_vrm_meta_commercialUssageName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 8 && strncmp(name, "Disallow", 8) == 0) {
-		*out = cgltf_vrm_meta_commercialUssageName_v0_0_Disallow;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "Allow", 5) == 0) {
-		*out = cgltf_vrm_meta_commercialUssageName_v0_0_Allow;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_meta_commercialUssageName_v0_0(int key, cgltf_vrm_meta_commercialUssageName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_Disallow: *out = cgltf_vrm_meta_commercialUssageName_v0_0_Disallow; return 1;
+	case cgltf_vrm_json_key_v0_0_Allow: *out = cgltf_vrm_meta_commercialUssageName_v0_0_Allow; return 1;
+	default: return 0;
+	}
 }
 
-static cgltf_bool select_cgltf_vrm_meta_licenseName_v0_0(const char* name, cgltf_vrm_meta_licenseName_v0_0* out) {
-	if (strlen(name) == 0) {
-		return 0;
-	} else if (strlen(name) == 25 && strncmp(name, "Redistribution_Prohibited", 25) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_Redistribution_Prohibited;
-		return 1;
-	} else if (strlen(name) == 3 && strncmp(name, "CC0", 3) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC0;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "CC_BY", 5) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "CC_BY_NC", 8) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "CC_BY_SA", 8) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_SA;
-		return 1;
-	} else if (strlen(name) == 11 && strncmp(name, "CC_BY_NC_SA", 11) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC_SA;
-		return 1;
-	} else if (strlen(name) == 8 && strncmp(name, "CC_BY_ND", 8) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_ND;
-		return 1;
-	} else if (strlen(name) == 11 && strncmp(name, "CC_BY_NC_ND", 11) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC_ND;
-		return 1;
-	} else if (strlen(name) == 5 && strncmp(name, "Other", 5) == 0) {
-		*out = cgltf_vrm_meta_licenseName_v0_0_Other;
-		return 1;
-	}
-	return 0;
+static cgltf_bool select_cgltf_vrm_meta_licenseName_v0_0(int key, cgltf_vrm_meta_licenseName_v0_0* out) {
+	switch (key) {
+	case cgltf_vrm_json_key_v0_0_Redistribution_Prohibited: *out = cgltf_vrm_meta_licenseName_v0_0_Redistribution_Prohibited; return 1;
+	case cgltf_vrm_json_key_v0_0_CC0: *out = cgltf_vrm_meta_licenseName_v0_0_CC0; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY_NC: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY_SA: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_SA; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY_NC_SA: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC_SA; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY_ND: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_ND; return 1;
+	case cgltf_vrm_json_key_v0_0_CC_BY_NC_ND: *out = cgltf_vrm_meta_licenseName_v0_0_CC_BY_NC_ND; return 1;
+	case cgltf_vrm_json_key_v0_0_Other: *out = cgltf_vrm_meta_licenseName_v0_0_Other; return 1;
+	default: return 0;
+	}
 }
 static int cgltf_parse_json_vrm_secondaryanimation_collidergroup_colliders_v0_0(cgltf_options* options, jsmntok_t const* tokens, int i, const uint8_t* json_chunk, cgltf_vrm_secondaryanimation_collidergroup_colliders_v0_0* out_data) {
 	(void)options;
@@ -487,9 +941,9 @@ static int cgltf_parse_json_vrm_secondaryanimation_collidergroup_colliders_v0_0(
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "offset") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_offset) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->offset, &out_data->offset_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "radius") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_radius) {
 				++i; out_data->radius = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -508,25 +962,25 @@ static int cgltf_parse_json_vrm_secondaryanimation_spring_v0_0(cgltf_options* op
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "comment") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_comment) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->comment);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "stiffiness") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_stiffiness) {
 				++i; out_data->stiffiness = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "gravityPower") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_gravityPower) {
 				++i; out_data->gravityPower = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "gravityDir") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_gravityDir) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->gravityDir, &out_data->gravityDir_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "dragForce") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_dragForce) {
 				++i; out_data->dragForce = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "center") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_center) {
 				++i; out_data->center = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "hitRadius") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_hitRadius) {
 				++i; out_data->hitRadius = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "bones") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_bones) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_int), (void**)&out_data->bones, &out_data->bones_count);
 				if (i < 0) return i;
 				i = cgltf_parse_json_int_array(tokens, i - 1, json_chunk, out_data->bones, (int)out_data->bones_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "colliderGroups") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_colliderGroups) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_int), (void**)&out_data->colliderGroups, &out_data->colliderGroups_count);
 				if (i < 0) return i;
 				i = cgltf_parse_json_int_array(tokens, i - 1, json_chunk, out_data->colliderGroups, (int)out_data->colliderGroups_count);
@@ -547,9 +1001,9 @@ static int cgltf_parse_json_vrm_secondaryanimation_collidergroup_v0_0(cgltf_opti
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "node") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_node) {
 				++i; out_data->node = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "colliders") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_colliders) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_secondaryanimation_collidergroup_colliders_v0_0), (void**)&out_data->colliders, &out_data->colliders_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->colliders_count; k++) {
@@ -572,13 +1026,13 @@ static int cgltf_parse_json_vrm_secondaryanimation_v0_0(cgltf_options* options,
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "boneGroups") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_boneGroups) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_secondaryanimation_spring_v0_0), (void**)&out_data->boneGroups, &out_data->boneGroups_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->boneGroups_count; k++) {
 					i = cgltf_parse_json_vrm_secondaryanimation_spring_v0_0(options, tokens, i, json_chunk, out_data->boneGroups + k);
 				}
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "colliderGroups") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_colliderGroups) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_secondaryanimation_collidergroup_v0_0), (void**)&out_data->colliderGroups, &out_data->colliderGroups_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->colliderGroups_count; k++) {
@@ -601,11 +1055,11 @@ static int cgltf_parse_json_vrm_blendshape_bind_v0_0(cgltf_options* options, jsm
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "mesh") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_mesh) {
 				++i; out_data->mesh = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "index") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_index) {
 				++i; out_data->index = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "weight") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_weight) {
 				++i; out_data->weight = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -624,11 +1078,11 @@ static int cgltf_parse_json_vrm_blendshape_materialbind_v0_0(cgltf_options* opti
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "materialName") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_materialName) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->materialName);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "propertyName") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_propertyName) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->propertyName);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "targetValue") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_targetValue) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_float), (void**)&out_data->targetValue, &out_data->targetValue_count);
 				if (i < 0) return i;
 				i = cgltf_parse_json_float_array(tokens, i - 1, json_chunk, out_data->targetValue, (int)out_data->targetValue_count);
@@ -649,24 +1103,23 @@ static int cgltf_parse_json_vrm_blendshape_group_v0_0(cgltf_options* options, js
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "name") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_name) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->name);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "presetName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_blendshape_group_presetName_v0_0(enum_key, &out_data->presetName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "binds") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_presetName) {
+				++i; i = select_cgltf_vrm_blendshape_group_presetName_v0_0(tokens[i].key, &out_data->presetName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_binds) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_blendshape_bind_v0_0), (void**)&out_data->binds, &out_data->binds_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->binds_count; k++) {
 					i = cgltf_parse_json_vrm_blendshape_bind_v0_0(options, tokens, i, json_chunk, out_data->binds + k);
 				}
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "materialValues") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_materialValues) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_blendshape_materialbind_v0_0), (void**)&out_data->materialValues, &out_data->materialValues_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->materialValues_count; k++) {
 					i = cgltf_parse_json_vrm_blendshape_materialbind_v0_0(options, tokens, i, json_chunk, out_data->materialValues + k);
 				}
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "isBinary") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_isBinary) {
 				++i; out_data->isBinary = cgltf_json_to_bool(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -685,7 +1138,7 @@ static int cgltf_parse_json_vrm_blendshape_v0_0(cgltf_options* options, jsmntok_
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "blendShapeGroups") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_blendShapeGroups) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_blendshape_group_v0_0), (void**)&out_data->blendShapeGroups, &out_data->blendShapeGroups_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->blendShapeGroups_count; k++) {
@@ -708,13 +1161,13 @@ static int cgltf_parse_json_vrm_firstperson_degreemap_v0_0(cgltf_options* option
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "curve") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_curve) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_float), (void**)&out_data->curve, &out_data->curve_count);
 				if (i < 0) return i;
 				i = cgltf_parse_json_float_array(tokens, i - 1, json_chunk, out_data->curve, (int)out_data->curve_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "xRange") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_xRange) {
 				++i; out_data->xRange = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "yRange") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_yRange) {
 				++i; out_data->yRange = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -733,9 +1186,9 @@ static int cgltf_parse_json_vrm_firstperson_meshannotation_v0_0(cgltf_options* o
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "mesh") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_mesh) {
 				++i; out_data->mesh = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "firstPersonFlag") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_firstPersonFlag) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->firstPersonFlag);
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -754,26 +1207,25 @@ static int cgltf_parse_json_vrm_firstperson_v0_0(cgltf_options* options, jsmntok
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "firstPersonBone") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_firstPersonBone) {
 				++i; out_data->firstPersonBone = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "firstPersonBoneOffset") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_firstPersonBoneOffset) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->firstPersonBoneOffset, &out_data->firstPersonBoneOffset_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "meshAnnotations") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_meshAnnotations) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_firstperson_meshannotation_v0_0), (void**)&out_data->meshAnnotations, &out_data->meshAnnotations_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->meshAnnotations_count; k++) {
 					i = cgltf_parse_json_vrm_firstperson_meshannotation_v0_0(options, tokens, i, json_chunk, out_data->meshAnnotations + k);
 				}
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lookAtTypeName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_firstperson_lookAtTypeName_v0_0(enum_key, &out_data->lookAtTypeName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lookAtHorizontalInner") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lookAtTypeName) {
+				++i; i = select_cgltf_vrm_firstperson_lookAtTypeName_v0_0(tokens[i].key, &out_data->lookAtTypeName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lookAtHorizontalInner) {
 				i = cgltf_parse_json_vrm_firstperson_degreemap_v0_0(options, tokens, i + 1, json_chunk, &out_data->lookAtHorizontalInner);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lookAtHorizontalOuter") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lookAtHorizontalOuter) {
 				i = cgltf_parse_json_vrm_firstperson_degreemap_v0_0(options, tokens, i + 1, json_chunk, &out_data->lookAtHorizontalOuter);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lookAtVerticalDown") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lookAtVerticalDown) {
 				i = cgltf_parse_json_vrm_firstperson_degreemap_v0_0(options, tokens, i + 1, json_chunk, &out_data->lookAtVerticalDown);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lookAtVerticalUp") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lookAtVerticalUp) {
 				i = cgltf_parse_json_vrm_firstperson_degreemap_v0_0(options, tokens, i + 1, json_chunk, &out_data->lookAtVerticalUp);
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -792,20 +1244,19 @@ static int cgltf_parse_json_vrm_humanoid_bone_v0_0(cgltf_options* options, jsmnt
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "bone") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_humanoid_bone_bone_v0_0(enum_key, &out_data->bone) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "node") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_bone) {
+				++i; i = select_cgltf_vrm_humanoid_bone_bone_v0_0(tokens[i].key, &out_data->bone) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_json_key_node) {
 				++i; out_data->node = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "useDefaultValues") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_useDefaultValues) {
 				++i; out_data->useDefaultValues = cgltf_json_to_bool(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "min") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_min) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->min, &out_data->min_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "max") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_max) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->max, &out_data->max_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "center") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_center) {
 				i = cgltf_parse_json_vec3(options, tokens, i + 1, json_chunk, &out_data->center, &out_data->center_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "axisLength") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_axisLength) {
 				++i; out_data->axisLength = cgltf_json_to_float(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -824,27 +1275,27 @@ static int cgltf_parse_json_vrm_humanoid_v0_0(cgltf_options* options, jsmntok_t
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "humanBones") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_humanBones) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_humanoid_bone_v0_0), (void**)&out_data->humanBones, &out_data->humanBones_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->humanBones_count; k++) {
 					i = cgltf_parse_json_vrm_humanoid_bone_v0_0(options, tokens, i, json_chunk, out_data->humanBones + k);
 				}
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "armStretch") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_armStretch) {
 				++i; out_data->armStretch = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "legStretch") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_legStretch) {
 				++i; out_data->legStretch = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "upperArmTwist") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_upperArmTwist) {
 				++i; out_data->upperArmTwist = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lowerArmTwist") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lowerArmTwist) {
 				++i; out_data->lowerArmTwist = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "upperLegTwist") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_upperLegTwist) {
 				++i; out_data->upperLegTwist = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "lowerLegTwist") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_lowerLegTwist) {
 				++i; out_data->lowerLegTwist = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "feetSpacing") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_feetSpacing) {
 				++i; out_data->feetSpacing = cgltf_json_to_float(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "hasTranslationDoF") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_hasTranslationDoF) {
 				++i; out_data->hasTranslationDoF = cgltf_json_to_bool(tokens + i, json_chunk); ++i;
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -863,21 +1314,21 @@ static int cgltf_parse_json_vrm_material_v0_0(cgltf_options* options, jsmntok_t
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "name") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_name) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->name);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "shader") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_shader) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->shader);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "renderQueue") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_renderQueue) {
 				++i; out_data->renderQueue = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "floatProperties") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_floatProperties) {
 					i = cgltf_parse_json_float_properties(options, tokens, i + 1, json_chunk, &out_data->floatProperties_keys, &out_data->floatProperties_values, &out_data->floatProperties_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "vectorProperties") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_vectorProperties) {
 					i = cgltf_parse_json_floats_properties(options, tokens, i + 1, json_chunk, &out_data->vectorProperties_keys, &out_data->vectorProperties_values, &out_data->vectorProperties_floats_size, &out_data->vectorProperties_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "textureProperties") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_textureProperties) {
 					i = cgltf_parse_json_int_properties(options, tokens, i + 1, json_chunk, &out_data->textureProperties_keys, &out_data->textureProperties_values, &out_data->textureProperties_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "keywordMap") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_keywordMap) {
 					i = cgltf_parse_json_bool_properties(options, tokens, i + 1, json_chunk, &out_data->keywordMap_keys, &out_data->keywordMap_values, &out_data->keywordMap_count);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "tagMap") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_tagMap) {
 					i = cgltf_parse_json_chars_properties(options, tokens, i + 1, json_chunk, &out_data->tagMap_keys, &out_data->tagMap_values, &out_data->tagMap_count);
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -896,36 +1347,31 @@ static int cgltf_parse_json_vrm_meta_v0_0(cgltf_options* options, jsmntok_t cons
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "title") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_title) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->title);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "version") == 0) {
+			} else if (tokens[i].key == cgltf_json_key_version) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->version);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "author") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_author) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->author);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "contactInformation") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_contactInformation) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->contactInformation);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "reference") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_reference) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->reference);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "texture") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_texture) {
 				++i; out_data->texture = cgltf_json_to_int(tokens + i, json_chunk); ++i;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "allowedUserName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_meta_allowedUserName_v0_0(enum_key, &out_data->allowedUserName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "violentUssageName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_meta_violentUssageName_v0_0(enum_key, &out_data->violentUssageName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "sexualUssageName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_meta_sexualUssageName_v0_0(enum_key, &out_data->sexualUssageName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "commercialUssageName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_meta_commercialUssageName_v0_0(enum_key, &out_data->commercialUssageName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "otherPermissionUrl") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_allowedUserName) {
+				++i; i = select_cgltf_vrm_meta_allowedUserName_v0_0(tokens[i].key, &out_data->allowedUserName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_violentUssageName) {
+				++i; i = select_cgltf_vrm_meta_violentUssageName_v0_0(tokens[i].key, &out_data->violentUssageName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_sexualUssageName) {
+				++i; i = select_cgltf_vrm_meta_sexualUssageName_v0_0(tokens[i].key, &out_data->sexualUssageName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_commercialUssageName) {
+				++i; i = select_cgltf_vrm_meta_commercialUssageName_v0_0(tokens[i].key, &out_data->commercialUssageName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_otherPermissionUrl) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->otherPermissionUrl);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "licenseName") == 0) {
-				char* enum_key = NULL; i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &enum_key);
-				i = select_cgltf_vrm_meta_licenseName_v0_0(enum_key, &out_data->licenseName) ? i : -1;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "otherLicenseUrl") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_licenseName) {
+				++i; i = select_cgltf_vrm_meta_licenseName_v0_0(tokens[i].key, &out_data->licenseName) ? i + 1 : -1;
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_otherLicenseUrl) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->otherLicenseUrl);
 			} else {
 				i = cgltf_skip_json(tokens, i + 1);
@@ -944,21 +1390,21 @@ static int cgltf_parse_json_vrm_v0_0(cgltf_options* options, jsmntok_t const* to
 		for (int j = 0; j < size; ++j) {
 			if (tokens[i].type != JSMN_STRING || tokens[i].size == 0) {
 				continue;
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "exporterVersion") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_exporterVersion) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->exporterVersion);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "specVersion") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_specVersion) {
 				i = cgltf_parse_json_string(options, tokens, i + 1, json_chunk, &out_data->specVersion);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "meta") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_meta) {
 				i = cgltf_parse_json_vrm_meta_v0_0(options, tokens, i + 1, json_chunk, &out_data->meta);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "humanoid") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_humanoid) {
 				i = cgltf_parse_json_vrm_humanoid_v0_0(options, tokens, i + 1, json_chunk, &out_data->humanoid);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "firstPerson") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_firstPerson) {
 				i = cgltf_parse_json_vrm_firstperson_v0_0(options, tokens, i + 1, json_chunk, &out_data->firstPerson);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "blendShapeMaster") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_blendShapeMaster) {
 				i = cgltf_parse_json_vrm_blendshape_v0_0(options, tokens, i + 1, json_chunk, &out_data->blendShapeMaster);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "secondaryAnimation") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_secondaryAnimation) {
 				i = cgltf_parse_json_vrm_secondaryanimation_v0_0(options, tokens, i + 1, json_chunk, &out_data->secondaryAnimation);
-			} else if (cgltf_json_strcmp(tokens + i, json_chunk, "materialProperties") == 0) {
+			} else if (tokens[i].key == cgltf_vrm_json_key_v0_0_materialProperties) {
 				i = cgltf_parse_json_array(options, tokens, i + 1, json_chunk, sizeof(cgltf_vrm_material_v0_0), (void**)&out_data->materialProperties, &out_data->materialProperties_count);
 				if (i < 0) return i;
 				for (cgltf_size k = 0; k < out_data->materialProperties_count; k++) {
@@ -371,20 +371,33 @@ static void cgltf_write_vrm_v0_0(cgltf_write_context* context, const cgltf_vrm_v
 	cgltf_write_line(context, "{");
 	cgltf_write_strprop(context, "exporterVersion", data->exporterVersion);
 	cgltf_write_strprop(context, "specVersion", data->specVersion);
-	cgltf_write_line(context, "\"meta\": ");
-	cgltf_write_vrm_meta_v0_0(context, &data->meta);
-	cgltf_write_line(context, "\"humanoid\": ");
-	cgltf_write_vrm_humanoid_v0_0(context, &data->humanoid);
-	cgltf_write_line(context, "\"firstPerson\": ");
-	cgltf_write_vrm_firstperson_v0_0(context, &data->firstPerson);
-	cgltf_write_line(context, "\"blendShapeMaster\": ");
-	cgltf_write_vrm_blendshape_v0_0(context, &data->blendShapeMaster);
-	cgltf_write_line(context, "\"secondaryAnimation\": ");
-	cgltf_write_vrm_secondaryanimation_v0_0(context, &data->secondaryAnimation);
-	cgltf_write_line(context, "\"materialProperties\": [");
-	for (cgltf_size i = 0; i < data->materialProperties_count; ++i) {
-		cgltf_write_vrm_material_v0_0(context, data->materialProperties + i);
+	const cgltf_vrm_spans_v0_0* spans = &context->data->vrm_v0_0_spans;
+	if (!cgltf_write_span(context, "meta", &spans->meta)) {
+		cgltf_write_line(context, "\"meta\": ");
+		cgltf_write_vrm_meta_v0_0(context, &data->meta);
+	}
+	if (!cgltf_write_span(context, "humanoid", &spans->humanoid)) {
+		cgltf_write_line(context, "\"humanoid\": ");
+		cgltf_write_vrm_humanoid_v0_0(context, &data->humanoid);
+	}
+	if (!cgltf_write_span(context, "firstPerson", &spans->firstPerson)) {
+		cgltf_write_line(context, "\"firstPerson\": ");
+		cgltf_write_vrm_firstperson_v0_0(context, &data->firstPerson);
+	}
+	if (!cgltf_write_span(context, "blendShapeMaster", &spans->blendShapeMaster)) {
+		cgltf_write_line(context, "\"blendShapeMaster\": ");
+		cgltf_write_vrm_blendshape_v0_0(context, &data->blendShapeMaster);
+	}
+	if (!cgltf_write_span(context, "secondaryAnimation", &spans->secondaryAnimation)) {
+		cgltf_write_line(context, "\"secondaryAnimation\": ");
+		cgltf_write_vrm_secondaryanimation_v0_0(context, &data->secondaryAnimation);
+	}
+	if (!cgltf_write_span(context, "materialProperties", &spans->materialProperties)) {
+		cgltf_write_line(context, "\"materialProperties\": [");
+		for (cgltf_size i = 0; i < data->materialProperties_count; ++i) {
+			cgltf_write_vrm_material_v0_0(context, data->materialProperties + i);
+		}
+		cgltf_write_line(context, "]");
 	}
-	cgltf_write_line(context, "]");
 	cgltf_write_line(context, "}");
 }
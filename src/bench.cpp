@@ -0,0 +1,639 @@
+#include "vrmpack.hpp"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace VRM;
+
+// synthetic avatars are built from the parts that dominate real VRM files: a skinned body, hair cards, a face with many
+// morph targets and lots of small accessories; sizes scale tessellation and counts, not the structure
+struct AvatarSize
+{
+	const char* name;
+	int scale;
+};
+
+static const AvatarSize kSizes[] = {
+    {"small", 1},
+    {"medium", 2},
+    {"large", 4},
+};
+
+static const int kJointCount = 8;
+static const float kPi = 3.14159265f;
+
+struct Geometry
+{
+	std::vector<float> positions;
+	std::vector<float> normals;
+	std::vector<float> uvs;
+	std::vector<uint16_t> joints;
+	std::vector<float> weights;
+	std::vector<uint32_t> indices;
+	std::vector<std::vector<float> > targets;
+};
+
+struct Builder
+{
+	std::vector<char> bin;
+
+	std::string views;
+	int view_count;
+
+	std::string accessors;
+	int accessor_count;
+};
+
+static std::string format(const char* fmt, ...)
+{
+	char buffer[1024];
+
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(buffer, sizeof(buffer), fmt, args);
+	va_end(args);
+
+	return buffer;
+}
+
+static int addView(Builder& builder, const void* data, size_t size, int target)
+{
+	builder.bin.resize((builder.bin.size() + 3) & ~size_t(3), 0);
+
+	size_t offset = builder.bin.size();
+	builder.bin.insert(builder.bin.end(), static_cast<const char*>(data), static_cast<const char*>(data) + size);
+
+	builder.views += format("%s{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d", builder.view_count ? "," : "", int(offset), int(size));
+	builder.views += target ? format(",\"target\":%d}", target) : "}";
+
+	return builder.view_count++;
+}
+
+static int addAccessor(Builder& builder, const void* data, size_t count, int component_type, size_t component_size, int components, int target, const std::string& bounds = std::string())
+{
+	static const char* const kTypes[] = {"", "SCALAR", "VEC2", "VEC3", "VEC4", "", "", "", "", "", "", "", "", "", "", "", "MAT4"};
+
+	int view = addView(builder, data, count * component_size * components, target);
+
+	builder.accessors += format("%s{\"bufferView\":%d,\"componentType\":%d,\"count\":%d,\"type\":\"%s\"", builder.accessor_count ? "," : "", view, component_type, int(count), kTypes[components]);
+	builder.accessors += bounds + "}";
+
+	return builder.accessor_count++;
+}
+
+static int addFloats(Builder& builder, const std::vector<float>& data, int components, int target, bool bounds = false)
+{
+	std::string minmax;
+
+	if (bounds && !data.empty())
+	{
+		float lo[3] = {data[0], data[1], data[2]}, hi[3] = {data[0], data[1], data[2]};
+
+		for (size_t i = 0; i < data.size(); i += 3)
+			for (int k = 0; k < 3; ++k)
+			{
+				lo[k] = std::min(lo[k], data[i + k]);
+				hi[k] = std::max(hi[k], data[i + k]);
+			}
+
+		minmax = format(",\"min\":[%g,%g,%g],\"max\":[%g,%g,%g]", lo[0], lo[1], lo[2], hi[0], hi[1], hi[2]);
+	}
+
+	return addAccessor(builder, data.data(), data.size() / components, 5126, sizeof(float), components, target, minmax);
+}
+
+typedef void (*SurfaceFunction)(float u, float v, const float* params, float* position, float* normal);
+
+// appends a (columns + 1) x (rows + 1) vertex grid; seams are duplicated so that UVs stay continuous, like exported meshes
+static void addGrid(Geometry& geometry, int columns, int rows, SurfaceFunction surface, const float* params)
+{
+	uint32_t base = uint32_t(geometry.positions.size() / 3);
+
+	for (int y = 0; y <= rows; ++y)
+		for (int x = 0; x <= columns; ++x)
+		{
+			float u = float(x) / float(columns), v = float(y) / float(rows);
+			float position[3], normal[3];
+			surface(u, v, params, position, normal);
+
+			geometry.positions.insert(geometry.positions.end(), position, position + 3);
+			geometry.normals.insert(geometry.normals.end(), normal, normal + 3);
+			geometry.uvs.push_back(u);
+			geometry.uvs.push_back(v);
+		}
+
+	for (int y = 0; y < rows; ++y)
+		for (int x = 0; x < columns; ++x)
+		{
+			uint32_t a = base + y * (columns + 1) + x;
+			uint32_t quad[6] = {a, a + 1, a + columns + 2, a, a + columns + 2, a + columns + 1};
+			geometry.indices.insert(geometry.indices.end(), quad, quad + 6);
+		}
+}
+
+static void bodySurface(float u, float v, const float*, float* position, float* normal)
+{
+	float radius = 0.15f + 0.04f * sinf(v * 9.f);
+	float c = cosf(2 * kPi * u), s = sinf(2 * kPi * u);
+
+	position[0] = radius * c;
+	position[1] = 1.6f * v;
+	position[2] = radius * s;
+
+	normal[0] = c;
+	normal[1] = 0;
+	normal[2] = s;
+}
+
+// params: center xyz, radius
+static void sphereSurface(float u, float v, const float* params, float* position, float* normal)
+{
+	float theta = kPi * v, phi = 2 * kPi * u;
+
+	normal[0] = sinf(theta) * cosf(phi);
+	normal[1] = cosf(theta);
+	normal[2] = sinf(theta) * sinf(phi);
+
+	for (int k = 0; k < 3; ++k)
+		position[k] = params[k] + params[3] * normal[k];
+}
+
+// params: angle
+static void hairSurface(float u, float v, const float* params, float* position, float* normal)
+{
+	float c = cosf(params[0]), s = sinf(params[0]);
+
+	position[0] = (0.11f + 0.05f * v) * c - (u - 0.5f) * 0.03f * s;
+	position[1] = 1.82f - 0.4f * v;
+	position[2] = (0.11f + 0.05f * v) * s + (u - 0.5f) * 0.03f * c;
+
+	normal[0] = c;
+	normal[1] = 0;
+	normal[2] = s;
+}
+
+static void buildBody(Geometry& geometry, int scale)
+{
+	addGrid(geometry, 32 * scale, 24 * scale, bodySurface, NULL);
+
+	// each vertex is weighted between the two joints of the vertical chain closest to it
+	for (size_t i = 0; i < geometry.positions.size() / 3; ++i)
+	{
+		float t = geometry.positions[i * 3 + 1] / 1.6f * (kJointCount - 1);
+		int j0 = std::min(int(t), kJointCount - 1);
+		int j1 = std::min(j0 + 1, kJointCount - 1);
+		float w1 = t - float(j0);
+
+		uint16_t joints[4] = {uint16_t(j0), uint16_t(j1), 0, 0};
+		float weights[4] = {1 - w1, w1, 0, 0};
+
+		geometry.joints.insert(geometry.joints.end(), joints, joints + 4);
+		geometry.weights.insert(geometry.weights.end(), weights, weights + 4);
+	}
+}
+
+static void buildFace(Geometry& geometry, int scale, int morph_count)
+{
+	const float params[4] = {0, 1.75f, 0, 0.12f};
+	addGrid(geometry, 24 * scale, 16 * scale, sphereSurface, params);
+
+	size_t vertex_count = geometry.positions.size() / 3;
+
+	// every target bulges a different region, stored densely like most exporters do
+	for (int k = 0; k < morph_count; ++k)
+	{
+		float y = 1 - 2 * (float(k) + 0.5f) / float(morph_count);
+		float r = sqrtf(1 - y * y), a = float(k) * 2.39996f;
+		float direction[3] = {r * cosf(a), y, r * sinf(a)};
+
+		std::vector<float> deltas(vertex_count * 3);
+
+		for (size_t i = 0; i < vertex_count; ++i)
+		{
+			const float* n = &geometry.normals[i * 3];
+			float weight = std::max(0.f, n[0] * direction[0] + n[1] * direction[1] + n[2] * direction[2] - 0.8f) * 5.f;
+
+			for (int c = 0; c < 3; ++c)
+				deltas[i * 3 + c] = n[c] * 0.01f * weight;
+		}
+
+		geometry.targets.push_back(deltas);
+	}
+}
+
+static void buildHair(Geometry& geometry, int scale)
+{
+	int strips = 16 * scale;
+
+	for (int i = 0; i < strips; ++i)
+	{
+		float params[1] = {2 * kPi * float(i) / float(strips)};
+		addGrid(geometry, 2, 12 * scale, hairSurface, params);
+	}
+}
+
+static void buildAccessory(Geometry& geometry, int index, int count)
+{
+	float a = 2 * kPi * float(index) / float(count);
+	const float params[4] = {0.2f * cosf(a), 0.4f + 1.2f * float(index) / float(count), 0.2f * sinf(a), 0.02f};
+
+	addGrid(geometry, 8, 6, sphereSurface, params);
+}
+
+static std::string addPrimitive(Builder& builder, const Geometry& geometry, int material)
+{
+	std::string result = format("{\"attributes\":{\"POSITION\":%d,\"NORMAL\":%d,\"TEXCOORD_0\":%d",
+	                            addFloats(builder, geometry.positions, 3, 34962, true), addFloats(builder, geometry.normals, 3, 34962), addFloats(builder, geometry.uvs, 2, 34962));
+
+	if (!geometry.joints.empty())
+	{
+		int joints = addAccessor(builder, geometry.joints.data(), geometry.joints.size() / 4, 5123, sizeof(uint16_t), 4, 34962);
+		result += format(",\"JOINTS_0\":%d,\"WEIGHTS_0\":%d", joints, addFloats(builder, geometry.weights, 4, 34962));
+	}
+
+	int indices = addAccessor(builder, geometry.indices.data(), geometry.indices.size(), 5125, sizeof(uint32_t), 1, 34963);
+	result += format("},\"indices\":%d,\"material\":%d", indices, material);
+
+	if (!geometry.targets.empty())
+	{
+		std::string names;
+		result += ",\"targets\":[";
+
+		for (size_t i = 0; i < geometry.targets.size(); ++i)
+		{
+			result += format("%s{\"POSITION\":%d}", i ? "," : "", addFloats(builder, geometry.targets[i], 3, 0, true));
+			names += format("%s\"Morph%d\"", i ? "," : "", int(i));
+		}
+
+		result += "],\"extras\":{\"targetNames\":[" + names + "]}";
+	}
+
+	return result + "}";
+}
+
+static int addImage(Builder& builder, int size, int seed)
+{
+	Image image;
+	image.width = size;
+	image.height = size;
+	image.pixels.resize(size * size * 4);
+
+	for (int y = 0; y < size; ++y)
+		for (int x = 0; x < size; ++x)
+		{
+			uint8_t* pixel = &image.pixels[(y * size + x) * 4];
+			pixel[0] = uint8_t(x * 255 / size);
+			pixel[1] = uint8_t(y * 255 / size);
+			pixel[2] = uint8_t((x ^ y) * seed);
+			pixel[3] = 255;
+		}
+
+	std::vector<uint8_t> png;
+	encodePng(image, png);
+
+	return addView(builder, png.data(), png.size(), 0);
+}
+
+static std::vector<char> buildAvatar(int scale, int morph_count)
+{
+	static const char* const kMaterials[] = {"Body", "Face", "Hair", "Accessory"};
+	const int material_count = 4;
+	const int accessory_count = 8 * scale;
+
+	Builder builder = {};
+	std::string meshes, materials, textures, images, properties;
+
+	Geometry body, face, hair;
+	buildBody(body, scale);
+	buildFace(face, scale, morph_count);
+	buildHair(hair, scale);
+
+	meshes += "{\"name\":\"Body\",\"primitives\":[" + addPrimitive(builder, body, 0) + "]}";
+	meshes += ",{\"name\":\"Face\",\"primitives\":[" + addPrimitive(builder, face, 1) + "]}";
+	meshes += ",{\"name\":\"Hair\",\"primitives\":[" + addPrimitive(builder, hair, 2) + "]}";
+
+	for (int i = 0; i < accessory_count; ++i)
+	{
+		Geometry accessory;
+		buildAccessory(accessory, i, accessory_count);
+		meshes += format(",{\"name\":\"Accessory%d\",\"primitives\":[", i) + addPrimitive(builder, accessory, 3) + "]}";
+	}
+
+	for (int i = 0; i < material_count; ++i)
+	{
+		int view = addImage(builder, 128 * scale, i + 1);
+		images += format("%s{\"name\":\"%s\",\"bufferView\":%d,\"mimeType\":\"image/png\"}", i ? "," : "", kMaterials[i], view);
+		textures += format("%s{\"source\":%d,\"sampler\":0}", i ? "," : "", i);
+		materials += format("%s{\"name\":\"%s\",\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":%d},\"metallicFactor\":0},\"extensions\":{\"KHR_materials_unlit\":{}}}", i ? "," : "", kMaterials[i], i);
+		properties += format("%s{\"name\":\"%s\",\"shader\":\"VRM/MToon\",\"renderQueue\":2000,\"floatProperties\":{\"_Cutoff\":0.5,\"_ShadeShift\":0.1},"
+		                     "\"vectorProperties\":{\"_Color\":[1,1,1,1],\"_MainTex\":[0,0,1,1]},\"textureProperties\":{\"_MainTex\":%d,\"_ShadeTexture\":%d},"
+		                     "\"keywordMap\":{},\"tagMap\":{\"RenderType\":\"Opaque\"}}",
+		                     i ? "," : "", kMaterials[i], i, i);
+	}
+
+	// joints form a vertical chain; inverse bind matrices undo each joint's translation
+	std::vector<float> inverse_bind(kJointCount * 16);
+	std::string nodes = "{\"name\":\"Root\",\"children\":[1";
+	for (int i = 0; i < 3 + accessory_count; ++i)
+		nodes += format(",%d", kJointCount + 1 + i);
+	nodes += "]}";
+
+	std::string joints;
+	for (int i = 0; i < kJointCount; ++i)
+	{
+		float* m = &inverse_bind[i * 16];
+		m[0] = m[5] = m[10] = m[15] = 1;
+		m[13] = -1.6f * float(i) / float(kJointCount - 1);
+
+		nodes += format(",{\"name\":\"Joint%d\",\"translation\":[0,%g,0]", i, i ? 1.6f / float(kJointCount - 1) : 0.f);
+		nodes += i + 1 < kJointCount ? format(",\"children\":[%d]}", i + 2) : "}";
+		joints += format("%s%d", i ? "," : "", i + 1);
+	}
+
+	int inverse_bind_accessor = addFloats(builder, inverse_bind, 16, 0);
+
+	nodes += format(",{\"name\":\"Body\",\"mesh\":0,\"skin\":0},{\"name\":\"Face\",\"mesh\":1},{\"name\":\"Hair\",\"mesh\":2}");
+	for (int i = 0; i < accessory_count; ++i)
+		nodes += format(",{\"name\":\"Accessory%d\",\"mesh\":%d}", i, 3 + i);
+
+	std::string groups;
+	for (int i = 0; i < morph_count; ++i)
+		groups += format("%s{\"name\":\"Morph%d\",\"presetName\":\"unknown\",\"binds\":[{\"mesh\":1,\"index\":%d,\"weight\":100}],\"materialValues\":[],\"isBinary\":false}", i ? "," : "", i, i);
+
+	std::string vrm = "{\"exporterVersion\":\"vrmpack_bench\",\"specVersion\":\"0.0\","
+	                  "\"meta\":{\"title\":\"bench\",\"version\":\"1\",\"author\":\"vrmpack\",\"texture\":0,\"allowedUserName\":\"Everyone\",\"licenseName\":\"CC0\"},"
+	                  "\"humanoid\":{\"humanBones\":[{\"bone\":\"hips\",\"node\":1,\"useDefaultValues\":true}]},"
+	                  "\"firstPerson\":{\"firstPersonBone\":1,\"meshAnnotations\":[{\"mesh\":0,\"firstPersonFlag\":\"Auto\"}],\"lookAtTypeName\":\"Bone\"},"
+	                  "\"blendShapeMaster\":{\"blendShapeGroups\":[" +
+	                  groups +
+	                  "]},"
+	                  "\"secondaryAnimation\":{\"boneGroups\":[],\"colliderGroups\":[]},"
+	                  "\"materialProperties\":[" +
+	                  properties + "]}";
+
+	builder.bin.resize((builder.bin.size() + 3) & ~size_t(3), 0);
+
+	std::string json = "{\"asset\":{\"version\":\"2.0\",\"generator\":\"vrmpack_bench\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],"
+	                   "\"nodes\":[" + nodes + "],\"skins\":[{\"joints\":[" + joints + "]," + format("\"inverseBindMatrices\":%d}],", inverse_bind_accessor) +
+	                   "\"meshes\":[" + meshes + "],\"materials\":[" + materials + "],\"textures\":[" + textures + "],\"images\":[" + images + "],"
+	                   "\"samplers\":[{\"magFilter\":9729,\"minFilter\":9729}],"
+	                   "\"accessors\":[" + builder.accessors + "],\"bufferViews\":[" + builder.views + "]," +
+	                   format("\"buffers\":[{\"byteLength\":%d}],", int(builder.bin.size())) +
+	                   "\"extensionsUsed\":[\"VRM\",\"KHR_materials_unlit\"],\"extensions\":{\"VRM\":" + vrm + "}}";
+
+	json.resize((json.size() + 3) & ~size_t(3), ' ');
+
+	// GLB constants are private to the cgltf implementation
+	uint32_t header[5] = {0x46546C67, 2, uint32_t(12 + 8 * 2 + json.size() + builder.bin.size()), uint32_t(json.size()), 0x4E4F534A};
+	uint32_t bin_header[2] = {uint32_t(builder.bin.size()), 0x004E4942};
+
+	std::vector<char> result;
+	result.insert(result.end(), reinterpret_cast<const char*>(header), reinterpret_cast<const char*>(header + 5));
+	result.insert(result.end(), json.begin(), json.end());
+	result.insert(result.end(), reinterpret_cast<const char*>(bin_header), reinterpret_cast<const char*>(bin_header + 2));
+	result.insert(result.end(), builder.bin.begin(), builder.bin.end());
+
+	return result;
+}
+
+struct Summary
+{
+	double median;
+	double p95;
+};
+
+static Summary summarize(std::vector<double> samples)
+{
+	std::sort(samples.begin(), samples.end());
+
+	// nearest-rank percentiles, so both are actual measurements
+	Summary result = {};
+	if (!samples.empty())
+	{
+		result.median = samples[(samples.size() - 1) / 2];
+		result.p95 = samples[size_t(ceil(0.95 * double(samples.size()))) - 1];
+	}
+
+	return result;
+}
+
+struct AvatarResult
+{
+	const char* name;
+	size_t input_size;
+	size_t output_size;
+	size_t triangles_before;
+	size_t triangles_after;
+	size_t primitives;
+
+	Summary stages[Stage_Count];
+	Summary total;
+};
+
+static bool writeJson(const char* path, const std::vector<AvatarResult>& results, int repetitions, const Settings& settings, int morph_count)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		fprintf(stderr, "Failed to write %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "{\n\t\"version\": \"%s\",\n", getVersion().c_str());
+	fprintf(file, "\t\"repetitions\": %d,\n\t\"simplify_threshold\": %g,\n\t\"texture_max\": %d,\n\t\"threads\": %d,\n\t\"morph_targets\": %d,\n",
+	        repetitions, settings.simplify_threshold, settings.texture_max, getThreadCount(settings.thread_count), morph_count);
+	fprintf(file, "\t\"avatars\": [");
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const AvatarResult& result = results[i];
+
+		fprintf(file, "%s\n\t\t{\n\t\t\t\"name\": \"%s\",\n", i ? "," : "", result.name);
+		fprintf(file, "\t\t\t\"input_size\": %d,\n\t\t\t\"output_size\": %d,\n", int(result.input_size), int(result.output_size));
+		fprintf(file, "\t\t\t\"primitives\": %d,\n\t\t\t\"triangles_before\": %d,\n\t\t\t\"triangles_after\": %d,\n", int(result.primitives), int(result.triangles_before), int(result.triangles_after));
+		fprintf(file, "\t\t\t\"total\": {\"median\": %.3f, \"p95\": %.3f},\n", result.total.median, result.total.p95);
+		fprintf(file, "\t\t\t\"stages\": {");
+
+		for (int j = 0; j < Stage_Count; ++j)
+			fprintf(file, "%s\n\t\t\t\t\"%s\": {\"median\": %.3f, \"p95\": %.3f}", j ? "," : "", getStageName(Stage(j)), result.stages[j].median, result.stages[j].p95);
+
+		fprintf(file, "\n\t\t\t}\n\t\t}");
+	}
+
+	fprintf(file, "\n\t]\n}\n");
+
+	if (fclose(file) != 0)
+	{
+		fprintf(stderr, "Failed to write %s\n", path);
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	Settings settings = getDefaultSettings();
+	settings.simplify_threshold = 0.5f;
+
+	int repetitions = 10;
+	int morph_count = 32;
+	const char* json_path = 0;
+	const char* dump_path = 0;
+	std::vector<bool> sizes(sizeof(kSizes) / sizeof(kSizes[0]), true);
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+
+		if (strcmp(arg, "-r") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+		{
+			repetitions = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-si") == 0 && i + 1 < argc)
+		{
+			settings.simplify_threshold = float(atof(argv[++i]));
+		}
+		else if (strcmp(arg, "-tmax") == 0 && i + 1 < argc)
+		{
+			settings.texture_max = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-morphs") == 0 && i + 1 < argc)
+		{
+			morph_count = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-size") == 0 && i + 1 < argc)
+		{
+			const char* name = argv[++i];
+			bool found = false;
+
+			for (size_t j = 0; j < sizes.size(); ++j)
+			{
+				sizes[j] = strcmp(kSizes[j].name, name) == 0;
+				found |= sizes[j];
+			}
+
+			if (!found)
+			{
+				fprintf(stderr, "Unknown size %s (expected small, medium or large)\n", name);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "-j") == 0 && i + 1 < argc)
+		{
+			settings.thread_count = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-json") == 0 && i + 1 < argc)
+		{
+			json_path = argv[++i];
+		}
+		else if (strcmp(arg, "-dump") == 0 && i + 1 < argc)
+		{
+			dump_path = argv[++i];
+		}
+		else
+		{
+			fprintf(stderr, "vrmpack_bench %s\n", getVersion().c_str());
+			fprintf(stderr, "Usage: vrmpack_bench [options]\n");
+			fprintf(stderr, "\t-r N: repetitions per avatar after one warmup run (default: 10)\n");
+			fprintf(stderr, "\t-si R: simplification ratio (default: 0.5)\n");
+			fprintf(stderr, "\t-tmax N: texture size limit (default: 0, no limit)\n");
+			fprintf(stderr, "\t-morphs N: morph targets on the face (default: 32)\n");
+			fprintf(stderr, "\t-size name: only run small, medium or large\n");
+			fprintf(stderr, "\t-j N: thread count (default: 0, one per hardware thread)\n");
+			fprintf(stderr, "\t-json file: write median and p95 timings as JSON\n");
+			fprintf(stderr, "\t-dump dir: also write the generated avatars to dir\n");
+			return strcmp(arg, "-h") == 0 ? 0 : 1;
+		}
+	}
+
+	std::vector<AvatarResult> results;
+
+	printf("%-8s %-14s %10s %10s\n", "avatar", "stage", "median ms", "p95 ms");
+
+	for (size_t s = 0; s < sizes.size(); ++s)
+	{
+		if (!sizes[s])
+			continue;
+
+		std::vector<char> input = buildAvatar(kSizes[s].scale, morph_count);
+
+		if (dump_path)
+		{
+			std::string path = std::string(dump_path) + "/" + kSizes[s].name + ".vrm";
+			std::ofstream out(path.c_str(), std::ios::binary);
+			out.write(input.data(), input.size());
+		}
+
+		AvatarResult result = {};
+		result.name = kSizes[s].name;
+		result.input_size = input.size();
+
+		std::vector<double> samples[Stage_Count];
+		std::vector<double> totals;
+
+		// the first run warms up caches and the worker pool and is not measured
+		for (int r = 0; r <= repetitions; ++r)
+		{
+			Report report = Report();
+			std::vector<char> output;
+
+			double start = getTime();
+			int status = vrmpack(input.data(), input.size(), output, settings, cgltf_memory_options(), &report);
+			double end = getTime();
+
+			if (status != 0)
+			{
+				fprintf(stderr, "Failed to process %s avatar\n", kSizes[s].name);
+				return 1;
+			}
+
+			if (r == 0)
+			{
+				result.output_size = output.size();
+				result.primitives = report.meshes.size();
+
+				for (size_t i = 0; i < report.meshes.size(); ++i)
+				{
+					result.triangles_before += report.meshes[i].triangles_before;
+					result.triangles_after += report.meshes[i].triangles_after;
+				}
+
+				continue;
+			}
+
+			for (int i = 0; i < Stage_Count; ++i)
+				samples[i].push_back(report.stages[i]);
+
+			totals.push_back(end - start);
+		}
+
+		for (int i = 0; i < Stage_Count; ++i)
+		{
+			result.stages[i] = summarize(samples[i]);
+
+			// reading is not part of in-memory processing, and other stages are skipped when their options are off
+			if (result.stages[i].p95 > 0)
+				printf("%-8s %-14s %10.2f %10.2f\n", result.name, getStageName(Stage(i)), result.stages[i].median, result.stages[i].p95);
+		}
+
+		result.total = summarize(totals);
+		printf("%-8s %-14s %10.2f %10.2f   (%d primitives, %d -> %d triangles, %d -> %d bytes)\n", result.name, "total", result.total.median, result.total.p95,
+		       int(result.primitives), int(result.triangles_before), int(result.triangles_after), int(result.input_size), int(result.output_size));
+
+		results.push_back(result);
+	}
+
+	if (json_path && !writeJson(json_path, results, repetitions, settings, morph_count))
+		return 1;
+
+	return 0;
+}
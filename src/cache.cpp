@@ -0,0 +1,198 @@
+#include "vrmpack.hpp"
+
+#include "meshoptimizer/src/meshoptimizer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+using namespace VRM;
+
+static const char kCacheMagic[4] = {'V', 'R', 'M', 'C'};
+static const char kCacheExtension[] = ".vrmc";
+
+// bump when the entry layout or the processing that produces it changes
+static const uint32_t kCacheVersion = 1;
+
+struct CacheHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint64_t vertex_count;
+	uint64_t source_index_count;
+	uint64_t index_count;
+};
+
+struct CacheKey
+{
+	uint64_t h1;
+	uint64_t h2;
+
+	void update(const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+		// two independent 64-bit hashes; entries also record their counts, so a 128-bit collision is the only way to get a wrong hit
+		for (size_t i = 0; i < size; ++i)
+		{
+			h1 = (h1 ^ bytes[i]) * 1099511628211ull;
+
+			h2 = (h2 ^ (bytes[i] * 0x9e3779b97f4a7c15ull)) * 0xff51afd7ed558ccdull;
+			h2 ^= h2 >> 29;
+		}
+	}
+
+	template <typename T>
+	void update(const T& value)
+	{
+		update(&value, sizeof(T));
+	}
+};
+
+std::string getCacheEntry(const char* directory, const Mesh& mesh, const Settings& settings)
+{
+	CacheKey key = {14695981039346656037ull, 0x6a09e667f3bcc908ull};
+
+	key.update(kCacheVersion);
+	key.update(int(VRMPACK_VERSION));
+	key.update(int(MESHOPTIMIZER_VERSION));
+
+	// only the settings that processMesh reads are part of the key
+	key.update(settings.simplify_threshold);
+	key.update(settings.simplify_aggressive);
+	key.update(settings.target_error);
+	key.update(settings.target_error_aggressive);
+
+	key.update(mesh.vertex_count);
+	key.update(mesh.vertex_positions_stride);
+	key.update(mesh.indices.size());
+	key.update(mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+	key.update(mesh.positions.data(), mesh.positions.size() * sizeof(cgltf_float));
+
+	char name[48];
+	snprintf(name, sizeof(name), "%016llx%016llx", (unsigned long long)key.h1, (unsigned long long)key.h2);
+
+	return std::string(directory) + "/" + name + kCacheExtension;
+}
+
+bool loadCachedMesh(const std::string& path, Mesh& mesh)
+{
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file)
+		return false;
+
+	CacheHeader header = {};
+	std::vector<uint32_t> indices;
+
+	bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, kCacheMagic, 4) == 0 && header.version == kCacheVersion &&
+	             header.vertex_count == mesh.vertex_count && header.source_index_count == mesh.indices.size() && header.index_count <= mesh.indices.size();
+
+	if (valid)
+	{
+		indices.resize(size_t(header.index_count));
+		valid = indices.empty() || fread(&indices[0], sizeof(uint32_t), indices.size(), file) == indices.size();
+	}
+
+	fclose(file);
+
+	// a truncated or corrupted entry is treated as a miss and overwritten after processing
+	for (size_t i = 0; i < indices.size() && valid; ++i)
+		valid = indices[i] < mesh.vertex_count;
+
+	if (!valid)
+		return false;
+
+	// hits refresh the modification time, which is what eviction orders entries by
+	touchFile(path.c_str());
+
+	mesh.indices.swap(indices);
+	return true;
+}
+
+bool storeCachedMesh(const std::string& path, const Mesh& mesh, size_t source_index_count)
+{
+	CacheHeader header = {};
+	memcpy(header.magic, kCacheMagic, 4);
+	header.version = kCacheVersion;
+	header.vertex_count = mesh.vertex_count;
+	header.source_index_count = source_index_count;
+	header.index_count = mesh.indices.size();
+
+	// write to a unique temporary name and rename so that concurrent runs sharing the directory never observe partial entries
+	static std::atomic<unsigned int> counter(0);
+
+	char suffix[64];
+	snprintf(suffix, sizeof(suffix), ".%x.%x.tmp", unsigned(std::hash<std::thread::id>()(std::this_thread::get_id())), counter++);
+
+	std::string temp = path + suffix;
+
+	FILE* file = fopen(temp.c_str(), "wb");
+	if (!file)
+		return false;
+
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1 && (mesh.indices.empty() || fwrite(&mesh.indices[0], sizeof(uint32_t), mesh.indices.size(), file) == mesh.indices.size());
+	ok &= fclose(file) == 0;
+
+	if (ok && rename(temp.c_str(), path.c_str()) == 0)
+		return true;
+
+	remove(temp.c_str());
+	return false;
+}
+
+struct CacheFile
+{
+	std::string path;
+	uint64_t size;
+	int64_t mtime;
+};
+
+void trimCache(const char* directory, uint64_t limit, int verbose)
+{
+	std::vector<std::string> names;
+	if (!listDirectory(directory, names))
+		return;
+
+	std::vector<CacheFile> files;
+	uint64_t total = 0;
+
+	size_t extension_length = strlen(kCacheExtension);
+
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		const std::string& name = names[i];
+
+		// only touch our own entries; other files in the directory are left alone
+		if (name.size() <= extension_length || name.compare(name.size() - extension_length, extension_length, kCacheExtension) != 0)
+			continue;
+
+		CacheFile file = {std::string(directory) + "/" + name, 0, 0};
+
+		if (!getFileInfo(file.path.c_str(), file.size, file.mtime))
+			continue;
+
+		files.push_back(file);
+		total += file.size;
+	}
+
+	if (total <= limit)
+		return;
+
+	// least recently used first; ties are broken by path to keep eviction deterministic
+	std::sort(files.begin(), files.end(), [](const CacheFile& l, const CacheFile& r) { return l.mtime != r.mtime ? l.mtime < r.mtime : l.path < r.path; });
+
+	size_t evicted = 0;
+
+	for (size_t i = 0; i < files.size() && total > limit; ++i)
+		if (remove(files[i].path.c_str()) == 0)
+		{
+			total -= files[i].size;
+			evicted++;
+		}
+
+	if (verbose)
+		fprintf(stderr, "cache: evicted %d entries, %.1f MB in use\n", int(evicted), double(total) / (1024 * 1024));
+}
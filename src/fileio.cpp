@@ -0,0 +1,69 @@
+#include "vrmpack.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <sys/utime.h>
+#else
+#include <dirent.h>
+#include <utime.h>
+#endif
+
+bool listDirectory(const char* path, std::vector<std::string>& result)
+{
+#ifdef _WIN32
+	std::string pattern = std::string(path) + "/*";
+
+	_finddata_t entry;
+	intptr_t handle = _findfirst(pattern.c_str(), &entry);
+
+	if (handle == -1)
+		return false;
+
+	do
+	{
+		if (!(entry.attrib & _A_SUBDIR))
+			result.push_back(entry.name);
+	} while (_findnext(handle, &entry) == 0);
+
+	_findclose(handle);
+#else
+	DIR* dir = opendir(path);
+
+	if (!dir)
+		return false;
+
+	while (dirent* entry = readdir(dir))
+	{
+		if (entry->d_name[0] != '.')
+			result.push_back(entry->d_name);
+	}
+
+	closedir(dir);
+#endif
+
+	return true;
+}
+
+bool getFileInfo(const char* path, uint64_t& size, int64_t& mtime)
+{
+	struct stat info;
+
+	if (stat(path, &info) != 0)
+		return false;
+
+	size = uint64_t(info.st_size);
+	mtime = int64_t(info.st_mtime);
+	return true;
+}
+
+void touchFile(const char* path)
+{
+#ifdef _WIN32
+	_utime(path, NULL);
+#else
+	utime(path, NULL);
+#endif
+}
@@ -0,0 +1,211 @@
+#include "vrmpack.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+using namespace VRM;
+
+// mutation fuzzer for the image decoders, which parse untrusted input from files, -serve and the C library; it only
+// finds memory errors when built with sanitizers, e.g. -DCMAKE_CXX_FLAGS="-fsanitize=address,undefined"
+
+struct Regression
+{
+	const char* name;
+	std::vector<uint8_t> data;
+};
+
+// inputs that used to write out of bounds; every one of them must be rejected
+static std::vector<Regression> getRegressions()
+{
+	std::vector<Regression> result;
+
+	// DHT segment with three 1-bit codes, which overflowed the 9-bit fast lookup table
+	static const uint8_t kHuffmanOverflow[] = {
+	    0xff, 0xd8,
+	    0xff, 0xc4, 0x00, 0x16, 0x00,
+	    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	    1, 2, 3,
+	    0xff, 0xd9,
+	};
+
+	Regression huffman = {"jpeg huffman overflow", std::vector<uint8_t>(kHuffmanOverflow, kHuffmanOverflow + sizeof(kHuffmanOverflow))};
+	result.push_back(huffman);
+
+	return result;
+}
+
+static bool decode(const std::vector<uint8_t>& data, Image& image)
+{
+	if (data.size() >= 2 && data[0] == 0xff && data[1] == 0xd8)
+		return decodeJpeg(data.data(), data.size(), image);
+	else
+		return decodePng(data.data(), data.size(), image);
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& data)
+{
+	FILE* file = fopen(path, "rb");
+	if (!file)
+		return false;
+
+	uint8_t buffer[65536];
+	size_t read = 0;
+	while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		data.insert(data.end(), buffer, buffer + read);
+
+	fclose(file);
+	return true;
+}
+
+static Image getGradient(int width, int height)
+{
+	Image image;
+	image.width = width;
+	image.height = height;
+	image.pixels.resize(size_t(width) * height * 4);
+
+	for (int y = 0; y < height; ++y)
+		for (int x = 0; x < width; ++x)
+		{
+			uint8_t* pixel = &image.pixels[(size_t(y) * width + x) * 4];
+			pixel[0] = uint8_t(x * 255 / width);
+			pixel[1] = uint8_t(y * 255 / height);
+			pixel[2] = uint8_t((x ^ y) * 8);
+			pixel[3] = uint8_t(255 - x);
+		}
+
+	return image;
+}
+
+static uint32_t random(uint32_t& state)
+{
+	// xorshift32; deterministic so that failures reproduce from the seed
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+static void mutate(std::vector<uint8_t>& data, uint32_t& state)
+{
+	static const uint8_t kInteresting[] = {0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff};
+
+	int count = 1 + random(state) % 8;
+
+	for (int i = 0; i < count && !data.empty(); ++i)
+	{
+		size_t offset = random(state) % data.size();
+
+		switch (random(state) % 4)
+		{
+		case 0:
+			data[offset] ^= uint8_t(1 << (random(state) % 8));
+			break;
+
+		case 1:
+			data[offset] = kInteresting[random(state) % sizeof(kInteresting)];
+			break;
+
+		case 2:
+			data[offset] = uint8_t(random(state));
+			break;
+
+		case 3:
+			data.resize(offset + 1);
+			break;
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int iterations = 10000;
+	uint32_t seed = 1;
+	std::vector<std::string> paths;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+
+		if (strcmp(arg, "-n") == 0 && i + 1 < argc)
+		{
+			iterations = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-seed") == 0 && i + 1 < argc && atoi(argv[i + 1]) > 0)
+		{
+			seed = uint32_t(atoi(argv[++i]));
+		}
+		else if (arg[0] == '-')
+		{
+			fprintf(stderr, "Usage: vrmpack_fuzz [-n iterations] [-seed n] [image files...]\n");
+			return 1;
+		}
+		else
+		{
+			paths.push_back(arg);
+		}
+	}
+
+	std::vector<std::vector<uint8_t> > seeds;
+
+	for (size_t i = 0; i < paths.size(); ++i)
+	{
+		std::vector<uint8_t> data;
+		if (!readFile(paths[i].c_str(), data))
+		{
+			fprintf(stderr, "Error reading %s\n", paths[i].c_str());
+			return 1;
+		}
+
+		seeds.push_back(data);
+	}
+
+	if (seeds.empty())
+	{
+		Image gradient = getGradient(37, 29);
+
+		std::vector<uint8_t> jpeg, png;
+		if (!encodeJpeg(gradient, 90, jpeg) || !encodePng(gradient, png))
+		{
+			fprintf(stderr, "Error encoding seed images\n");
+			return 1;
+		}
+
+		seeds.push_back(jpeg);
+		seeds.push_back(png);
+	}
+
+	int failed = 0;
+	std::vector<Regression> regressions = getRegressions();
+
+	for (size_t i = 0; i < regressions.size(); ++i)
+	{
+		Image image;
+		if (decode(regressions[i].data, image))
+		{
+			fprintf(stderr, "regression: %s was accepted\n", regressions[i].name);
+			failed++;
+		}
+	}
+
+	uint32_t state = seed;
+	int decoded = 0;
+
+	for (int i = 0; i < iterations; ++i)
+	{
+		std::vector<uint8_t> data = seeds[i % seeds.size()];
+		mutate(data, state);
+
+		Image image;
+		decoded += decode(data, image);
+	}
+
+	printf("fuzz: %d regressions, %d failed; %d mutated inputs from %d seeds, %d decoded\n",
+	       int(regressions.size()), failed, iterations, int(seeds.size()), decoded);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,798 @@
+#include "vrmpack.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <unordered_map>
+
+using namespace VRM;
+
+int getTextureViews(cgltf_material& material, cgltf_texture_view* (&views)[kTextureViewCount])
+{
+	int count = 0;
+
+	views[count++] = &material.pbr_metallic_roughness.base_color_texture;
+	views[count++] = &material.pbr_metallic_roughness.metallic_roughness_texture;
+	views[count++] = &material.pbr_specular_glossiness.diffuse_texture;
+	views[count++] = &material.pbr_specular_glossiness.specular_glossiness_texture;
+	views[count++] = &material.clearcoat.clearcoat_texture;
+	views[count++] = &material.clearcoat.clearcoat_roughness_texture;
+	views[count++] = &material.clearcoat.clearcoat_normal_texture;
+	views[count++] = &material.transmission.transmission_texture;
+	views[count++] = &material.specular.specular_texture;
+	views[count++] = &material.sheen.sheen_color_texture;
+	views[count++] = &material.sheen.sheen_roughness_texture;
+	views[count++] = &material.normal_texture;
+	views[count++] = &material.occlusion_texture;
+	views[count++] = &material.emissive_texture;
+
+	return count;
+}
+
+static uint64_t hashBytes(const uint8_t* data, size_t size)
+{
+	// FNV-1a over 8-byte words with a byte tail; collisions are resolved by comparing contents
+	uint64_t h = 14695981039346656037ull;
+
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t word;
+		memcpy(&word, data + i, 8);
+		h = (h ^ word) * 1099511628211ull;
+	}
+	for (; i < size; ++i)
+		h = (h ^ data[i]) * 1099511628211ull;
+
+	return h ^ size;
+}
+
+static const uint8_t* getImageData(const cgltf_image& image, size_t& size)
+{
+	const cgltf_buffer_view* view = image.buffer_view;
+
+	const uint8_t* result = view ? cgltf_buffer_view_data(view) : NULL;
+
+	if (result)
+		size = view->size;
+
+	return result;
+}
+
+static bool isSameImage(const cgltf_image& lhs, const cgltf_image& rhs)
+{
+	size_t lhs_size = 0, rhs_size = 0;
+	const uint8_t* lhs_data = getImageData(lhs, lhs_size);
+	const uint8_t* rhs_data = getImageData(rhs, rhs_size);
+
+	if (lhs_size != rhs_size || memcmp(lhs_data, rhs_data, lhs_size) != 0)
+		return false;
+
+	const char* lhs_mime = lhs.mime_type ? lhs.mime_type : "";
+	const char* rhs_mime = rhs.mime_type ? rhs.mime_type : "";
+
+	return strcmp(lhs_mime, rhs_mime) == 0;
+}
+
+void freeExtensions(cgltf_data* data, cgltf_extension* extensions, cgltf_size count)
+{
+	for (cgltf_size i = 0; i < count; ++i)
+	{
+		data->memory.free(data->memory.user_data, extensions[i].name);
+		data->memory.free(data->memory.user_data, extensions[i].data);
+	}
+	data->memory.free(data->memory.user_data, extensions);
+}
+
+static void markTextures(cgltf_data* data, std::vector<bool>& used)
+{
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		cgltf_texture_view* views[kTextureViewCount];
+		int count = getTextureViews(data->materials[i], views);
+
+		for (int j = 0; j < count; ++j)
+			if (views[j]->texture)
+				used[views[j]->texture - data->textures] = true;
+	}
+
+	if (!data->has_vrm_v0_0)
+		return;
+
+	const cgltf_vrm_v0_0& vrm = data->vrm_v0_0;
+
+	for (cgltf_size i = 0; i < vrm.materialProperties_count; ++i)
+	{
+		const cgltf_vrm_material_v0_0& material = vrm.materialProperties[i];
+
+		for (cgltf_size j = 0; j < material.textureProperties_count; ++j)
+		{
+			cgltf_int index = material.textureProperties_values[j];
+			if (index >= 0 && cgltf_size(index) < data->textures_count)
+				used[index] = true;
+		}
+	}
+
+	if (vrm.meta.texture >= 0 && cgltf_size(vrm.meta.texture) < data->textures_count)
+		used[vrm.meta.texture] = true;
+}
+
+static void remapTextures(cgltf_data* data, const std::vector<int>& remap)
+{
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		cgltf_texture_view* views[kTextureViewCount];
+		int count = getTextureViews(data->materials[i], views);
+
+		for (int j = 0; j < count; ++j)
+			if (views[j]->texture)
+				views[j]->texture = &data->textures[remap[views[j]->texture - data->textures]];
+	}
+
+	if (!data->has_vrm_v0_0)
+		return;
+
+	cgltf_vrm_v0_0& vrm = data->vrm_v0_0;
+	cgltf_vrm_spans_v0_0& spans = data->vrm_v0_0_spans;
+
+	for (cgltf_size i = 0; i < vrm.materialProperties_count; ++i)
+	{
+		cgltf_vrm_material_v0_0& material = vrm.materialProperties[i];
+
+		for (cgltf_size j = 0; j < material.textureProperties_count; ++j)
+		{
+			cgltf_int& index = material.textureProperties_values[j];
+			if (index >= 0 && cgltf_size(index) < remap.size() && index != remap[index])
+			{
+				index = remap[index];
+				spans.materialProperties.dirty = true;
+			}
+		}
+	}
+
+	if (vrm.meta.texture >= 0 && cgltf_size(vrm.meta.texture) < remap.size() && vrm.meta.texture != remap[vrm.meta.texture])
+	{
+		vrm.meta.texture = remap[vrm.meta.texture];
+		spans.meta.dirty = true;
+	}
+}
+
+static void compactTextures(cgltf_data* data, const std::vector<bool>& used)
+{
+	// textures that end up pointing to the same image through the same sampler are merged as well
+	std::vector<int> remap(data->textures_count, -1);
+	std::vector<bool> primary(data->textures_count);
+	cgltf_size write = 0;
+
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+	{
+		const cgltf_texture& texture = data->textures[i];
+
+		if (!used[i])
+			continue;
+
+		for (cgltf_size j = 0; j < i && texture.extensions_count == 0; ++j)
+		{
+			const cgltf_texture& other = data->textures[j];
+
+			if (primary[j] && other.image == texture.image && other.sampler == texture.sampler && other.extensions_count == 0)
+			{
+				remap[i] = remap[j];
+				break;
+			}
+		}
+
+		if (remap[i] < 0)
+		{
+			remap[i] = int(write++);
+			primary[i] = true;
+		}
+	}
+
+	remapTextures(data, remap);
+
+	// textures only ever move to lower slots, so every slot is consumed before it is overwritten
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+	{
+		cgltf_texture& texture = data->textures[i];
+
+		if (primary[i])
+		{
+			if (cgltf_size(remap[i]) != i)
+				data->textures[remap[i]] = texture;
+			continue;
+		}
+
+		data->memory.free(data->memory.user_data, texture.name);
+		freeExtensions(data, texture.extensions, texture.extensions_count);
+	}
+
+	data->textures_count = write;
+}
+
+static void compactImages(cgltf_data* data, const std::vector<int>& remap, cgltf_size count, std::vector<bool>& views_freed)
+{
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+	{
+		cgltf_texture& texture = data->textures[i];
+
+		if (texture.image)
+		{
+			texture.image_index = remap[texture.image - data->images];
+			texture.image = &data->images[texture.image_index];
+		}
+	}
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+	{
+		cgltf_image& image = data->images[i];
+
+		if (remap[i] >= 0)
+		{
+			if (cgltf_size(remap[i]) != i)
+				data->images[remap[i]] = image;
+			continue;
+		}
+
+		if (image.buffer_view)
+			views_freed[image.buffer_view - data->buffer_views] = true;
+
+		data->memory.free(data->memory.user_data, image.name);
+		data->memory.free(data->memory.user_data, image.uri);
+		data->memory.free(data->memory.user_data, image.mime_type);
+		freeExtensions(data, image.extensions, image.extensions_count);
+	}
+
+	data->images_count = count;
+}
+
+static void compactBufferViews(cgltf_data* data, std::vector<bool>& views_freed)
+{
+	// only views that were owned by removed images are dropped; anything still referenced stays
+	for (cgltf_size i = 0; i < data->accessors_count; ++i)
+	{
+		const cgltf_accessor& accessor = data->accessors[i];
+
+		if (accessor.buffer_view)
+			views_freed[accessor.buffer_view - data->buffer_views] = false;
+
+		if (accessor.is_sparse)
+		{
+			views_freed[accessor.sparse.indices_buffer_view - data->buffer_views] = false;
+			views_freed[accessor.sparse.values_buffer_view - data->buffer_views] = false;
+		}
+	}
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+		if (data->images[i].buffer_view)
+			views_freed[data->images[i].buffer_view - data->buffer_views] = false;
+
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+		{
+			const cgltf_primitive& primitive = data->meshes[i].primitives[j];
+
+			if (primitive.has_draco_mesh_compression && primitive.draco_mesh_compression.buffer_view)
+				views_freed[primitive.draco_mesh_compression.buffer_view - data->buffer_views] = false;
+		}
+
+	std::vector<cgltf_size> remap(data->buffer_views_count);
+	cgltf_size write = 0;
+
+	for (cgltf_size i = 0; i < data->buffer_views_count; ++i)
+	{
+		cgltf_buffer_view& view = data->buffer_views[i];
+
+		if (views_freed[i])
+		{
+			data->memory.free(data->memory.user_data, view.data);
+			freeExtensions(data, view.extensions, view.extensions_count);
+			continue;
+		}
+
+		remap[i] = write;
+		data->buffer_views[write++] = view;
+	}
+
+	if (write == data->buffer_views_count)
+		return;
+
+	for (cgltf_size i = 0; i < data->accessors_count; ++i)
+	{
+		cgltf_accessor& accessor = data->accessors[i];
+
+		if (accessor.buffer_view)
+			accessor.buffer_view = &data->buffer_views[remap[accessor.buffer_view - data->buffer_views]];
+
+		if (accessor.is_sparse)
+		{
+			accessor.sparse.indices_buffer_view = &data->buffer_views[remap[accessor.sparse.indices_buffer_view - data->buffer_views]];
+			accessor.sparse.values_buffer_view = &data->buffer_views[remap[accessor.sparse.values_buffer_view - data->buffer_views]];
+		}
+	}
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+		if (data->images[i].buffer_view)
+			data->images[i].buffer_view = &data->buffer_views[remap[data->images[i].buffer_view - data->buffer_views]];
+
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+		{
+			cgltf_primitive& primitive = data->meshes[i].primitives[j];
+
+			if (primitive.has_draco_mesh_compression && primitive.draco_mesh_compression.buffer_view)
+				primitive.draco_mesh_compression.buffer_view = &data->buffer_views[remap[primitive.draco_mesh_compression.buffer_view - data->buffer_views]];
+		}
+
+	data->buffer_views_count = write;
+}
+
+void processImages(cgltf_data* data)
+{
+	std::vector<bool> textures_used(data->textures_count);
+	markTextures(data, textures_used);
+
+	// merge images with identical embedded payloads; the first occurrence wins
+	std::vector<int> image_canonical(data->images_count);
+	std::unordered_map<uint64_t, std::vector<size_t> > image_hashes;
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+	{
+		image_canonical[i] = int(i);
+
+		size_t size = 0;
+		const uint8_t* bytes = getImageData(data->images[i], size);
+
+		if (!bytes)
+			continue;
+
+		std::vector<size_t>& candidates = image_hashes[hashBytes(bytes, size)];
+
+		for (size_t j = 0; j < candidates.size(); ++j)
+			if (isSameImage(data->images[candidates[j]], data->images[i]))
+			{
+				image_canonical[i] = int(candidates[j]);
+				break;
+			}
+
+		if (image_canonical[i] == int(i))
+			candidates.push_back(i);
+	}
+
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+	{
+		cgltf_texture& texture = data->textures[i];
+
+		if (texture.image)
+			texture.image = &data->images[image_canonical[texture.image - data->images]];
+	}
+
+	compactTextures(data, textures_used);
+
+	// images that no surviving texture points to are dropped along with their buffer views
+	std::vector<bool> images_used(data->images_count);
+
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+		if (data->textures[i].image)
+			images_used[data->textures[i].image - data->images] = true;
+
+	std::vector<int> image_remap(data->images_count, -1);
+	cgltf_size image_count = 0;
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+		if (images_used[i])
+			image_remap[i] = int(image_count++);
+
+	std::vector<bool> views_freed(data->buffer_views_count);
+
+	compactImages(data, image_remap, image_count, views_freed);
+	compactBufferViews(data, views_freed);
+}
+
+enum ImageKind
+{
+	ImageKind_Data,
+	ImageKind_Color,
+	ImageKind_Normal,
+};
+
+static void markImageKind(cgltf_data* data, std::vector<ImageKind>& kinds, const cgltf_texture* texture, ImageKind kind)
+{
+	if (!texture || !texture->image)
+		return;
+
+	ImageKind& target = kinds[texture->image - data->images];
+
+	// an image shared between slots gets the most restrictive treatment: normal > color > data
+	if (kind > target)
+		target = kind;
+}
+
+static ImageKind getPropertyKind(const char* name)
+{
+	static const char* const kColorProperties[] = {"_MainTex", "_ShadeTexture", "_EmissionMap", "_SphereAdd", "_RimTexture"};
+
+	if (strcmp(name, "_BumpMap") == 0)
+		return ImageKind_Normal;
+
+	for (size_t i = 0; i < sizeof(kColorProperties) / sizeof(kColorProperties[0]); ++i)
+		if (strcmp(name, kColorProperties[i]) == 0)
+			return ImageKind_Color;
+
+	return ImageKind_Data;
+}
+
+static void classifyImages(cgltf_data* data, std::vector<ImageKind>& kinds)
+{
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		const cgltf_material& material = data->materials[i];
+
+		markImageKind(data, kinds, material.pbr_metallic_roughness.base_color_texture.texture, ImageKind_Color);
+		markImageKind(data, kinds, material.pbr_specular_glossiness.diffuse_texture.texture, ImageKind_Color);
+		markImageKind(data, kinds, material.sheen.sheen_color_texture.texture, ImageKind_Color);
+		markImageKind(data, kinds, material.emissive_texture.texture, ImageKind_Color);
+		markImageKind(data, kinds, material.normal_texture.texture, ImageKind_Normal);
+		markImageKind(data, kinds, material.clearcoat.clearcoat_normal_texture.texture, ImageKind_Normal);
+	}
+
+	if (!data->has_vrm_v0_0)
+		return;
+
+	const cgltf_vrm_v0_0& vrm = data->vrm_v0_0;
+
+	for (cgltf_size i = 0; i < vrm.materialProperties_count; ++i)
+	{
+		const cgltf_vrm_material_v0_0& material = vrm.materialProperties[i];
+
+		for (cgltf_size j = 0; j < material.textureProperties_count; ++j)
+		{
+			cgltf_int index = material.textureProperties_values[j];
+			if (index >= 0 && cgltf_size(index) < data->textures_count)
+				markImageKind(data, kinds, &data->textures[index], getPropertyKind(material.textureProperties_keys[j]));
+		}
+	}
+
+	if (vrm.meta.texture >= 0 && cgltf_size(vrm.meta.texture) < data->textures_count)
+		markImageKind(data, kinds, &data->textures[vrm.meta.texture], ImageKind_Color);
+}
+
+struct SrgbTables
+{
+	float to_linear[256];
+	uint8_t from_linear[4096];
+
+	SrgbTables()
+	{
+		for (int i = 0; i < 256; ++i)
+		{
+			float v = float(i) / 255.f;
+			to_linear[i] = v <= 0.04045f ? v / 12.92f : powf((v + 0.055f) / 1.055f, 2.4f);
+		}
+
+		for (int i = 0; i < 4096; ++i)
+		{
+			float v = float(i) / 4095.f;
+			float s = v <= 0.0031308f ? v * 12.92f : 1.055f * powf(v, 1.f / 2.4f) - 0.055f;
+			from_linear[i] = uint8_t(s * 255.f + 0.5f);
+		}
+	}
+};
+
+static const SrgbTables kSrgb;
+
+struct FilterTap
+{
+	int first;
+	std::vector<float> weights;
+};
+
+static float lanczos3(float x)
+{
+	const float pi = 3.14159265358979323846f;
+
+	if (x < 0)
+		x = -x;
+
+	if (x < 1e-5f)
+		return 1.f;
+
+	if (x >= 3.f)
+		return 0.f;
+
+	return 3.f * sinf(pi * x) * sinf(pi * x / 3.f) / (pi * pi * x * x);
+}
+
+static void buildTaps(std::vector<FilterTap>& taps, int source, int target, bool box)
+{
+	float scale = float(source) / float(target);
+	float support = box ? 0.5f * scale : 3.f * scale;
+
+	taps.resize(target);
+
+	for (int i = 0; i < target; ++i)
+	{
+		float center = (float(i) + 0.5f) * scale;
+		int first = int(floorf(center - support));
+		int last = int(ceilf(center + support));
+
+		FilterTap& tap = taps[i];
+		tap.first = first;
+		tap.weights.clear();
+
+		float total = 0;
+
+		for (int s = first; s < last; ++s)
+		{
+			// distance between the output sample center and the source pixel center, in output pixels
+			float x = (float(s) + 0.5f - center) / scale;
+			float w = box ? (x >= -0.5f && x < 0.5f ? 1.f : 0.f) : lanczos3(x);
+
+			tap.weights.push_back(w);
+			total += w;
+		}
+
+		for (size_t k = 0; k < tap.weights.size(); ++k)
+			tap.weights[k] /= total;
+	}
+}
+
+static void resampleImage(const Image& image, Image& result, int width, int height, ImageKind kind)
+{
+	size_t source_count = size_t(image.width) * image.height;
+	std::vector<float> source(source_count * 4);
+
+	for (size_t i = 0; i < source_count; ++i)
+	{
+		const uint8_t* pixel = &image.pixels[i * 4];
+		float* value = &source[i * 4];
+
+		value[3] = float(pixel[3]) / 255.f;
+
+		for (int c = 0; c < 3; ++c)
+		{
+			if (kind == ImageKind_Color)
+				value[c] = kSrgb.to_linear[pixel[c]] * value[3]; // premultiplied so that transparent texels do not bleed color
+			else if (kind == ImageKind_Normal)
+				value[c] = float(pixel[c]) / 127.5f - 1.f;
+			else
+				value[c] = float(pixel[c]) / 255.f;
+		}
+	}
+
+	// normal maps use a box filter; ringing from negative lobes skews averaged directions
+	bool box = kind == ImageKind_Normal;
+
+	std::vector<FilterTap> taps_x, taps_y;
+	buildTaps(taps_x, image.width, width, box);
+	buildTaps(taps_y, image.height, height, box);
+
+	std::vector<float> rows(size_t(width) * image.height * 4);
+
+	for (int y = 0; y < image.height; ++y)
+		for (int x = 0; x < width; ++x)
+		{
+			const FilterTap& tap = taps_x[x];
+			float sum[4] = {};
+
+			for (size_t k = 0; k < tap.weights.size(); ++k)
+			{
+				int sx = tap.first + int(k);
+				sx = sx < 0 ? 0 : sx >= image.width ? image.width - 1 : sx;
+
+				const float* value = &source[(size_t(y) * image.width + sx) * 4];
+				for (int c = 0; c < 4; ++c)
+					sum[c] += value[c] * tap.weights[k];
+			}
+
+			memcpy(&rows[(size_t(y) * width + x) * 4], sum, sizeof(sum));
+		}
+
+	result.width = width;
+	result.height = height;
+	result.pixels.resize(size_t(width) * height * 4);
+
+	for (int y = 0; y < height; ++y)
+		for (int x = 0; x < width; ++x)
+		{
+			const FilterTap& tap = taps_y[y];
+			float sum[4] = {};
+
+			for (size_t k = 0; k < tap.weights.size(); ++k)
+			{
+				int sy = tap.first + int(k);
+				sy = sy < 0 ? 0 : sy >= image.height ? image.height - 1 : sy;
+
+				const float* value = &rows[(size_t(sy) * width + x) * 4];
+				for (int c = 0; c < 4; ++c)
+					sum[c] += value[c] * tap.weights[k];
+			}
+
+			if (kind == ImageKind_Color)
+			{
+				float alpha = sum[3] < 0.f ? 0.f : sum[3] > 1.f ? 1.f : sum[3];
+				float scale = alpha > 0.f ? 1.f / alpha : 0.f;
+
+				for (int c = 0; c < 3; ++c)
+					sum[c] *= scale;
+			}
+			else if (kind == ImageKind_Normal)
+			{
+				// averaging shortens normals, so restore unit length before mapping back to [0, 1]
+				float length = sqrtf(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+				float scale = length > 0.f ? 1.f / length : 0.f;
+
+				for (int c = 0; c < 3; ++c)
+					sum[c] = sum[c] * scale * 0.5f + 0.5f;
+			}
+
+			for (int c = 0; c < 4; ++c)
+				sum[c] = sum[c] < 0.f ? 0.f : sum[c] > 1.f ? 1.f : sum[c];
+
+			uint8_t* pixel = &result.pixels[(size_t(y) * width + x) * 4];
+
+			for (int c = 0; c < 4; ++c)
+				pixel[c] = kind == ImageKind_Color && c < 3 ? kSrgb.from_linear[int(sum[c] * 4095.f + 0.5f)] : uint8_t(sum[c] * 255.f + 0.5f);
+		}
+}
+
+static bool isJpeg(const cgltf_image& image, const uint8_t* data, size_t size)
+{
+	if (image.mime_type)
+		return strcmp(image.mime_type, "image/jpeg") == 0;
+
+	return size >= 2 && data[0] == 0xff && data[1] == 0xd8;
+}
+
+static bool isPng(const cgltf_image& image, const uint8_t* data, size_t size)
+{
+	if (image.mime_type)
+		return strcmp(image.mime_type, "image/png") == 0;
+
+	return size >= 8 && memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0;
+}
+
+static const int kJpegQuality = 90;
+
+bool decodeImage(const cgltf_image& image, Image& result, bool& jpeg)
+{
+	size_t size = 0;
+	const uint8_t* bytes = getImageData(image, size);
+
+	if (!bytes)
+		return false;
+
+	jpeg = isJpeg(image, bytes, size);
+
+	if (!jpeg && !isPng(image, bytes, size))
+		return false;
+
+	return jpeg ? decodeJpeg(bytes, size, result) : decodePng(bytes, size, result);
+}
+
+bool encodeImage(const Image& image, bool jpeg, std::vector<uint8_t>& result)
+{
+	return jpeg ? encodeJpeg(image, kJpegQuality, result) : encodePng(image, result);
+}
+
+struct TextureJob
+{
+	size_t image;
+	ImageKind kind;
+
+	const uint8_t* bytes;
+	size_t size;
+	bool jpeg;
+
+	bool decoded;
+	int width, height;
+	int target_width, target_height;
+	std::vector<uint8_t> encoded;
+};
+
+static void runTextureJob(TextureJob& job, int texture_max)
+{
+	// jobs only read the source bytes and write their own result, so they can run concurrently
+	Image source = {};
+
+	job.decoded = job.jpeg ? decodeJpeg(job.bytes, job.size, source) : decodePng(job.bytes, job.size, source);
+	if (!job.decoded)
+		return;
+
+	job.width = source.width;
+	job.height = source.height;
+
+	int longest = source.width > source.height ? source.width : source.height;
+
+	if (longest <= texture_max)
+		return;
+
+	double scale = double(texture_max) / double(longest);
+	int width = int(source.width * scale + 0.5);
+	int height = int(source.height * scale + 0.5);
+
+	Image target = {};
+	resampleImage(source, target, width < 1 ? 1 : width, height < 1 ? 1 : height, job.kind);
+
+	// release the full resolution pixels early; with many workers these dominate peak memory
+	std::vector<uint8_t>().swap(source.pixels);
+
+	if (!encodeImage(target, job.jpeg, job.encoded))
+	{
+		job.encoded.clear();
+		return;
+	}
+
+	job.target_width = target.width;
+	job.target_height = target.height;
+}
+
+void processTextures(cgltf_data* data, const Settings& settings)
+{
+	std::vector<ImageKind> kinds(data->images_count, ImageKind_Data);
+	classifyImages(data, kinds);
+
+	std::vector<TextureJob> jobs;
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+	{
+		const cgltf_image& image = data->images[i];
+
+		size_t size = 0;
+		const uint8_t* bytes = getImageData(image, size);
+
+		if (!bytes)
+			continue;
+
+		bool jpeg = isJpeg(image, bytes, size);
+
+		// images we cannot decode (external URIs, progressive JPEG, other formats) are kept as is
+		if (!jpeg && !isPng(image, bytes, size))
+		{
+			if (settings.verbose)
+				fprintf(stderr, "Warning: unable to decode image %d, keeping original\n", int(i));
+			continue;
+		}
+
+		TextureJob job = {};
+		job.image = i;
+		job.kind = kinds[i];
+		job.bytes = bytes;
+		job.size = size;
+		job.jpeg = jpeg;
+
+		jobs.push_back(job);
+	}
+
+	parallelFor(jobs.size(), settings.thread_count, [&](size_t i) { runTextureJob(jobs[i], settings.texture_max); });
+
+	// results are applied in image order so that output and logs do not depend on scheduling
+	for (size_t i = 0; i < jobs.size(); ++i)
+	{
+		TextureJob& job = jobs[i];
+
+		if (!job.decoded)
+		{
+			if (settings.verbose)
+				fprintf(stderr, "Warning: unable to decode image %d, keeping original\n", int(job.image));
+			continue;
+		}
+
+		if (job.encoded.empty())
+			continue;
+
+		if (settings.verbose)
+			fprintf(stderr, "image %d: %dx%d -> %dx%d, %d -> %d bytes\n", int(job.image), job.width, job.height, job.target_width, job.target_height, int(job.size), int(job.encoded.size()));
+
+		// the new payload replaces the view contents; processBuffers splices it back into the buffer
+		cgltf_buffer_view* view = data->images[job.image].buffer_view;
+
+		void* contents = data->memory.alloc(data->memory.user_data, job.encoded.size());
+		memcpy(contents, job.encoded.data(), job.encoded.size());
+
+		data->memory.free(data->memory.user_data, view->data);
+		view->data = contents;
+		view->size = job.encoded.size();
+	}
+}
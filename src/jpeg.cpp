@@ -0,0 +1,897 @@
+#include "vrmpack.hpp"
+
+#include <math.h>
+#include <string.h>
+
+// Baseline (sequential Huffman, 8-bit) JPEG codec; progressive and arithmetic-coded files are rejected by the decoder
+static const uint8_t kZigzag[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10,
+    17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63};
+
+struct DctTable
+{
+	// entries[x][u] = C(u) * cos((2x + 1) * u * pi / 16) / 2, shared by the forward and inverse transforms
+	float entries[8][8];
+
+	DctTable()
+	{
+		for (int x = 0; x < 8; ++x)
+			for (int u = 0; u < 8; ++u)
+				entries[x][u] = float((u == 0 ? sqrt(0.5) : 1.0) * cos((2 * x + 1) * u * 3.14159265358979323846 / 16) / 2);
+	}
+};
+
+static const DctTable kDct;
+
+static void inverseDct(const float* coefficients, uint8_t* result, size_t stride)
+{
+	float rows[64];
+
+	for (int v = 0; v < 8; ++v)
+		for (int x = 0; x < 8; ++x)
+		{
+			float sum = 0;
+			for (int u = 0; u < 8; ++u)
+				sum += kDct.entries[x][u] * coefficients[v * 8 + u];
+			rows[v * 8 + x] = sum;
+		}
+
+	for (int y = 0; y < 8; ++y)
+		for (int x = 0; x < 8; ++x)
+		{
+			float sum = 128.5f;
+			for (int v = 0; v < 8; ++v)
+				sum += kDct.entries[y][v] * rows[v * 8 + x];
+
+			result[y * stride + x] = uint8_t(sum < 0 ? 0 : sum > 255 ? 255 : int(sum));
+		}
+}
+
+static void forwardDct(const float* samples, float* result)
+{
+	float rows[64];
+
+	for (int y = 0; y < 8; ++y)
+		for (int u = 0; u < 8; ++u)
+		{
+			float sum = 0;
+			for (int x = 0; x < 8; ++x)
+				sum += kDct.entries[x][u] * samples[y * 8 + x];
+			rows[y * 8 + u] = sum;
+		}
+
+	for (int v = 0; v < 8; ++v)
+		for (int u = 0; u < 8; ++u)
+		{
+			float sum = 0;
+			for (int y = 0; y < 8; ++y)
+				sum += kDct.entries[y][v] * rows[y * 8 + u];
+			result[v * 8 + u] = sum;
+		}
+}
+
+struct JpegHuffman
+{
+	// fast entries store symbol | (length << 8) for codes up to 9 bits; 0 means the slow path is needed
+	uint16_t fast[1 << 9];
+
+	int maxcode[18];
+	int valptr[17];
+	int mincode[17];
+	uint8_t values[256];
+};
+
+static bool buildJpegHuffman(JpegHuffman& huffman, const uint8_t* counts, const uint8_t* values, int value_count)
+{
+	memset(&huffman, 0, sizeof(huffman));
+	memcpy(huffman.values, values, value_count);
+
+	int code = 0, index = 0;
+
+	for (int len = 1; len <= 16; ++len)
+	{
+		huffman.valptr[len] = index;
+		huffman.mincode[len] = code;
+
+		for (int i = 0; i < counts[len - 1]; ++i, ++code, ++index)
+		{
+			// a malformed table can assign more codes than the length allows, which would also overflow the fast table
+			if (code >= (1 << len))
+				return false;
+
+			if (len <= 9)
+			{
+				int shift = 9 - len;
+				for (int fill = 0; fill < (1 << shift); ++fill)
+					huffman.fast[(code << shift) | fill] = uint16_t(values[index] | (len << 8));
+			}
+		}
+
+		huffman.maxcode[len] = counts[len - 1] ? code - 1 : -1;
+
+		code <<= 1;
+	}
+
+	huffman.maxcode[17] = 0x7fffffff;
+	return true;
+}
+
+struct JpegReader
+{
+	const uint8_t* data;
+	size_t size;
+	size_t offset;
+
+	uint32_t bits;
+	int count;
+	bool marker;
+};
+
+static void fillBits(JpegReader& reader)
+{
+	while (reader.count <= 24)
+	{
+		unsigned int byte = 0;
+
+		if (!reader.marker && reader.offset < reader.size)
+		{
+			byte = reader.data[reader.offset];
+
+			if (byte == 0xff)
+			{
+				unsigned int next = reader.offset + 1 < reader.size ? reader.data[reader.offset + 1] : 0xd9;
+
+				if (next == 0)
+					reader.offset += 2;
+				else
+				{
+					reader.marker = true;
+					byte = 0;
+				}
+			}
+			else
+				reader.offset++;
+		}
+
+		reader.bits |= byte << (24 - reader.count);
+		reader.count += 8;
+	}
+}
+
+static int receiveBits(JpegReader& reader, int count)
+{
+	if (count == 0)
+		return 0;
+
+	if (reader.count < count)
+		fillBits(reader);
+
+	int result = int(reader.bits >> (32 - count));
+	reader.bits <<= count;
+	reader.count -= count;
+
+	return result;
+}
+
+static int extendSign(int value, int count)
+{
+	return value < (1 << (count - 1)) ? value - (1 << count) + 1 : value;
+}
+
+static int decodeJpegSymbol(JpegReader& reader, const JpegHuffman& huffman)
+{
+	if (reader.count < 16)
+		fillBits(reader);
+
+	uint16_t entry = huffman.fast[reader.bits >> (32 - 9)];
+
+	if (entry)
+	{
+		int len = entry >> 8;
+		reader.bits <<= len;
+		reader.count -= len;
+		return entry & 0xff;
+	}
+
+	for (int len = 10; len <= 16; ++len)
+	{
+		int code = int(reader.bits >> (32 - len));
+
+		if (code <= huffman.maxcode[len])
+		{
+			reader.bits <<= len;
+			reader.count -= len;
+			return huffman.values[huffman.valptr[len] + code - huffman.mincode[len]];
+		}
+	}
+
+	return -1;
+}
+
+struct JpegComponent
+{
+	int id;
+	int h, v;
+	int quant;
+
+	int dc_table, ac_table;
+	int dc_pred;
+
+	int blocks_x, blocks_y;
+	std::vector<uint8_t> plane;
+	size_t stride;
+};
+
+struct JpegDecoder
+{
+	uint16_t quant[4][64];
+	JpegHuffman dc[4], ac[4];
+	bool dc_valid[4], ac_valid[4];
+
+	int width, height;
+	int hmax, vmax;
+	int mcus_x, mcus_y;
+
+	JpegComponent components[3];
+	int component_count;
+
+	int restart_interval;
+	int adobe_transform; // -1 when there is no Adobe APP14 segment
+};
+
+static bool decodeBlock(JpegReader& reader, const JpegDecoder& decoder, JpegComponent& component, uint8_t* result)
+{
+	const JpegHuffman& dc = decoder.dc[component.dc_table];
+	const JpegHuffman& ac = decoder.ac[component.ac_table];
+	const uint16_t* quant = decoder.quant[component.quant];
+
+	float coefficients[64] = {};
+
+	int t = decodeJpegSymbol(reader, dc);
+	if (t < 0 || t > 11)
+		return false;
+
+	int diff = t ? extendSign(receiveBits(reader, t), t) : 0;
+	component.dc_pred += diff;
+	coefficients[0] = float(component.dc_pred * quant[0]);
+
+	for (int k = 1; k < 64;)
+	{
+		int rs = decodeJpegSymbol(reader, ac);
+		if (rs < 0)
+			return false;
+
+		int r = rs >> 4, s = rs & 15;
+
+		if (s == 0)
+		{
+			if (r != 15)
+				break;
+
+			k += 16;
+			continue;
+		}
+
+		k += r;
+		if (k > 63)
+			return false;
+
+		coefficients[kZigzag[k]] = float(extendSign(receiveBits(reader, s), s) * quant[k]);
+		k++;
+	}
+
+	inverseDct(coefficients, result, component.stride);
+	return true;
+}
+
+static bool restartScan(JpegReader& reader, JpegDecoder& decoder)
+{
+	// entropy-coded segments end at an RSTn marker; predictors and the bit buffer start over after it
+	if (!reader.marker || reader.offset + 1 >= reader.size || (reader.data[reader.offset + 1] & 0xf8) != 0xd0)
+		return false;
+
+	reader.offset += 2;
+	reader.bits = 0;
+	reader.count = 0;
+	reader.marker = false;
+
+	for (int c = 0; c < decoder.component_count; ++c)
+		decoder.components[c].dc_pred = 0;
+
+	return true;
+}
+
+static bool decodeScan(JpegReader& reader, JpegDecoder& decoder, JpegComponent** scan, int scan_count)
+{
+	for (int c = 0; c < decoder.component_count; ++c)
+		decoder.components[c].dc_pred = 0;
+
+	int units_x = decoder.mcus_x, units_y = decoder.mcus_y;
+
+	if (scan_count == 1)
+	{
+		// non-interleaved scans cover the component's own block grid, one block per unit
+		JpegComponent& component = *scan[0];
+		units_x = (int(ceil(double(decoder.width) * component.h / decoder.hmax)) + 7) / 8;
+		units_y = (int(ceil(double(decoder.height) * component.v / decoder.vmax)) + 7) / 8;
+	}
+
+	int unit = 0;
+
+	for (int uy = 0; uy < units_y; ++uy)
+		for (int ux = 0; ux < units_x; ++ux)
+		{
+			if (decoder.restart_interval && unit > 0 && unit % decoder.restart_interval == 0 && !restartScan(reader, decoder))
+				return false;
+
+			unit++;
+
+			for (int s = 0; s < scan_count; ++s)
+			{
+				JpegComponent& component = *scan[s];
+
+				int bh = scan_count == 1 ? 1 : component.h;
+				int bv = scan_count == 1 ? 1 : component.v;
+
+				for (int by = 0; by < bv; ++by)
+					for (int bx = 0; bx < bh; ++bx)
+					{
+						size_t x = size_t(ux * bh + bx) * 8;
+						size_t y = size_t(uy * bv + by) * 8;
+
+						if (!decodeBlock(reader, decoder, component, &component.plane[y * component.stride + x]))
+							return false;
+					}
+			}
+		}
+
+	return true;
+}
+
+static uint16_t readBE16(const uint8_t* data)
+{
+	return uint16_t((data[0] << 8) | data[1]);
+}
+
+static bool parseFrame(JpegDecoder& decoder, const uint8_t* segment, size_t length)
+{
+	if (length < 6 || segment[0] != 8)
+		return false;
+
+	decoder.height = readBE16(segment + 1);
+	decoder.width = readBE16(segment + 3);
+	decoder.component_count = segment[5];
+
+	if (decoder.width == 0 || decoder.height == 0 || (decoder.component_count != 1 && decoder.component_count != 3) || length < 6 + size_t(decoder.component_count) * 3)
+		return false;
+
+	decoder.hmax = decoder.vmax = 1;
+
+	for (int c = 0; c < decoder.component_count; ++c)
+	{
+		JpegComponent& component = decoder.components[c];
+		const uint8_t* spec = segment + 6 + c * 3;
+
+		component.id = spec[0];
+		component.h = spec[1] >> 4;
+		component.v = spec[1] & 15;
+		component.quant = spec[2] & 3;
+
+		if (component.h < 1 || component.h > 4 || component.v < 1 || component.v > 4)
+			return false;
+
+		decoder.hmax = component.h > decoder.hmax ? component.h : decoder.hmax;
+		decoder.vmax = component.v > decoder.vmax ? component.v : decoder.vmax;
+	}
+
+	decoder.mcus_x = (decoder.width + decoder.hmax * 8 - 1) / (decoder.hmax * 8);
+	decoder.mcus_y = (decoder.height + decoder.vmax * 8 - 1) / (decoder.vmax * 8);
+
+	for (int c = 0; c < decoder.component_count; ++c)
+	{
+		JpegComponent& component = decoder.components[c];
+
+		component.blocks_x = decoder.mcus_x * component.h;
+		component.blocks_y = decoder.mcus_y * component.v;
+		component.stride = size_t(component.blocks_x) * 8;
+		component.plane.assign(component.stride * component.blocks_y * 8, 0);
+	}
+
+	return true;
+}
+
+static bool parseTables(JpegDecoder& decoder, const uint8_t* segment, size_t length, uint8_t marker)
+{
+	size_t offset = 0;
+
+	if (marker == 0xdb)
+	{
+		while (offset < length)
+		{
+			int precision = segment[offset] >> 4, id = segment[offset] & 3;
+			size_t size = precision ? 128 : 64;
+
+			if (offset + 1 + size > length)
+				return false;
+
+			for (int k = 0; k < 64; ++k)
+				decoder.quant[id][k] = precision ? readBE16(segment + offset + 1 + k * 2) : segment[offset + 1 + k];
+
+			offset += 1 + size;
+		}
+	}
+	else
+	{
+		while (offset + 17 <= length)
+		{
+			int table_class = segment[offset] >> 4, id = segment[offset] & 3;
+			const uint8_t* counts = segment + offset + 1;
+
+			int total = 0;
+			for (int i = 0; i < 16; ++i)
+				total += counts[i];
+
+			if (total > 256 || offset + 17 + total > length)
+				return false;
+
+			JpegHuffman& huffman = table_class ? decoder.ac[id] : decoder.dc[id];
+			if (!buildJpegHuffman(huffman, counts, segment + offset + 17, total))
+				return false;
+
+			(table_class ? decoder.ac_valid : decoder.dc_valid)[id] = true;
+			offset += 17 + total;
+		}
+	}
+
+	return true;
+}
+
+static void convertPixels(const JpegDecoder& decoder, VRM::Image& image)
+{
+	image.width = decoder.width;
+	image.height = decoder.height;
+	image.pixels.resize(size_t(decoder.width) * decoder.height * 4);
+
+	// components are stored as RGB when Adobe says so, or (like libjpeg) when their ids spell it out without an Adobe segment
+	const JpegComponent* components = decoder.components;
+	bool rgb = decoder.component_count == 3 && (decoder.adobe_transform == 0 || (decoder.adobe_transform < 0 && components[0].id == 'R' && components[1].id == 'G' && components[2].id == 'B'));
+
+	for (int y = 0; y < decoder.height; ++y)
+		for (int x = 0; x < decoder.width; ++x)
+		{
+			uint8_t* pixel = &image.pixels[(size_t(y) * decoder.width + x) * 4];
+
+			float samples[3];
+
+			for (int c = 0; c < decoder.component_count; ++c)
+			{
+				const JpegComponent& component = decoder.components[c];
+
+				size_t sx = size_t(x) * component.h / decoder.hmax;
+				size_t sy = size_t(y) * component.v / decoder.vmax;
+
+				samples[c] = component.plane[sy * component.stride + sx];
+			}
+
+			if (decoder.component_count == 1)
+			{
+				pixel[0] = pixel[1] = pixel[2] = uint8_t(samples[0]);
+			}
+			else if (rgb)
+			{
+				for (int c = 0; c < 3; ++c)
+					pixel[c] = uint8_t(samples[c]);
+			}
+			else
+			{
+				float yy = samples[0], cb = samples[1] - 128, cr = samples[2] - 128;
+				float color[3] = {yy + 1.402f * cr, yy - 0.344136f * cb - 0.714136f * cr, yy + 1.772f * cb};
+
+				for (int c = 0; c < 3; ++c)
+					pixel[c] = uint8_t(color[c] < 0 ? 0 : color[c] > 255 ? 255 : int(color[c] + 0.5f));
+			}
+
+			pixel[3] = 255;
+		}
+}
+
+bool decodeJpeg(const uint8_t* data, size_t size, VRM::Image& image)
+{
+	if (size < 4 || data[0] != 0xff || data[1] != 0xd8)
+		return false;
+
+	JpegDecoder decoder;
+	memset(decoder.quant, 0, sizeof(decoder.quant));
+	memset(decoder.dc_valid, 0, sizeof(decoder.dc_valid));
+	memset(decoder.ac_valid, 0, sizeof(decoder.ac_valid));
+	decoder.component_count = 0;
+	decoder.restart_interval = 0;
+	decoder.adobe_transform = -1;
+
+	bool has_frame = false;
+	size_t offset = 2;
+
+	while (offset + 4 <= size)
+	{
+		if (data[offset] != 0xff)
+		{
+			offset++;
+			continue;
+		}
+
+		uint8_t marker = data[offset + 1];
+
+		if (marker == 0xff || marker == 0x00 || (marker >= 0xd0 && marker <= 0xd7))
+		{
+			offset++;
+			continue;
+		}
+
+		if (marker == 0xd9)
+			break;
+
+		size_t length = readBE16(data + offset + 2);
+		if (length < 2 || offset + 2 + length > size)
+			return false;
+
+		const uint8_t* segment = data + offset + 4;
+		length -= 2;
+		offset += 4 + length;
+
+		if (marker == 0xc0 || marker == 0xc1)
+		{
+			if (!parseFrame(decoder, segment, length))
+				return false;
+			has_frame = true;
+		}
+		else if ((marker >= 0xc2 && marker <= 0xcf && marker != 0xc4 && marker != 0xc8 && marker != 0xcc))
+		{
+			return false; // progressive, lossless and arithmetic-coded frames
+		}
+		else if (marker == 0xdb || marker == 0xc4)
+		{
+			if (!parseTables(decoder, segment, length, marker))
+				return false;
+		}
+		else if (marker == 0xee && length >= 12 && memcmp(segment, "Adobe", 5) == 0)
+		{
+			decoder.adobe_transform = segment[11];
+		}
+		else if (marker == 0xdd && length >= 2)
+		{
+			decoder.restart_interval = readBE16(segment);
+		}
+		else if (marker == 0xda)
+		{
+			if (!has_frame || length < 1 || length < 1 + size_t(segment[0]) * 2)
+				return false;
+
+			JpegComponent* scan[3];
+			int scan_count = segment[0];
+
+			if (scan_count < 1 || scan_count > decoder.component_count)
+				return false;
+
+			for (int s = 0; s < scan_count; ++s)
+			{
+				int id = segment[1 + s * 2];
+				int tables = segment[2 + s * 2];
+
+				scan[s] = NULL;
+				for (int c = 0; c < decoder.component_count; ++c)
+					if (decoder.components[c].id == id)
+						scan[s] = &decoder.components[c];
+
+				if (!scan[s] || !decoder.dc_valid[tables >> 4 & 3] || !decoder.ac_valid[tables & 3])
+					return false;
+
+				scan[s]->dc_table = tables >> 4 & 3;
+				scan[s]->ac_table = tables & 3;
+			}
+
+			JpegReader reader = {data, size, offset, 0, 0, false};
+
+			if (!decodeScan(reader, decoder, scan, scan_count))
+				return false;
+
+			// resume marker parsing at the first marker after the entropy-coded data
+			offset = reader.offset;
+		}
+	}
+
+	if (!has_frame)
+		return false;
+
+	convertPixels(decoder, image);
+	return true;
+}
+
+// Annex K tables, in the BITS/HUFFVAL form used by DHT segments
+static const uint8_t kDcLumaCounts[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t kDcChromaCounts[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+static const uint8_t kDcValues[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+static const uint8_t kAcLumaCounts[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+static const uint8_t kAcLumaValues[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa};
+
+static const uint8_t kAcChromaCounts[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+static const uint8_t kAcChromaValues[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa};
+
+// Annex K quantization tables in natural order, scaled by quality like libjpeg does
+static const uint8_t kLumaQuant[64] = {
+    16, 11, 10, 16, 24, 40, 51, 61,
+    12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56,
+    14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77,
+    24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103, 99};
+
+static const uint8_t kChromaQuant[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99};
+
+struct HuffmanCodes
+{
+	uint16_t codes[256];
+	uint8_t lengths[256];
+};
+
+static void buildCodes(HuffmanCodes& result, const uint8_t* counts, const uint8_t* values)
+{
+	memset(&result, 0, sizeof(result));
+
+	int code = 0, index = 0;
+	for (int len = 1; len <= 16; ++len)
+	{
+		for (int i = 0; i < counts[len - 1]; ++i, ++code, ++index)
+		{
+			result.codes[values[index]] = uint16_t(code);
+			result.lengths[values[index]] = uint8_t(len);
+		}
+		code <<= 1;
+	}
+}
+
+struct JpegWriter
+{
+	std::vector<uint8_t>& result;
+
+	uint32_t bits;
+	int count;
+
+	void put(uint32_t value, int length)
+	{
+		bits |= (value & ((1u << length) - 1)) << (24 - count - length);
+		count += length;
+
+		while (count >= 8)
+		{
+			uint8_t byte = uint8_t(bits >> 16);
+			result.push_back(byte);
+			if (byte == 0xff)
+				result.push_back(0);
+
+			bits <<= 8;
+			count -= 8;
+		}
+	}
+
+	void flush()
+	{
+		// pad the final byte with ones as required by the spec
+		if (count > 0)
+			put(0x7f, 8 - count);
+	}
+};
+
+static int magnitudeCategory(int value)
+{
+	int magnitude = value < 0 ? -value : value;
+	int bits = 0;
+
+	while (magnitude)
+	{
+		bits++;
+		magnitude >>= 1;
+	}
+
+	return bits;
+}
+
+static void encodeBlock(JpegWriter& writer, const float* samples, const float* quant, int& dc_pred, const HuffmanCodes& dc, const HuffmanCodes& ac)
+{
+	float coefficients[64];
+	forwardDct(samples, coefficients);
+
+	int quantized[64];
+	for (int k = 0; k < 64; ++k)
+	{
+		float value = coefficients[kZigzag[k]] / quant[k];
+		quantized[k] = int(value < 0 ? value - 0.5f : value + 0.5f);
+	}
+
+	int diff = quantized[0] - dc_pred;
+	dc_pred = quantized[0];
+
+	int category = magnitudeCategory(diff);
+	writer.put(dc.codes[category], dc.lengths[category]);
+	if (category)
+		writer.put(diff < 0 ? diff - 1 : diff, category);
+
+	int run = 0;
+	for (int k = 1; k < 64; ++k)
+	{
+		if (quantized[k] == 0)
+		{
+			run++;
+			continue;
+		}
+
+		while (run >= 16)
+		{
+			writer.put(ac.codes[0xf0], ac.lengths[0xf0]);
+			run -= 16;
+		}
+
+		int value = quantized[k];
+		int size = magnitudeCategory(value);
+		int symbol = (run << 4) | size;
+
+		writer.put(ac.codes[symbol], ac.lengths[symbol]);
+		writer.put(value < 0 ? value - 1 : value, size);
+		run = 0;
+	}
+
+	if (run > 0)
+		writer.put(ac.codes[0x00], ac.lengths[0x00]);
+}
+
+static void writeMarker(std::vector<uint8_t>& result, uint8_t marker, size_t length)
+{
+	result.push_back(0xff);
+	result.push_back(marker);
+	result.push_back(uint8_t((length + 2) >> 8));
+	result.push_back(uint8_t(length + 2));
+}
+
+static void writeHuffmanTable(std::vector<uint8_t>& result, int id, const uint8_t* counts, const uint8_t* values)
+{
+	int total = 0;
+	for (int i = 0; i < 16; ++i)
+		total += counts[i];
+
+	result.push_back(uint8_t(id));
+	result.insert(result.end(), counts, counts + 16);
+	result.insert(result.end(), values, values + total);
+}
+
+bool encodeJpeg(const VRM::Image& image, int quality, std::vector<uint8_t>& result)
+{
+	if (image.width <= 0 || image.height <= 0 || image.width > 65535 || image.height > 65535)
+		return false;
+
+	quality = quality < 1 ? 1 : quality > 100 ? 100 : quality;
+	int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+
+	uint8_t quant_tables[2][64];
+	float quant_scales[2][64];
+
+	for (int k = 0; k < 64; ++k)
+	{
+		int luma = (kLumaQuant[kZigzag[k]] * scale + 50) / 100;
+		int chroma = (kChromaQuant[kZigzag[k]] * scale + 50) / 100;
+
+		quant_tables[0][k] = uint8_t(luma < 1 ? 1 : luma > 255 ? 255 : luma);
+		quant_tables[1][k] = uint8_t(chroma < 1 ? 1 : chroma > 255 ? 255 : chroma);
+
+		quant_scales[0][k] = quant_tables[0][k];
+		quant_scales[1][k] = quant_tables[1][k];
+	}
+
+	HuffmanCodes dc_luma, dc_chroma, ac_luma, ac_chroma;
+	buildCodes(dc_luma, kDcLumaCounts, kDcValues);
+	buildCodes(dc_chroma, kDcChromaCounts, kDcValues);
+	buildCodes(ac_luma, kAcLumaCounts, kAcLumaValues);
+	buildCodes(ac_chroma, kAcChromaCounts, kAcChromaValues);
+
+	result.clear();
+	result.push_back(0xff);
+	result.push_back(0xd8);
+
+	static const uint8_t kJfif[14] = {'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0};
+	writeMarker(result, 0xe0, sizeof(kJfif));
+	result.insert(result.end(), kJfif, kJfif + sizeof(kJfif));
+
+	writeMarker(result, 0xdb, 65 * 2);
+	for (int t = 0; t < 2; ++t)
+	{
+		result.push_back(uint8_t(t));
+		result.insert(result.end(), quant_tables[t], quant_tables[t] + 64);
+	}
+
+	// 4:4:4 sampling; toon shaded textures have hard color edges that chroma subsampling visibly smears
+	uint8_t frame[15] = {8, uint8_t(image.height >> 8), uint8_t(image.height), uint8_t(image.width >> 8), uint8_t(image.width), 3, 1, 0x11, 0, 2, 0x11, 1, 3, 0x11, 1};
+	writeMarker(result, 0xc0, sizeof(frame));
+	result.insert(result.end(), frame, frame + sizeof(frame));
+
+	writeMarker(result, 0xc4, (17 + 12) * 2 + (17 + 162) * 2);
+	writeHuffmanTable(result, 0x00, kDcLumaCounts, kDcValues);
+	writeHuffmanTable(result, 0x10, kAcLumaCounts, kAcLumaValues);
+	writeHuffmanTable(result, 0x01, kDcChromaCounts, kDcValues);
+	writeHuffmanTable(result, 0x11, kAcChromaCounts, kAcChromaValues);
+
+	static const uint8_t kScan[10] = {3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0};
+	writeMarker(result, 0xda, sizeof(kScan));
+	result.insert(result.end(), kScan, kScan + sizeof(kScan));
+
+	JpegWriter writer = {result, 0, 0};
+	int dc_pred[3] = {};
+
+	for (int by = 0; by < image.height; by += 8)
+		for (int bx = 0; bx < image.width; bx += 8)
+		{
+			float blocks[3][64];
+
+			for (int y = 0; y < 8; ++y)
+				for (int x = 0; x < 8; ++x)
+				{
+					// replicate edge pixels into partial blocks to avoid ringing at the border
+					int sx = bx + x < image.width ? bx + x : image.width - 1;
+					int sy = by + y < image.height ? by + y : image.height - 1;
+
+					const uint8_t* pixel = &image.pixels[(size_t(sy) * image.width + sx) * 4];
+					float r = pixel[0], g = pixel[1], b = pixel[2];
+
+					blocks[0][y * 8 + x] = 0.299f * r + 0.587f * g + 0.114f * b - 128;
+					blocks[1][y * 8 + x] = -0.168736f * r - 0.331264f * g + 0.5f * b;
+					blocks[2][y * 8 + x] = 0.5f * r - 0.418688f * g - 0.081312f * b;
+				}
+
+			encodeBlock(writer, blocks[0], quant_scales[0], dc_pred[0], dc_luma, ac_luma);
+			encodeBlock(writer, blocks[1], quant_scales[1], dc_pred[1], dc_chroma, ac_chroma);
+			encodeBlock(writer, blocks[2], quant_scales[1], dc_pred[2], dc_chroma, ac_chroma);
+		}
+
+	writer.flush();
+
+	result.push_back(0xff);
+	result.push_back(0xd9);
+
+	return true;
+}
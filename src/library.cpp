@@ -0,0 +1,116 @@
+#include "vrmpack.h"
+#include "vrmpack.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+
+static void* defaultAlloc(void*, size_t size)
+{
+	return malloc(size);
+}
+
+static void defaultFree(void*, void* ptr)
+{
+	free(ptr);
+}
+
+void vrmpack_default_settings(vrmpack_settings* settings)
+{
+	VRM::Settings defaults = getDefaultSettings();
+
+	memset(settings, 0, sizeof(vrmpack_settings));
+	settings->simplify_threshold = defaults.simplify_threshold;
+	settings->simplify_aggressive = defaults.simplify_aggressive;
+	settings->texture_max = defaults.texture_max;
+	settings->texture_atlas = defaults.texture_atlas;
+	settings->keep_images = defaults.keep_images;
+	settings->keep_materials = defaults.keep_materials;
+	settings->thread_count = defaults.thread_count;
+}
+
+vrmpack_result vrmpack_process(const void* in, size_t in_size, const vrmpack_settings* settings, vrmpack_output* output)
+{
+	vrmpack_settings options;
+
+	if (settings)
+		options = *settings;
+	else
+		vrmpack_default_settings(&options);
+
+	if (!output || !in || in_size == 0)
+		return vrmpack_result_invalid_argument;
+
+	output->data = NULL;
+	output->size = 0;
+
+	if (!(options.simplify_threshold >= 0.f && options.simplify_threshold <= 1.f) || options.texture_max < 0 || options.thread_count < 0 || !options.allocator.alloc != !options.allocator.free)
+		return vrmpack_result_invalid_argument;
+
+	// the library never touches the cache or prints progress, so concurrent calls share nothing but the worker pool
+	VRM::Settings config = getDefaultSettings();
+	config.simplify_threshold = options.simplify_threshold;
+	config.simplify_aggressive = options.simplify_aggressive != 0;
+	config.texture_max = options.texture_max;
+	config.texture_atlas = options.texture_atlas != 0;
+	config.keep_images = options.keep_images != 0;
+	config.keep_materials = options.keep_materials != 0;
+	config.thread_count = options.thread_count;
+
+	cgltf_memory_options memory = {};
+
+	if (options.allocator.alloc)
+	{
+		memory.alloc = options.allocator.alloc;
+		memory.free = options.allocator.free;
+		memory.user_data = options.allocator.user_data;
+	}
+	else
+	{
+		options.allocator.alloc = defaultAlloc;
+		options.allocator.free = defaultFree;
+		options.allocator.user_data = NULL;
+	}
+
+	std::vector<char> glb;
+	int result = 0;
+
+	// exceptions must not cross the C boundary; the glTF data is released as they unwind
+	try
+	{
+		result = vrmpack(in, in_size, glb, config, memory, NULL);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return vrmpack_result_out_of_memory;
+	}
+	catch (...)
+	{
+		return vrmpack_result_internal_error;
+	}
+
+	if (result != 0)
+		return vrmpack_result_invalid_input;
+
+	void* data = options.allocator.alloc(options.allocator.user_data, glb.size());
+	if (!data)
+		return vrmpack_result_out_of_memory;
+
+	memcpy(data, &glb[0], glb.size());
+
+	output->data = data;
+	output->size = glb.size();
+	output->allocator = options.allocator;
+
+	return vrmpack_result_success;
+}
+
+void vrmpack_free_output(vrmpack_output* output)
+{
+	if (output->data)
+		output->allocator.free(output->allocator.user_data, output->data);
+
+	output->data = NULL;
+	output->size = 0;
+}
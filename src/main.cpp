@@ -0,0 +1,649 @@
+#include "vrmpack.hpp"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+using namespace VRM;
+
+struct BatchFile
+{
+	std::string input;
+	std::string output;
+};
+
+static bool isVrmFile(const std::string& name)
+{
+	if (name.size() < 4)
+	{
+		return false;
+	}
+
+	std::string extension = name.substr(name.size() - 4);
+	for (size_t i = 0; i < extension.size(); ++i)
+	{
+		extension[i] = char(tolower(extension[i]));
+	}
+
+	return extension == ".vrm";
+}
+
+static std::string getBatchOutput(const char* directory, const std::string& input)
+{
+	size_t slash = input.find_last_of("/\\");
+	std::string name = slash == std::string::npos ? input : input.substr(slash + 1);
+
+	return std::string(directory) + "/" + name;
+}
+
+static bool readManifest(const char* path, const char* output, std::vector<BatchFile>& files)
+{
+	std::ifstream in(path);
+
+	if (!in)
+	{
+		fprintf(stderr, "Failed to read batch manifest %s\n", path);
+		return false;
+	}
+
+	std::string line;
+	for (int number = 1; std::getline(in, line); ++number)
+	{
+		if (!line.empty() && line[line.size() - 1] == '\r')
+		{
+			line.erase(line.size() - 1);
+		}
+
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+
+		// each line is "input" or "input<TAB>output"; tabs keep paths with spaces unambiguous
+		BatchFile file;
+		size_t tab = line.find('\t');
+
+		file.input = line.substr(0, tab);
+
+		if (tab != std::string::npos)
+		{
+			file.output = line.substr(tab + 1);
+		}
+		else if (output)
+		{
+			file.output = getBatchOutput(output, file.input);
+		}
+		else
+		{
+			fprintf(stderr, "%s:%d: no output path for %s; add one after a tab or specify an output directory with -o\n", path, number, file.input.c_str());
+			return false;
+		}
+
+		files.push_back(file);
+	}
+
+	return true;
+}
+
+static int batch(const char* path, const char* output, const Settings& settings, std::vector<Report>* reports)
+{
+	std::vector<BatchFile> files;
+	std::vector<std::string> names;
+
+	if (listDirectory(path, names))
+	{
+		if (!output)
+		{
+			fprintf(stderr, "Batch processing a directory requires an output directory (-o)\n");
+			return 1;
+		}
+
+		// directory order is unspecified; sort so that reports are stable
+		std::sort(names.begin(), names.end());
+
+		for (size_t i = 0; i < names.size(); ++i)
+		{
+			if (isVrmFile(names[i]))
+			{
+				std::string input = std::string(path) + "/" + names[i];
+				BatchFile file = {input, getBatchOutput(output, input)};
+				files.push_back(file);
+			}
+		}
+	}
+	else if (!readManifest(path, output, files))
+	{
+		return 1;
+	}
+
+	// two entries with the same output would write the same file, and the same output + ".tmp" and ".in.json", at the same time
+	std::vector<bool> duplicate(files.size());
+	std::set<std::string> outputs;
+
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		duplicate[i] = !outputs.insert(files[i].output).second;
+	}
+
+	std::vector<int> results(files.size());
+	std::mutex report_mutex;
+
+	if (reports)
+	{
+		reports->resize(files.size());
+	}
+
+	// files are scheduled on the same worker pool as per-file mesh and texture jobs
+	parallelFor(files.size(), settings.thread_count, [&](size_t i) {
+		const BatchFile& file = files[i];
+		Report* report = reports ? &(*reports)[i] : nullptr;
+		double start = isTracing() ? getTime() : 0;
+
+		if (duplicate[i])
+		{
+			fprintf(stderr, "Output %s is already written by another batch entry\n", file.output.c_str());
+			results[i] = 1;
+		}
+		else
+		{
+			results[i] = vrmpack(file.input.c_str(), file.output.c_str(), settings, report);
+		}
+
+		if (report)
+		{
+			report->input = file.input;
+			report->output = file.output;
+			report->result = results[i];
+		}
+
+		traceEvent("file", "file", file.input.c_str(), start, isTracing() ? getTime() : 0);
+
+		std::lock_guard<std::mutex> lock(report_mutex);
+		printf("%s\t%s\t%s\n", results[i] == 0 ? "ok" : "failed", file.input.c_str(), file.output.c_str());
+		fflush(stdout);
+	});
+
+	size_t failed = 0;
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		failed += results[i] != 0;
+	}
+
+	if (settings.verbose)
+	{
+		fprintf(stderr, "batch: %d files, %d failed\n", int(files.size()), int(failed));
+	}
+
+	return failed ? 1 : 0;
+}
+
+// options that only affect how a file is processed; these are also accepted per request in server mode
+static bool parseProcessingOption(int argc, const char* const* argv, int& i, Settings& settings)
+{
+	const char* arg = argv[i];
+
+	if (strcmp(arg, "-si") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+	{
+		settings.simplify_threshold = float(atof(argv[++i]));
+	}
+	else if (strcmp(arg, "-sa") == 0)
+	{
+		settings.simplify_aggressive = true;
+	}
+	else if (strcmp(arg, "-tmax") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+	{
+		settings.texture_max = atoi(argv[++i]);
+	}
+	else if (strcmp(arg, "-ta") == 0)
+	{
+		settings.texture_atlas = true;
+	}
+	else if (strcmp(arg, "-ki") == 0)
+	{
+		settings.keep_images = true;
+	}
+	else if (strcmp(arg, "-km") == 0)
+	{
+		settings.keep_materials = true;
+	}
+	else
+	{
+		return false;
+	}
+
+	return true;
+}
+
+static int serveRequest(const Settings& defaults, const std::string& options, const std::vector<char>& input, std::vector<char>& output)
+{
+	std::vector<std::string> args;
+	std::stringstream options_st(options);
+
+	for (std::string arg; options_st >> arg;)
+	{
+		args.push_back(arg);
+	}
+
+	std::vector<const char*> argv;
+	for (size_t i = 0; i < args.size(); ++i)
+	{
+		argv.push_back(args[i].c_str());
+	}
+
+	Settings settings = defaults;
+
+	for (int i = 0; i < int(argv.size()); ++i)
+	{
+		if (!parseProcessingOption(int(argv.size()), argv.data(), i, settings))
+		{
+			std::string message = "Unrecognized option " + args[i];
+			output.assign(message.begin(), message.end());
+			return 1;
+		}
+	}
+
+	int result = input.empty() ? cgltf_result_data_too_short : vrmpack(&input[0], input.size(), output, settings, cgltf_memory_options(), nullptr);
+
+	if (result != 0)
+	{
+		static const char message[] = "Failed to process input";
+		output.assign(message, message + sizeof(message) - 1);
+	}
+
+	// a long running server never reaches the end of the invocation, so the cache is trimmed periodically instead
+	static std::atomic<unsigned int> requests(0);
+
+	if (settings.cache_path && ++requests % 64 == 0)
+	{
+		trimCache(settings.cache_path, settings.cache_limit, settings.verbose);
+	}
+
+	return result;
+}
+
+static bool isStandardStream(const char* path)
+{
+	return strcmp(path, "-") == 0;
+}
+
+// "-" reads stdin; streams are read sequentially until EOF, so pipes work as well as files
+static bool readFile(const char* path, std::vector<char>& result)
+{
+	FILE* file = stdin;
+
+	if (isStandardStream(path))
+	{
+#ifdef _WIN32
+		_setmode(_fileno(stdin), _O_BINARY);
+#endif
+	}
+	else if (!(file = fopen(path, "rb")))
+	{
+		return false;
+	}
+
+	char chunk[65536];
+	for (size_t read; (read = fread(chunk, 1, sizeof(chunk), file)) > 0;)
+	{
+		result.insert(result.end(), chunk, chunk + read);
+	}
+
+	bool ok = !ferror(file);
+
+	if (file != stdin)
+	{
+		fclose(file);
+	}
+
+	return ok;
+}
+
+// "-" writes stdout
+static bool writeFile(const char* path, const std::vector<char>& data)
+{
+	FILE* file = stdout;
+
+	if (isStandardStream(path))
+	{
+#ifdef _WIN32
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+	}
+	else if (!(file = fopen(path, "wb")))
+	{
+		return false;
+	}
+
+	bool ok = data.empty() || fwrite(&data[0], 1, data.size(), file) == data.size();
+
+	ok &= (file == stdout ? fflush(file) : fclose(file)) == 0;
+
+	return ok;
+}
+
+static int vrmpackStream(const char* input, const char* output, const Settings& settings, Report* report)
+{
+	std::vector<char> buffer;
+	bool read = false;
+
+	{
+		StageTimer timer(report, Stage_Read);
+		read = readFile(input, buffer);
+	}
+
+	if (!read)
+	{
+		fprintf(stderr, "Failed to read %s\n", isStandardStream(input) ? "stdin" : input);
+		return cgltf_result_io_error;
+	}
+
+	// the GLB header needs the total size, so the result is assembled in memory before anything is written
+	std::vector<char> result;
+	int status = vrmpack(buffer.data(), buffer.size(), result, settings, cgltf_memory_options(), report);
+
+	if (status != 0)
+	{
+		return status;
+	}
+
+	bool written = false;
+
+	{
+		StageTimer timer(report, Stage_WriteGlb);
+		written = writeFile(output, result);
+	}
+
+	if (!written)
+	{
+		fprintf(stderr, "Failed to write %s\n", isStandardStream(output) ? "stdout" : output);
+		return cgltf_result_io_error;
+	}
+
+	return 0;
+}
+
+static int connectRequest(const char* path, const std::string& options, const char* input, const char* output)
+{
+	std::vector<char> buffer;
+
+	if (!readFile(input, buffer))
+	{
+		fprintf(stderr, "Failed to read file %s\n", input);
+		return 1;
+	}
+
+	std::vector<char> result;
+	int status = request(path, options, buffer, result);
+
+	if (status != 0)
+	{
+		fprintf(stderr, "Request failed: %.*s\n", int(result.size()), result.empty() ? "" : &result[0]);
+		return status;
+	}
+
+	if (!writeFile(output, result))
+	{
+		fprintf(stderr, "Failed to write file %s\n", output);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	Settings settings = getDefaultSettings();
+
+	const char* input = 0;
+	const char* output = 0;
+	const char* batch_path = 0;
+	const char* serve_path = 0;
+	const char* connect_path = 0;
+	const char* report_path = 0;
+	const char* trace_path = 0;
+	const char* stats_path = 0;
+	int serve_jobs = 4;
+	int serve_timeout = 30;
+	bool help = false;
+
+	// processing options are forwarded to the server in client mode
+	std::string options;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		int first = i;
+
+		if (parseProcessingOption(argc, argv, i, settings))
+		{
+			for (int j = first; j <= i; ++j)
+			{
+				options += options.empty() ? "" : " ";
+				options += argv[j];
+			}
+		}
+		else if (strcmp(arg, "-cache") == 0 && i + 1 < argc && !settings.cache_path)
+		{
+			settings.cache_path = argv[++i];
+		}
+		else if (strcmp(arg, "-cmax") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+		{
+			settings.cache_limit = uint64_t(atoi(argv[++i])) << 20;
+		}
+		else if (strcmp(arg, "-j") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+		{
+			settings.thread_count = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-i") == 0 && i + 1 < argc && !input)
+		{
+			input = argv[++i];
+		}
+		else if (strcmp(arg, "-o") == 0 && i + 1 < argc && !output)
+		{
+			output = argv[++i];
+		}
+		else if (strcmp(arg, "-batch") == 0 && i + 1 < argc && !batch_path)
+		{
+			batch_path = argv[++i];
+		}
+		else if (strcmp(arg, "-serve") == 0 && i + 1 < argc && !serve_path)
+		{
+			serve_path = argv[++i];
+		}
+		else if (strcmp(arg, "-serve-jobs") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+		{
+			serve_jobs = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-serve-timeout") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
+		{
+			serve_timeout = atoi(argv[++i]);
+		}
+		else if (strcmp(arg, "-connect") == 0 && i + 1 < argc && !connect_path)
+		{
+			connect_path = argv[++i];
+		}
+		else if (strcmp(arg, "-report") == 0 && i + 1 < argc && !report_path)
+		{
+			report_path = argv[++i];
+		}
+		else if (strcmp(arg, "-stats") == 0 && i + 1 < argc && !stats_path)
+		{
+			stats_path = argv[++i];
+			settings.statistics = true;
+		}
+		else if (strcmp(arg, "-trace") == 0 && i + 1 < argc && !trace_path)
+		{
+			trace_path = argv[++i];
+		}
+		else if (strcmp(arg, "-v") == 0)
+		{
+			settings.verbose = 1;
+		}
+		else if (strcmp(arg, "-vv") == 0)
+		{
+			settings.verbose = 2;
+		}
+		else if (strcmp(arg, "-h") == 0)
+		{
+			help = true;
+		}
+		else if (arg[0] == '-')
+		{
+			fprintf(stderr, "Unrecognized option %s\n", arg);
+			return 1;
+		}
+	}
+
+	// shortcut for vrmpack -v
+	if (settings.verbose && argc == 2)
+	{
+		printf("vrmpack %s\n", getVersion().c_str());
+		return 0;
+	}
+
+	if (help || (!batch_path && !serve_path && (!input || !output)))
+	{
+		fprintf(stderr, "vrmpack %s\n", getVersion().c_str());
+		fprintf(stderr, "Usage: vrmpack [options] -i input -o output\n");
+
+		if (help)
+		{
+			fprintf(stderr, "\nBasics:\n");
+			fprintf(stderr, "\t-i file: input file to process, .vrm; - reads stdin\n");
+			fprintf(stderr, "\t-o file: output file path, .vrm; - writes stdout\n");
+			fprintf(stderr, "\t-batch path: process all .vrm files in a directory or the files listed in a manifest (\"input\" or \"input<TAB>output\" per line); -o specifies the output directory\n");
+			fprintf(stderr, "\nServer:\n");
+			fprintf(stderr, "\t-serve path: listen on a Unix domain socket and process requests until SIGINT or SIGTERM, then finish requests in flight\n");
+			fprintf(stderr, "\t-serve-jobs N: process at most N requests at a time; connections stay open between requests without holding a slot (default: 4)\n");
+			fprintf(stderr, "\t-serve-timeout S: drop connections that take longer than S seconds to send a request or receive a response (default: 30)\n");
+			fprintf(stderr, "\t-connect path: send -i input with the processing options to a server and write the result to -o output\n");
+			fprintf(stderr, "\nSimplification:\n");
+			fprintf(stderr, "\t-si R: simplify meshes to achieve the ratio R (default: 1; R should be between 0 and 1)\n");
+			fprintf(stderr, "\t-sa: aggressively simplify to the target ratio disregarding quality\n");
+			fprintf(stderr, "\nTextures:\n");
+			fprintf(stderr, "\t-tmax N: downscale textures so that neither dimension exceeds N pixels (default: 0, no limit)\n");
+			fprintf(stderr, "\t-ta: merge compatible MToon materials by packing their main and shade textures into an atlas\n");
+			fprintf(stderr, "\t-ki: keep all images, disabling duplicate merging and removal of unreferenced images\n");
+			fprintf(stderr, "\nMaterials:\n");
+			fprintf(stderr, "\t-km: keep all materials, disabling MToon property canonicalization and duplicate merging\n");
+			fprintf(stderr, "\nMiscellaneous:\n");
+			fprintf(stderr, "\t-cache dir: reuse processed meshes from previous runs stored in dir\n");
+			fprintf(stderr, "\t-cmax N: evict least recently used cache entries once the cache exceeds N megabytes (default: 256)\n");
+			fprintf(stderr, "\t-j N: process meshes, textures and batch files using N threads (default: 0, one per hardware thread)\n");
+			fprintf(stderr, "\t-report file: write per-stage timings, per-mesh results, allocation counts and peak memory as JSON\n");
+			fprintf(stderr, "\t-stats file: write vertex cache (ACMR, ATVR), overdraw and vertex fetch statistics per primitive and per file, before and after processing, as JSON\n");
+			fprintf(stderr, "\t-trace file: write a Chrome trace (chrome://tracing, Perfetto) with per-thread spans for every stage, primitive and batch file\n");
+			fprintf(stderr, "\t-v: verbose output, including a timing and memory report per file (print version when used without other options)\n");
+			fprintf(stderr, "\t-h: display this help and exit\n");
+		}
+		else
+		{
+			fprintf(stderr, "\nBasics:\n");
+			fprintf(stderr, "\t-i file: input file to process, .vrm\n");
+			fprintf(stderr, "\t-o file: output file path, .vrm\n");
+			fprintf(stderr, "\t-si R: simplify meshes to achieve the ratio R (default: 1; R should be between 0 and 1)\n");
+			fprintf(stderr, "\nRun vrmpack -h to display a full list of options\n");
+		}
+
+		return 1;
+	}
+
+	if (batch_path && output && isStandardStream(output))
+	{
+		fprintf(stderr, "Batch processing writes files and cannot write to stdout\n");
+		return 1;
+	}
+
+	if (trace_path)
+	{
+		startTrace();
+	}
+
+	int result = 0;
+
+	if (serve_path)
+	{
+		using namespace std::placeholders;
+		result = serve(serve_path, serve_jobs > 0 ? serve_jobs : 1, serve_timeout > 0 ? serve_timeout : 1, std::bind(serveRequest, settings, _1, _2, _3));
+	}
+	else if (connect_path)
+	{
+		result = connectRequest(connect_path, options, input, output);
+	}
+	else
+	{
+		std::vector<Report> reports;
+		// traces use the report to tag stage spans with the file they belong to
+		bool reporting = settings.verbose || report_path || trace_path || stats_path;
+
+		// the allocator has to be in place before meshoptimizer allocates anything
+		if (reporting)
+		{
+			countMeshoptAllocations();
+		}
+
+		if (batch_path)
+		{
+			result = batch(batch_path, output, settings, reporting ? &reports : nullptr);
+		}
+		else
+		{
+			reports.resize(1);
+			reports[0].input = input;
+			reports[0].output = output;
+
+			Report* report = reporting ? &reports[0] : nullptr;
+
+			if (isStandardStream(input) || isStandardStream(output))
+			{
+				result = vrmpackStream(input, output, settings, report);
+			}
+			else
+			{
+				result = vrmpack(input, output, settings, report);
+			}
+
+			reports[0].result = result;
+		}
+
+		for (size_t i = 0; i < reports.size() && settings.verbose; ++i)
+		{
+			printReport(reports[i]);
+		}
+
+		if (report_path && !writeReport(report_path, reports))
+		{
+			result = result ? result : 1;
+		}
+
+		if (stats_path && !writeStatistics(stats_path, reports))
+		{
+			result = result ? result : 1;
+		}
+	}
+
+	if (trace_path && !writeTrace(trace_path))
+	{
+		result = result ? result : 1;
+	}
+
+	// eviction runs once per invocation rather than per file, since it scans the whole directory
+	if (settings.cache_path)
+	{
+		trimCache(settings.cache_path, settings.cache_limit, settings.verbose);
+	}
+
+	return result;
+}
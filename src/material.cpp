@@ -0,0 +1,1326 @@
+#include "vrmpack.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace VRM;
+
+static const int kAtlasMaxSize = 4096;
+static const int kAtlasPadding = 4;
+
+// UVs slightly outside of [0, 1] are common in exported meshes; they land in the cell padding
+static const float kAtlasUvTolerance = 1e-3f;
+
+static bool isSameString(const char* lhs, const char* rhs)
+{
+	return strcmp(lhs ? lhs : "", rhs ? rhs : "") == 0;
+}
+
+static char* copyString(cgltf_data* data, const char* string)
+{
+	size_t length = strlen(string);
+
+	char* result = (char*)data->memory.alloc(data->memory.user_data, length + 1);
+	memcpy(result, string, length + 1);
+
+	return result;
+}
+
+static int findKey(char* const* keys, cgltf_size count, const char* key)
+{
+	for (cgltf_size i = 0; i < count; ++i)
+		if (keys[i] && strcmp(keys[i], key) == 0)
+			return int(i);
+
+	return -1;
+}
+
+static cgltf_int getTextureProperty(const cgltf_vrm_material_v0_0& material, const char* key)
+{
+	int index = findKey(material.textureProperties_keys, material.textureProperties_count, key);
+
+	return index < 0 ? -1 : material.textureProperties_values[index];
+}
+
+static void setTextureProperty(cgltf_vrm_material_v0_0& material, const char* key, cgltf_int value)
+{
+	int index = findKey(material.textureProperties_keys, material.textureProperties_count, key);
+
+	if (index >= 0)
+		material.textureProperties_values[index] = value;
+}
+
+static cgltf_vrm_material_v0_0* findVrmMaterial(cgltf_data* data, cgltf_size index)
+{
+	const char* name = data->materials[index].name;
+
+	if (!data->has_vrm_v0_0 || !name)
+		return NULL;
+
+	cgltf_vrm_v0_0& vrm = data->vrm_v0_0;
+
+	// UniVRM writes materialProperties in material order; other exporters are matched by name
+	if (index < vrm.materialProperties_count && isSameString(vrm.materialProperties[index].name, name))
+		return &vrm.materialProperties[index];
+
+	for (cgltf_size i = 0; i < vrm.materialProperties_count; ++i)
+		if (isSameString(vrm.materialProperties[i].name, name))
+			return &vrm.materialProperties[i];
+
+	return NULL;
+}
+
+static bool isSameVrmProperties(const cgltf_vrm_material_v0_0& lhs, const cgltf_vrm_material_v0_0& rhs, bool atlas)
+{
+	if (!isSameString(lhs.shader, rhs.shader) || lhs.renderQueue != rhs.renderQueue)
+		return false;
+
+	if (lhs.floatProperties_count != rhs.floatProperties_count || lhs.vectorProperties_count != rhs.vectorProperties_count ||
+	    lhs.textureProperties_count != rhs.textureProperties_count || lhs.keywordMap_count != rhs.keywordMap_count || lhs.tagMap_count != rhs.tagMap_count)
+		return false;
+
+	// properties are compared by key since exporters do not guarantee a stable order
+	for (cgltf_size i = 0; i < lhs.floatProperties_count; ++i)
+	{
+		int j = findKey(rhs.floatProperties_keys, rhs.floatProperties_count, lhs.floatProperties_keys[i]);
+
+		if (j < 0 || lhs.floatProperties_values[i] != rhs.floatProperties_values[j])
+			return false;
+	}
+
+	for (cgltf_size i = 0; i < lhs.vectorProperties_count; ++i)
+	{
+		int j = findKey(rhs.vectorProperties_keys, rhs.vectorProperties_count, lhs.vectorProperties_keys[i]);
+
+		if (j < 0 || lhs.vectorProperties_floats_size[i] != rhs.vectorProperties_floats_size[j])
+			return false;
+
+		if (memcmp(lhs.vectorProperties_values[i], rhs.vectorProperties_values[j], lhs.vectorProperties_floats_size[i] * sizeof(cgltf_float)) != 0)
+			return false;
+	}
+
+	for (cgltf_size i = 0; i < lhs.keywordMap_count; ++i)
+	{
+		int j = findKey(rhs.keywordMap_keys, rhs.keywordMap_count, lhs.keywordMap_keys[i]);
+
+		if (j < 0 || !lhs.keywordMap_values[i] != !rhs.keywordMap_values[j])
+			return false;
+	}
+
+	for (cgltf_size i = 0; i < lhs.tagMap_count; ++i)
+	{
+		int j = findKey(rhs.tagMap_keys, rhs.tagMap_count, lhs.tagMap_keys[i]);
+
+		if (j < 0 || !isSameString(lhs.tagMap_values[i], rhs.tagMap_values[j]))
+			return false;
+	}
+
+	// textures that end up in the atlas may differ; anything else (e.g. _SphereAdd) must be shared
+	for (cgltf_size i = 0; i < lhs.textureProperties_count; ++i)
+	{
+		const char* key = lhs.textureProperties_keys[i];
+		int j = findKey(rhs.textureProperties_keys, rhs.textureProperties_count, key);
+
+		if (j < 0)
+			return false;
+
+		if (atlas && (strcmp(key, "_MainTex") == 0 || strcmp(key, "_ShadeTexture") == 0))
+			continue;
+
+		if (lhs.textureProperties_values[i] != rhs.textureProperties_values[j])
+			return false;
+	}
+
+	return true;
+}
+
+static bool isSameGltfMaterial(const cgltf_material& lhs, const cgltf_material& rhs)
+{
+	const cgltf_pbr_metallic_roughness& lpbr = lhs.pbr_metallic_roughness;
+	const cgltf_pbr_metallic_roughness& rpbr = rhs.pbr_metallic_roughness;
+
+	return lhs.has_pbr_metallic_roughness == rhs.has_pbr_metallic_roughness &&
+	       memcmp(lpbr.base_color_factor, rpbr.base_color_factor, sizeof(lpbr.base_color_factor)) == 0 &&
+	       lpbr.metallic_factor == rpbr.metallic_factor && lpbr.roughness_factor == rpbr.roughness_factor &&
+	       memcmp(lhs.emissive_factor, rhs.emissive_factor, sizeof(lhs.emissive_factor)) == 0 &&
+	       lhs.alpha_mode == rhs.alpha_mode && lhs.alpha_cutoff == rhs.alpha_cutoff &&
+	       lhs.double_sided == rhs.double_sided && lhs.unlit == rhs.unlit &&
+	       (lhs.pbr_metallic_roughness.base_color_texture.texture == NULL) == (rhs.pbr_metallic_roughness.base_color_texture.texture == NULL);
+}
+
+static bool isValidTexture(const cgltf_data* data, cgltf_int index)
+{
+	return index >= 0 && cgltf_size(index) < data->textures_count && data->textures[index].image;
+}
+
+static bool isAtlasCandidate(cgltf_data* data, cgltf_material& material, const cgltf_vrm_material_v0_0& vrm)
+{
+	if (!isSameString(vrm.shader, "VRM/MToon") || material.extensions_count)
+		return false;
+
+	if (material.has_pbr_specular_glossiness || material.has_clearcoat || material.has_transmission || material.has_ior || material.has_specular || material.has_sheen)
+		return false;
+
+	cgltf_int main = getTextureProperty(vrm, "_MainTex");
+	cgltf_int shade = getTextureProperty(vrm, "_ShadeTexture");
+
+	if (!isValidTexture(data, main) || (shade >= 0 && !isValidTexture(data, shade)))
+		return false;
+
+	// other MToon textures are sampled with the same UVs; _SphereAdd is a matcap and does not use them
+	for (cgltf_size i = 0; i < vrm.textureProperties_count; ++i)
+	{
+		const char* key = vrm.textureProperties_keys[i];
+
+		if (strcmp(key, "_MainTex") != 0 && strcmp(key, "_ShadeTexture") != 0 && strcmp(key, "_SphereAdd") != 0)
+			return false;
+	}
+
+	// tiling, offsets and UV scrolling would be applied across the entire atlas
+	int st = findKey(vrm.vectorProperties_keys, vrm.vectorProperties_count, "_MainTex");
+	if (st >= 0)
+	{
+		static const cgltf_float kIdentity[4] = {0, 0, 1, 1};
+
+		if (vrm.vectorProperties_floats_size[st] != 4 || memcmp(vrm.vectorProperties_values[st], kIdentity, sizeof(kIdentity)) != 0)
+			return false;
+	}
+
+	static const char* const kUvAnimation[] = {"_UvAnimScrollX", "_UvAnimScrollY", "_UvAnimRotation"};
+
+	for (size_t i = 0; i < sizeof(kUvAnimation) / sizeof(kUvAnimation[0]); ++i)
+	{
+		int index = findKey(vrm.floatProperties_keys, vrm.floatProperties_count, kUvAnimation[i]);
+
+		if (index >= 0 && vrm.floatProperties_values[index] != 0)
+			return false;
+	}
+
+	cgltf_texture_view* views[kTextureViewCount];
+	int count = getTextureViews(material, views);
+
+	for (int i = 0; i < count; ++i)
+	{
+		const cgltf_texture_view& view = *views[i];
+
+		if (!view.texture)
+			continue;
+
+		if (views[i] != &material.pbr_metallic_roughness.base_color_texture || view.texture != &data->textures[main])
+			return false;
+
+		if (view.texcoord != 0 || view.has_transform || view.extensions_count)
+			return false;
+	}
+
+	return true;
+}
+
+static const cgltf_accessor* getTexcoord(const cgltf_primitive& primitive)
+{
+	for (cgltf_size i = 0; i < primitive.attributes_count; ++i)
+		if (primitive.attributes[i].type == cgltf_attribute_type_texcoord && primitive.attributes[i].index == 0)
+			return primitive.attributes[i].data;
+
+	return NULL;
+}
+
+static bool isAtlasPrimitive(const cgltf_primitive& primitive)
+{
+	const cgltf_accessor* accessor = getTexcoord(primitive);
+
+	if (!accessor || accessor->component_type != cgltf_component_type_r_32f || accessor->type != cgltf_type_vec2 || accessor->normalized)
+		return false;
+
+	if (accessor->is_sparse || !accessor->buffer_view || !cgltf_buffer_view_data(accessor->buffer_view) || primitive.has_draco_mesh_compression)
+		return false;
+
+	for (cgltf_size i = 0; i < primitive.targets_count; ++i)
+		for (cgltf_size j = 0; j < primitive.targets[i].attributes_count; ++j)
+			if (primitive.targets[i].attributes[j].type == cgltf_attribute_type_texcoord)
+				return false;
+
+	// wrapping UVs cannot be represented inside an atlas cell
+	for (cgltf_size i = 0; i < accessor->count; ++i)
+	{
+		float uv[2] = {};
+		cgltf_accessor_read_float(accessor, i, uv, 2);
+
+		if (uv[0] < -kAtlasUvTolerance || uv[0] > 1 + kAtlasUvTolerance || uv[1] < -kAtlasUvTolerance || uv[1] > 1 + kAtlasUvTolerance)
+			return false;
+	}
+
+	return true;
+}
+
+struct MaterialBinding
+{
+	size_t group;
+	const cgltf_vrm_blendshape_materialbind_v0_0* bind;
+
+	bool operator<(const MaterialBinding& other) const
+	{
+		return group != other.group ? group < other.group : strcmp(bind->propertyName ? bind->propertyName : "", other.bind->propertyName ? other.bind->propertyName : "") < 0;
+	}
+};
+
+static void getBindings(const cgltf_data* data, const char* name, std::vector<MaterialBinding>& result)
+{
+	const cgltf_vrm_blendshape_v0_0& master = data->vrm_v0_0.blendShapeMaster;
+
+	for (cgltf_size i = 0; i < master.blendShapeGroups_count; ++i)
+	{
+		const cgltf_vrm_blendshape_group_v0_0& group = master.blendShapeGroups[i];
+
+		for (cgltf_size j = 0; j < group.materialValues_count; ++j)
+		{
+			const cgltf_vrm_blendshape_materialbind_v0_0& bind = group.materialValues[j];
+
+			if (!isSameString(bind.materialName, name))
+				continue;
+
+			MaterialBinding binding = {i, &bind};
+			result.push_back(binding);
+		}
+	}
+
+	std::sort(result.begin(), result.end());
+}
+
+static bool hasTextureTransformBindings(const std::vector<MaterialBinding>& bindings)
+{
+	for (size_t i = 0; i < bindings.size(); ++i)
+	{
+		const char* property = bindings[i].bind->propertyName;
+		size_t length = property ? strlen(property) : 0;
+
+		if (length >= 3 && strcmp(property + length - 3, "_ST") == 0)
+			return true;
+	}
+
+	return false;
+}
+
+static bool isSameBindings(const std::vector<MaterialBinding>& lhs, const std::vector<MaterialBinding>& rhs)
+{
+	if (lhs.size() != rhs.size())
+		return false;
+
+	for (size_t i = 0; i < lhs.size(); ++i)
+	{
+		const cgltf_vrm_blendshape_materialbind_v0_0& lb = *lhs[i].bind;
+		const cgltf_vrm_blendshape_materialbind_v0_0& rb = *rhs[i].bind;
+
+		if (lhs[i].group != rhs[i].group || !isSameString(lb.propertyName, rb.propertyName) || lb.targetValue_count != rb.targetValue_count)
+			return false;
+
+		if (lb.targetValue_count && memcmp(lb.targetValue, rb.targetValue, lb.targetValue_count * sizeof(cgltf_float)) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+struct AtlasCell
+{
+	cgltf_image* main;
+	cgltf_image* shade;
+
+	Image main_pixels;
+	Image shade_pixels;
+
+	int x, y;
+};
+
+static bool isSameCell(const AtlasCell& lhs, const AtlasCell& rhs)
+{
+	if ((lhs.shade == lhs.main) != (rhs.shade == rhs.main) || (lhs.shade == NULL) != (rhs.shade == NULL))
+		return false;
+
+	return lhs.main_pixels.width == rhs.main_pixels.width && lhs.main_pixels.height == rhs.main_pixels.height &&
+	       lhs.main_pixels.pixels == rhs.main_pixels.pixels && lhs.shade_pixels.pixels == rhs.shade_pixels.pixels;
+}
+
+static bool packCells(std::vector<AtlasCell>& cells, int& atlas_width, int& atlas_height)
+{
+	std::vector<size_t> order(cells.size());
+	size_t area = 0;
+	int max_width = 0;
+
+	for (size_t i = 0; i < cells.size(); ++i)
+	{
+		int w = cells[i].main_pixels.width + kAtlasPadding * 2;
+		int h = cells[i].main_pixels.height + kAtlasPadding * 2;
+
+		order[i] = i;
+		area += size_t(w) * h;
+		max_width = std::max(max_width, w);
+	}
+
+	// shelf packing, tallest cells first
+	std::sort(order.begin(), order.end(), [&](size_t l, size_t r) { return cells[l].main_pixels.height > cells[r].main_pixels.height; });
+
+	int width = 1;
+	while (width < max_width || size_t(width) * width < area)
+		width *= 2;
+
+	for (; width <= kAtlasMaxSize; width *= 2)
+	{
+		int x = 0, y = 0, shelf = 0;
+
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			AtlasCell& cell = cells[order[i]];
+			int w = cell.main_pixels.width + kAtlasPadding * 2;
+			int h = cell.main_pixels.height + kAtlasPadding * 2;
+
+			if (x + w > width)
+			{
+				y += shelf;
+				x = 0;
+				shelf = 0;
+			}
+
+			cell.x = x;
+			cell.y = y;
+
+			x += w;
+			shelf = std::max(shelf, h);
+		}
+
+		int height = y + shelf;
+
+		if (height <= width || (width * 2 > kAtlasMaxSize && height <= kAtlasMaxSize))
+		{
+			atlas_width = width;
+			atlas_height = (height + 3) & ~3;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void blitCell(Image& atlas, const Image& image, int x, int y)
+{
+	// the padding repeats edge texels so that filtering and mip levels do not pick up neighbouring cells
+	for (int cy = -kAtlasPadding; cy < image.height + kAtlasPadding; ++cy)
+		for (int cx = -kAtlasPadding; cx < image.width + kAtlasPadding; ++cx)
+		{
+			int sx = std::min(std::max(cx, 0), image.width - 1);
+			int sy = std::min(std::max(cy, 0), image.height - 1);
+
+			const uint8_t* source = &image.pixels[(size_t(sy) * image.width + sx) * 4];
+			uint8_t* target = &atlas.pixels[(size_t(y + kAtlasPadding + cy) * atlas.width + (x + kAtlasPadding + cx)) * 4];
+
+			memcpy(target, source, 4);
+		}
+}
+
+template <typename T>
+static void rebase(T*& pointer, const T* from, T* to)
+{
+	if (pointer)
+		pointer = to + (pointer - from);
+}
+
+template <typename T>
+static T* growArray(cgltf_data* data, const T* array, cgltf_size count)
+{
+	T* result = (T*)data->memory.alloc(data->memory.user_data, sizeof(T) * (count + 1));
+
+	memcpy(result, array, sizeof(T) * count);
+	memset(result + count, 0, sizeof(T));
+
+	return result;
+}
+
+static cgltf_buffer_view* appendBufferView(cgltf_data* data)
+{
+	cgltf_buffer_view* views = growArray(data, data->buffer_views, data->buffer_views_count);
+
+	for (cgltf_size i = 0; i < data->accessors_count; ++i)
+	{
+		cgltf_accessor& accessor = data->accessors[i];
+
+		rebase(accessor.buffer_view, data->buffer_views, views);
+		rebase(accessor.sparse.indices_buffer_view, data->buffer_views, views);
+		rebase(accessor.sparse.values_buffer_view, data->buffer_views, views);
+	}
+
+	for (cgltf_size i = 0; i < data->images_count; ++i)
+		rebase(data->images[i].buffer_view, data->buffer_views, views);
+
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+			rebase(data->meshes[i].primitives[j].draco_mesh_compression.buffer_view, data->buffer_views, views);
+
+	data->memory.free(data->memory.user_data, data->buffer_views);
+	data->buffer_views = views;
+
+	return &data->buffer_views[data->buffer_views_count++];
+}
+
+static cgltf_image* appendImage(cgltf_data* data)
+{
+	cgltf_image* images = growArray(data, data->images, data->images_count);
+
+	for (cgltf_size i = 0; i < data->textures_count; ++i)
+		rebase(data->textures[i].image, data->images, images);
+
+	data->memory.free(data->memory.user_data, data->images);
+	data->images = images;
+
+	return &data->images[data->images_count++];
+}
+
+static cgltf_texture* appendTexture(cgltf_data* data)
+{
+	cgltf_texture* textures = growArray(data, data->textures, data->textures_count);
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		cgltf_texture_view* views[kTextureViewCount];
+		int count = getTextureViews(data->materials[i], views);
+
+		for (int j = 0; j < count; ++j)
+			rebase(views[j]->texture, data->textures, textures);
+	}
+
+	data->memory.free(data->memory.user_data, data->textures);
+	data->textures = textures;
+
+	return &data->textures[data->textures_count++];
+}
+
+static cgltf_int addAtlasTexture(cgltf_data* data, const std::vector<uint8_t>& encoded, bool jpeg, const char* name, cgltf_sampler* sampler)
+{
+	cgltf_buffer_view* view = appendBufferView(data);
+	view->buffer = &data->buffers[0];
+	view->buffer_index = 0;
+	view->size = encoded.size();
+	view->data = data->memory.alloc(data->memory.user_data, encoded.size());
+	memcpy(view->data, encoded.data(), encoded.size());
+
+	cgltf_image* image = appendImage(data);
+	image->name = copyString(data, name);
+	image->mime_type = copyString(data, jpeg ? "image/jpeg" : "image/png");
+	image->buffer_view = view;
+
+	cgltf_texture* texture = appendTexture(data);
+	texture->name = copyString(data, name);
+	texture->image = image;
+	texture->image_index = cgltf_int(image - data->images);
+	texture->sampler = sampler;
+
+	return cgltf_int(texture - data->textures);
+}
+
+static void remapTexcoords(cgltf_data* data, const cgltf_primitive& primitive, float scale_u, float scale_v, float offset_u, float offset_v)
+{
+	cgltf_accessor& accessor = *const_cast<cgltf_accessor*>(getTexcoord(primitive));
+	cgltf_buffer_view& view = *accessor.buffer_view;
+
+	// the buffer may be the caller's input or the mapped input file, so the view gets its own copy instead of being written in place
+	if (!view.data)
+	{
+		void* contents = data->memory.alloc(data->memory.user_data, view.size + 1);
+		memcpy(contents, cgltf_buffer_view_data(&view), view.size);
+		view.data = contents;
+	}
+
+	uint8_t* base = (uint8_t*)view.data;
+	base += accessor.offset;
+
+	for (cgltf_size i = 0; i < accessor.count; ++i)
+	{
+		float uv[2];
+		memcpy(uv, base + i * accessor.stride, sizeof(uv));
+
+		uv[0] = uv[0] * scale_u + offset_u;
+		uv[1] = uv[1] * scale_v + offset_v;
+
+		memcpy(base + i * accessor.stride, uv, sizeof(uv));
+	}
+
+	if (accessor.has_min)
+	{
+		accessor.min[0] = accessor.min[0] * scale_u + offset_u;
+		accessor.min[1] = accessor.min[1] * scale_v + offset_v;
+	}
+
+	if (accessor.has_max)
+	{
+		accessor.max[0] = accessor.max[0] * scale_u + offset_u;
+		accessor.max[1] = accessor.max[1] * scale_v + offset_v;
+	}
+}
+
+static void freeVrmMaterial(cgltf_data* data, cgltf_vrm_material_v0_0& material)
+{
+	const cgltf_memory_options& memory = data->memory;
+
+	memory.free(memory.user_data, material.name);
+	memory.free(memory.user_data, material.shader);
+
+	for (cgltf_size i = 0; i < material.floatProperties_count; ++i)
+		memory.free(memory.user_data, material.floatProperties_keys[i]);
+	memory.free(memory.user_data, material.floatProperties_keys);
+	memory.free(memory.user_data, material.floatProperties_values);
+
+	for (cgltf_size i = 0; i < material.vectorProperties_count; ++i)
+	{
+		memory.free(memory.user_data, material.vectorProperties_keys[i]);
+		memory.free(memory.user_data, material.vectorProperties_values[i]);
+	}
+	memory.free(memory.user_data, material.vectorProperties_keys);
+	memory.free(memory.user_data, material.vectorProperties_values);
+	memory.free(memory.user_data, material.vectorProperties_floats_size);
+
+	for (cgltf_size i = 0; i < material.textureProperties_count; ++i)
+		memory.free(memory.user_data, material.textureProperties_keys[i]);
+	memory.free(memory.user_data, material.textureProperties_keys);
+	memory.free(memory.user_data, material.textureProperties_values);
+
+	for (cgltf_size i = 0; i < material.keywordMap_count; ++i)
+		memory.free(memory.user_data, material.keywordMap_keys[i]);
+	memory.free(memory.user_data, material.keywordMap_keys);
+	memory.free(memory.user_data, material.keywordMap_values);
+
+	for (cgltf_size i = 0; i < material.tagMap_count; ++i)
+	{
+		memory.free(memory.user_data, material.tagMap_keys[i]);
+		memory.free(memory.user_data, material.tagMap_values[i]);
+	}
+	memory.free(memory.user_data, material.tagMap_keys);
+	memory.free(memory.user_data, material.tagMap_values);
+}
+
+static void freeGltfMaterial(cgltf_data* data, cgltf_material& material)
+{
+	cgltf_texture_view* views[kTextureViewCount];
+	int count = getTextureViews(material, views);
+
+	for (int i = 0; i < count; ++i)
+		freeExtensions(data, views[i]->extensions, views[i]->extensions_count);
+
+	data->memory.free(data->memory.user_data, material.name);
+	freeExtensions(data, material.extensions, material.extensions_count);
+}
+
+static void renameBindings(cgltf_data* data, const std::vector<cgltf_size>& target)
+{
+	cgltf_vrm_blendshape_v0_0& master = data->vrm_v0_0.blendShapeMaster;
+	data->vrm_v0_0_spans.blendShapeMaster.dirty = true;
+
+	std::unordered_map<std::string, cgltf_size> names;
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		if (target[i] != i && data->materials[i].name)
+			names[data->materials[i].name] = target[i];
+
+	for (cgltf_size i = 0; i < master.blendShapeGroups_count; ++i)
+	{
+		cgltf_vrm_blendshape_group_v0_0& group = master.blendShapeGroups[i];
+		cgltf_size write = 0;
+
+		for (cgltf_size j = 0; j < group.materialValues_count; ++j)
+		{
+			cgltf_vrm_blendshape_materialbind_v0_0& bind = group.materialValues[j];
+
+			std::unordered_map<std::string, cgltf_size>::const_iterator it = bind.materialName ? names.find(bind.materialName) : names.end();
+
+			if (it != names.end())
+			{
+				data->memory.free(data->memory.user_data, bind.materialName);
+				bind.materialName = copyString(data, data->materials[it->second].name);
+			}
+
+			// merged materials carried identical binds, so the renamed copies are duplicates
+			bool duplicate = false;
+			for (cgltf_size k = 0; k < write && !duplicate; ++k)
+				duplicate = isSameString(group.materialValues[k].materialName, bind.materialName) && isSameString(group.materialValues[k].propertyName, bind.propertyName);
+
+			if (duplicate)
+			{
+				data->memory.free(data->memory.user_data, bind.materialName);
+				data->memory.free(data->memory.user_data, bind.propertyName);
+				data->memory.free(data->memory.user_data, bind.targetValue);
+				continue;
+			}
+
+			group.materialValues[write++] = bind;
+		}
+
+		group.materialValues_count = write;
+	}
+}
+
+static void removeMaterials(cgltf_data* data, const std::vector<cgltf_size>& target, const std::vector<cgltf_vrm_material_v0_0*>& vrm_materials)
+{
+	std::vector<cgltf_size> remap(data->materials_count);
+	cgltf_size write = 0;
+
+	// targets always precede the materials merged into them, so their new index is known by the time it is needed
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		remap[i] = target[i] == i ? write++ : remap[target[i]];
+
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+		{
+			cgltf_primitive& primitive = data->meshes[i].primitives[j];
+
+			if (primitive.material)
+			{
+				primitive.material_index = cgltf_int(remap[primitive.material - data->materials]);
+				primitive.material = &data->materials[primitive.material_index];
+			}
+		}
+
+	cgltf_vrm_v0_0& vrm = data->vrm_v0_0;
+	std::vector<bool> vrm_removed(vrm.materialProperties_count);
+	data->vrm_v0_0_spans.materialProperties.dirty = true;
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		if (target[i] == i)
+		{
+			data->materials[remap[i]] = data->materials[i];
+			continue;
+		}
+
+		freeGltfMaterial(data, data->materials[i]);
+
+		if (vrm_materials[i])
+			vrm_removed[vrm_materials[i] - vrm.materialProperties] = true;
+	}
+
+	data->materials_count = write;
+
+	cgltf_size vrm_write = 0;
+	for (cgltf_size i = 0; i < vrm.materialProperties_count; ++i)
+	{
+		if (vrm_removed[i])
+			freeVrmMaterial(data, vrm.materialProperties[i]);
+		else
+			vrm.materialProperties[vrm_write++] = vrm.materialProperties[i];
+	}
+
+	vrm.materialProperties_count = vrm_write;
+}
+
+static bool buildAtlas(cgltf_data* data, std::vector<cgltf_size>& members, const std::vector<std::vector<cgltf_primitive*> >& primitives, const std::vector<cgltf_vrm_material_v0_0*>& vrm_materials, const Settings& settings)
+{
+	std::vector<AtlasCell> cells;
+	std::vector<size_t> member_cells;
+	std::vector<cgltf_size> kept;
+
+	bool main_jpeg = true, shade_jpeg = true, shared_shade = true;
+
+	for (size_t i = 0; i < members.size(); ++i)
+	{
+		const cgltf_vrm_material_v0_0& vrm = *vrm_materials[members[i]];
+
+		cgltf_int main_index = getTextureProperty(vrm, "_MainTex");
+		cgltf_int shade_index = getTextureProperty(vrm, "_ShadeTexture");
+
+		cgltf_image* main = data->textures[main_index].image;
+		cgltf_image* shade = shade_index >= 0 ? data->textures[shade_index].image : NULL;
+
+		size_t cell = 0;
+		while (cell < cells.size() && (cells[cell].main != main || cells[cell].shade != shade))
+			cell++;
+
+		if (cell == cells.size())
+		{
+			AtlasCell added = {};
+			added.main = main;
+			added.shade = shade;
+
+			bool jpeg = false, shade_is_jpeg = false;
+
+			if (!decodeImage(*main, added.main_pixels, jpeg))
+				continue;
+
+			if (shade && shade != main)
+			{
+				// shade cells share the main texture layout, so both images must have the same size
+				if (!decodeImage(*shade, added.shade_pixels, shade_is_jpeg) || added.shade_pixels.width != added.main_pixels.width || added.shade_pixels.height != added.main_pixels.height)
+					continue;
+			}
+
+			// atlasing runs before duplicate images are merged, so identical contents may come from different images
+			cell = 0;
+			while (cell < cells.size() && !isSameCell(cells[cell], added))
+				cell++;
+
+			if (cell == cells.size())
+			{
+				main_jpeg &= jpeg;
+				shade_jpeg &= shade && shade != main ? shade_is_jpeg : jpeg;
+				cells.push_back(added);
+			}
+		}
+
+		shared_shade &= shade == main;
+		member_cells.push_back(cell);
+		kept.push_back(members[i]);
+	}
+
+	members.swap(kept);
+
+	if (members.size() < 2)
+		return false;
+
+	// all members use identical textures, so they can be merged as is
+	if (cells.size() == 1)
+		return true;
+
+	int atlas_width = 0, atlas_height = 0;
+	if (!packCells(cells, atlas_width, atlas_height))
+	{
+		if (settings.verbose)
+			fprintf(stderr, "Warning: textures of material %s do not fit into a %dx%d atlas\n", data->materials[members[0]].name, kAtlasMaxSize, kAtlasMaxSize);
+		return false;
+	}
+
+	Image main_atlas = {atlas_width, atlas_height, std::vector<uint8_t>(size_t(atlas_width) * atlas_height * 4)};
+	Image shade_atlas = {atlas_width, atlas_height, std::vector<uint8_t>(shared_shade ? 0 : size_t(atlas_width) * atlas_height * 4)};
+
+	for (size_t i = 0; i < cells.size(); ++i)
+	{
+		const AtlasCell& cell = cells[i];
+
+		blitCell(main_atlas, cell.main_pixels, cell.x, cell.y);
+
+		// materials without a shade texture get their main texture, which is what MToon would sample in its place
+		if (!shared_shade)
+			blitCell(shade_atlas, cell.shade && cell.shade != cell.main ? cell.shade_pixels : cell.main_pixels, cell.x, cell.y);
+	}
+
+	std::vector<uint8_t> encoded;
+	if (!encodeImage(main_atlas, main_jpeg, encoded))
+		return false;
+
+	std::vector<uint8_t> shade_encoded;
+	if (!shared_shade && !encodeImage(shade_atlas, shade_jpeg, shade_encoded))
+		return false;
+
+	cgltf_vrm_material_v0_0& target = *vrm_materials[members[0]];
+	cgltf_sampler* main_sampler = data->textures[getTextureProperty(target, "_MainTex")].sampler;
+	cgltf_int shade_texture = getTextureProperty(target, "_ShadeTexture");
+	cgltf_sampler* shade_sampler = shade_texture >= 0 ? data->textures[shade_texture].sampler : main_sampler;
+
+	std::string name = std::string(data->materials[members[0]].name ? data->materials[members[0]].name : "material");
+
+	cgltf_int main_atlas_texture = addAtlasTexture(data, encoded, main_jpeg, (name + "_atlas").c_str(), main_sampler);
+	cgltf_int shade_atlas_texture = shared_shade ? main_atlas_texture : addAtlasTexture(data, shade_encoded, shade_jpeg, (name + "_shade_atlas").c_str(), shade_sampler);
+
+	setTextureProperty(target, "_MainTex", main_atlas_texture);
+	setTextureProperty(target, "_ShadeTexture", shade_atlas_texture);
+
+	cgltf_material& material = data->materials[members[0]];
+	if (material.pbr_metallic_roughness.base_color_texture.texture)
+		material.pbr_metallic_roughness.base_color_texture.texture = &data->textures[main_atlas_texture];
+
+	std::unordered_set<const cgltf_accessor*> remapped;
+
+	for (size_t i = 0; i < members.size(); ++i)
+	{
+		const AtlasCell& cell = cells[member_cells[i]];
+
+		float scale_u = float(cell.main_pixels.width) / float(atlas_width);
+		float scale_v = float(cell.main_pixels.height) / float(atlas_height);
+		float offset_u = float(cell.x + kAtlasPadding) / float(atlas_width);
+		float offset_v = float(cell.y + kAtlasPadding) / float(atlas_height);
+
+		const std::vector<cgltf_primitive*>& list = primitives[members[i]];
+
+		for (size_t j = 0; j < list.size(); ++j)
+			if (remapped.insert(getTexcoord(*list[j])).second)
+				remapTexcoords(data, *list[j], scale_u, scale_v, offset_u, offset_v);
+	}
+
+	if (settings.verbose)
+		fprintf(stderr, "atlas %s: %d materials, %d cells, %dx%d\n", name.c_str(), int(members.size()), int(cells.size()), atlas_width, atlas_height);
+
+	return true;
+}
+
+void atlasMaterials(cgltf_data* data, const Settings& settings)
+{
+	if (!data->has_vrm_v0_0 || data->buffers_count == 0 || !cgltf_buffer_data(&data->buffers[0]))
+		return;
+
+	std::vector<std::vector<cgltf_primitive*> > primitives(data->materials_count);
+	std::vector<cgltf_vrm_material_v0_0*> vrm_materials(data->materials_count);
+	std::vector<bool> candidates(data->materials_count);
+
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+		{
+			cgltf_primitive& primitive = data->meshes[i].primitives[j];
+
+			if (primitive.material)
+				primitives[primitive.material - data->materials].push_back(&primitive);
+		}
+
+	std::unordered_map<const cgltf_vrm_material_v0_0*, int> vrm_uses;
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		vrm_materials[i] = findVrmMaterial(data, i);
+		vrm_uses[vrm_materials[i]]++;
+	}
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		// duplicate material names make the VRM properties ambiguous
+		candidates[i] = vrm_materials[i] && vrm_uses[vrm_materials[i]] == 1 && !primitives[i].empty() && isAtlasCandidate(data, data->materials[i], *vrm_materials[i]);
+
+		for (size_t j = 0; j < primitives[i].size() && candidates[i]; ++j)
+			candidates[i] = isAtlasPrimitive(*primitives[i][j]);
+	}
+
+	// a UV accessor shared between materials cannot be remapped for one of them alone
+	std::unordered_map<const cgltf_accessor*, cgltf_size> uv_owners;
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		for (size_t j = 0; j < primitives[i].size(); ++j)
+		{
+			const cgltf_accessor* accessor = getTexcoord(*primitives[i][j]);
+
+			if (!accessor)
+				continue;
+
+			std::pair<std::unordered_map<const cgltf_accessor*, cgltf_size>::iterator, bool> it = uv_owners.insert(std::make_pair(accessor, i));
+
+			if (!it.second && it.first->second != i)
+			{
+				candidates[i] = false;
+				candidates[it.first->second] = false;
+			}
+		}
+
+	std::vector<std::vector<MaterialBinding> > bindings(data->materials_count);
+
+	// texture transform animation (e.g. _MainTex_ST) would move across atlas cells
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		if (candidates[i])
+		{
+			getBindings(data, data->materials[i].name, bindings[i]);
+			candidates[i] = !hasTextureTransformBindings(bindings[i]);
+		}
+
+	std::vector<std::vector<cgltf_size> > groups;
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		if (!candidates[i])
+			continue;
+
+		size_t g = 0;
+
+		for (; g < groups.size(); ++g)
+		{
+			cgltf_size first = groups[g][0];
+
+			cgltf_int main = getTextureProperty(*vrm_materials[i], "_MainTex");
+			cgltf_int first_main = getTextureProperty(*vrm_materials[first], "_MainTex");
+			cgltf_int shade = getTextureProperty(*vrm_materials[i], "_ShadeTexture");
+			cgltf_int first_shade = getTextureProperty(*vrm_materials[first], "_ShadeTexture");
+
+			if (data->textures[main].sampler != data->textures[first_main].sampler || (shade >= 0) != (first_shade >= 0))
+				continue;
+
+			if (shade >= 0 && data->textures[shade].sampler != data->textures[first_shade].sampler)
+				continue;
+
+			if (isSameVrmProperties(*vrm_materials[i], *vrm_materials[first], true) && isSameGltfMaterial(data->materials[i], data->materials[first]) && isSameBindings(bindings[i], bindings[first]))
+				break;
+		}
+
+		if (g == groups.size())
+			groups.push_back(std::vector<cgltf_size>());
+
+		groups[g].push_back(i);
+	}
+
+	std::vector<cgltf_size> target(data->materials_count);
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		target[i] = i;
+
+	bool merged = false;
+
+	for (size_t g = 0; g < groups.size(); ++g)
+	{
+		if (groups[g].size() < 2 || !buildAtlas(data, groups[g], primitives, vrm_materials, settings))
+			continue;
+
+		for (size_t i = 1; i < groups[g].size(); ++i)
+			target[groups[g][i]] = groups[g][0];
+
+		merged = true;
+	}
+
+	if (!merged)
+		return;
+
+	renameBindings(data, target);
+	removeMaterials(data, target, vrm_materials);
+}
+
+struct PropertyDefault
+{
+	const char* key;
+	cgltf_float value[4];
+};
+
+// MToon shader defaults for shading parameters; render state (_BlendMode, _CullMode, _ZWrite, ...) is always kept
+// since importers derive the pipeline state from it
+static const PropertyDefault kMToonFloatDefaults[] = {
+    {"_Cutoff", {0.5f}},
+    {"_BumpScale", {1.f}},
+    {"_ReceiveShadowRate", {1.f}},
+    {"_ShadingGradeRate", {1.f}},
+    {"_ShadeShift", {0.f}},
+    {"_ShadeToony", {0.9f}},
+    {"_LightColorAttenuation", {0.f}},
+    {"_IndirectLightIntensity", {0.1f}},
+    {"_RimLightingMix", {0.f}},
+    {"_RimFresnelPower", {1.f}},
+    {"_RimLift", {0.f}},
+    {"_OutlineWidth", {0.5f}},
+    {"_OutlineScaledMaxDistance", {1.f}},
+    {"_OutlineLightingMix", {1.f}},
+    {"_UvAnimScrollX", {0.f}},
+    {"_UvAnimScrollY", {0.f}},
+    {"_UvAnimRotation", {0.f}},
+};
+
+static const PropertyDefault kMToonVectorDefaults[] = {
+    {"_Color", {1.f, 1.f, 1.f, 1.f}},
+    {"_ShadeColor", {0.97f, 0.81f, 0.86f, 1.f}},
+    {"_RimColor", {0.f, 0.f, 0.f, 1.f}},
+    {"_EmissionColor", {0.f, 0.f, 0.f, 1.f}},
+    {"_OutlineColor", {0.f, 0.f, 0.f, 1.f}},
+};
+
+// texture scale/offset vectors are keyed by texture property name
+static const char* const kMToonTextures[] = {
+    "_MainTex",
+    "_ShadeTexture",
+    "_BumpMap",
+    "_ReceiveShadowTexture",
+    "_ShadingGradeTexture",
+    "_RimTexture",
+    "_SphereAdd",
+    "_EmissionMap",
+    "_OutlineWidthTexture",
+    "_UvAnimMaskTexture",
+};
+
+static bool isDefaultFloat(const char* key, cgltf_float value)
+{
+	for (size_t i = 0; i < sizeof(kMToonFloatDefaults) / sizeof(kMToonFloatDefaults[0]); ++i)
+		if (strcmp(kMToonFloatDefaults[i].key, key) == 0)
+			return kMToonFloatDefaults[i].value[0] == value;
+
+	return false;
+}
+
+static bool isDefaultVector(const char* key, const cgltf_float* value, cgltf_size size)
+{
+	if (size != 4)
+		return false;
+
+	for (size_t i = 0; i < sizeof(kMToonVectorDefaults) / sizeof(kMToonVectorDefaults[0]); ++i)
+		if (strcmp(kMToonVectorDefaults[i].key, key) == 0)
+			return memcmp(kMToonVectorDefaults[i].value, value, sizeof(cgltf_float) * 4) == 0;
+
+	static const cgltf_float kIdentity[4] = {0, 0, 1, 1};
+
+	for (size_t i = 0; i < sizeof(kMToonTextures) / sizeof(kMToonTextures[0]); ++i)
+		if (strcmp(kMToonTextures[i], key) == 0)
+			return memcmp(kIdentity, value, sizeof(kIdentity)) == 0;
+
+	return false;
+}
+
+template <typename T>
+static void permute(T* array, const std::vector<cgltf_size>& order)
+{
+	std::vector<T> copy(array, array + order.size());
+
+	for (size_t i = 0; i < order.size(); ++i)
+		array[i] = copy[order[i]];
+}
+
+// sorts parallel key/value arrays by key; returns the permutation to apply to value arrays
+static std::vector<cgltf_size> sortKeys(char** keys, cgltf_size count)
+{
+	std::vector<cgltf_size> order(count);
+	for (cgltf_size i = 0; i < count; ++i)
+		order[i] = i;
+
+	std::sort(order.begin(), order.end(), [&](cgltf_size l, cgltf_size r) { return strcmp(keys[l] ? keys[l] : "", keys[r] ? keys[r] : "") < 0; });
+
+	permute(keys, order);
+	return order;
+}
+
+static void canonicalizeMaterial(cgltf_data* data, cgltf_vrm_material_v0_0& material)
+{
+	const cgltf_memory_options& memory = data->memory;
+	bool mtoon = isSameString(material.shader, "VRM/MToon");
+
+	permute(material.floatProperties_values, sortKeys(material.floatProperties_keys, material.floatProperties_count));
+
+	std::vector<cgltf_size> vector_order = sortKeys(material.vectorProperties_keys, material.vectorProperties_count);
+	permute(material.vectorProperties_values, vector_order);
+	permute(material.vectorProperties_floats_size, vector_order);
+
+	permute(material.textureProperties_values, sortKeys(material.textureProperties_keys, material.textureProperties_count));
+	permute(material.keywordMap_values, sortKeys(material.keywordMap_keys, material.keywordMap_count));
+	permute(material.tagMap_values, sortKeys(material.tagMap_keys, material.tagMap_count));
+
+	cgltf_size write = 0;
+	for (cgltf_size i = 0; i < material.floatProperties_count; ++i)
+	{
+		if (mtoon && material.floatProperties_keys[i] && isDefaultFloat(material.floatProperties_keys[i], material.floatProperties_values[i]))
+		{
+			memory.free(memory.user_data, material.floatProperties_keys[i]);
+			continue;
+		}
+
+		material.floatProperties_keys[write] = material.floatProperties_keys[i];
+		material.floatProperties_values[write] = material.floatProperties_values[i];
+		write++;
+	}
+	material.floatProperties_count = write;
+
+	write = 0;
+	for (cgltf_size i = 0; i < material.vectorProperties_count; ++i)
+	{
+		if (mtoon && material.vectorProperties_keys[i] && isDefaultVector(material.vectorProperties_keys[i], material.vectorProperties_values[i], material.vectorProperties_floats_size[i]))
+		{
+			memory.free(memory.user_data, material.vectorProperties_keys[i]);
+			memory.free(memory.user_data, material.vectorProperties_values[i]);
+			continue;
+		}
+
+		material.vectorProperties_keys[write] = material.vectorProperties_keys[i];
+		material.vectorProperties_values[write] = material.vectorProperties_values[i];
+		material.vectorProperties_floats_size[write] = material.vectorProperties_floats_size[i];
+		write++;
+	}
+	material.vectorProperties_count = write;
+
+	// shader keywords are disabled unless listed
+	write = 0;
+	for (cgltf_size i = 0; i < material.keywordMap_count; ++i)
+	{
+		if (!material.keywordMap_values[i])
+		{
+			memory.free(memory.user_data, material.keywordMap_keys[i]);
+			continue;
+		}
+
+		material.keywordMap_keys[write] = material.keywordMap_keys[i];
+		material.keywordMap_values[write] = material.keywordMap_values[i];
+		write++;
+	}
+	material.keywordMap_count = write;
+}
+
+static uint64_t hashUpdate(uint64_t h, const void* data, size_t size)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	for (size_t i = 0; i < size; ++i)
+		h = (h ^ bytes[i]) * 1099511628211ull;
+
+	return h;
+}
+
+static uint64_t hashString(uint64_t h, const char* string)
+{
+	return string ? hashUpdate(h, string, strlen(string) + 1) : hashUpdate(h, "", 1);
+}
+
+static uint64_t hashMaterial(const cgltf_data* data, const cgltf_material& material, const cgltf_vrm_material_v0_0* vrm)
+{
+	// FNV-1a over the fields that are most likely to differ; collisions are resolved by a full comparison
+	uint64_t h = 14695981039346656037ull;
+
+	const cgltf_texture_view& base = material.pbr_metallic_roughness.base_color_texture;
+	cgltf_int base_texture = base.texture ? cgltf_int(base.texture - data->textures) : -1;
+
+	h = hashUpdate(h, &base_texture, sizeof(base_texture));
+	h = hashUpdate(h, material.pbr_metallic_roughness.base_color_factor, sizeof(material.pbr_metallic_roughness.base_color_factor));
+	h = hashUpdate(h, &material.alpha_mode, sizeof(material.alpha_mode));
+
+	if (!vrm)
+		return h;
+
+	// properties are sorted by now, so the hash does not depend on the exporter's key order
+	h = hashString(h, vrm->shader);
+	h = hashUpdate(h, &vrm->renderQueue, sizeof(vrm->renderQueue));
+
+	for (cgltf_size i = 0; i < vrm->floatProperties_count; ++i)
+	{
+		h = hashString(h, vrm->floatProperties_keys[i]);
+		h = hashUpdate(h, &vrm->floatProperties_values[i], sizeof(cgltf_float));
+	}
+
+	for (cgltf_size i = 0; i < vrm->vectorProperties_count; ++i)
+	{
+		h = hashString(h, vrm->vectorProperties_keys[i]);
+		h = hashUpdate(h, vrm->vectorProperties_values[i], vrm->vectorProperties_floats_size[i] * sizeof(cgltf_float));
+	}
+
+	for (cgltf_size i = 0; i < vrm->textureProperties_count; ++i)
+	{
+		h = hashString(h, vrm->textureProperties_keys[i]);
+		h = hashUpdate(h, &vrm->textureProperties_values[i], sizeof(cgltf_int));
+	}
+
+	for (cgltf_size i = 0; i < vrm->keywordMap_count; ++i)
+		h = hashString(h, vrm->keywordMap_keys[i]);
+
+	for (cgltf_size i = 0; i < vrm->tagMap_count; ++i)
+	{
+		h = hashString(h, vrm->tagMap_keys[i]);
+		h = hashString(h, vrm->tagMap_values[i]);
+	}
+
+	return h;
+}
+
+static bool isSameExtras(const cgltf_data* data, const cgltf_extras& lhs, const cgltf_extras& rhs)
+{
+	size_t lhs_size = lhs.end_offset - lhs.start_offset;
+	size_t rhs_size = rhs.end_offset - rhs.start_offset;
+
+	return lhs_size == rhs_size && (lhs_size == 0 || memcmp(data->json + lhs.start_offset, data->json + rhs.start_offset, lhs_size) == 0);
+}
+
+static bool isSameTextureView(const cgltf_data* data, const cgltf_texture_view& lhs, const cgltf_texture_view& rhs)
+{
+	if (lhs.texture != rhs.texture)
+		return false;
+
+	if (!lhs.texture)
+		return true;
+
+	if (lhs.texcoord != rhs.texcoord || lhs.scale != rhs.scale || lhs.has_transform != rhs.has_transform)
+		return false;
+
+	if (lhs.has_transform)
+	{
+		const cgltf_texture_transform& lt = lhs.transform;
+		const cgltf_texture_transform& rt = rhs.transform;
+
+		if (memcmp(lt.offset, rt.offset, sizeof(lt.offset)) != 0 || lt.rotation != rt.rotation || memcmp(lt.scale, rt.scale, sizeof(lt.scale)) != 0 || lt.texcoord != rt.texcoord)
+			return false;
+	}
+
+	return lhs.extensions_count == 0 && rhs.extensions_count == 0 && isSameExtras(data, lhs.extras, rhs.extras);
+}
+
+static bool isSameMaterial(const cgltf_data* data, cgltf_material& lhs, cgltf_material& rhs)
+{
+	// materials using less common extensions are never merged to avoid comparing their contents
+	if (lhs.has_pbr_specular_glossiness || lhs.has_clearcoat || lhs.has_transmission || lhs.has_ior || lhs.has_specular || lhs.has_sheen || lhs.extensions_count)
+		return false;
+
+	if (rhs.has_pbr_specular_glossiness || rhs.has_clearcoat || rhs.has_transmission || rhs.has_ior || rhs.has_specular || rhs.has_sheen || rhs.extensions_count)
+		return false;
+
+	if (!isSameGltfMaterial(lhs, rhs) || !isSameExtras(data, lhs.extras, rhs.extras))
+		return false;
+
+	cgltf_texture_view* lhs_views[kTextureViewCount];
+	cgltf_texture_view* rhs_views[kTextureViewCount];
+
+	int count = getTextureViews(lhs, lhs_views);
+	getTextureViews(rhs, rhs_views);
+
+	for (int i = 0; i < count; ++i)
+		if (!isSameTextureView(data, *lhs_views[i], *rhs_views[i]))
+			return false;
+
+	return true;
+}
+
+void processMaterials(cgltf_data* data, const Settings& settings)
+{
+	std::vector<cgltf_vrm_material_v0_0*> vrm_materials(data->materials_count);
+
+	if (data->has_vrm_v0_0)
+	{
+		for (cgltf_size i = 0; i < data->vrm_v0_0.materialProperties_count; ++i)
+			canonicalizeMaterial(data, data->vrm_v0_0.materialProperties[i]);
+
+		data->vrm_v0_0_spans.materialProperties.dirty = true;
+
+		for (cgltf_size i = 0; i < data->materials_count; ++i)
+			vrm_materials[i] = findVrmMaterial(data, i);
+	}
+
+	std::unordered_map<const cgltf_vrm_material_v0_0*, int> vrm_uses;
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+		vrm_uses[vrm_materials[i]]++;
+
+	std::vector<std::vector<MaterialBinding> > bindings(data->materials_count);
+	if (data->has_vrm_v0_0)
+		for (cgltf_size i = 0; i < data->materials_count; ++i)
+			getBindings(data, data->materials[i].name, bindings[i]);
+
+	std::unordered_map<uint64_t, std::vector<cgltf_size> > material_hashes;
+	std::vector<cgltf_size> target(data->materials_count);
+	size_t merged = 0;
+
+	for (cgltf_size i = 0; i < data->materials_count; ++i)
+	{
+		target[i] = i;
+
+		// materials with VRM properties need to be matched to them unambiguously
+		if (data->has_vrm_v0_0 && (!vrm_materials[i] || vrm_uses[vrm_materials[i]] != 1))
+			continue;
+
+		std::vector<cgltf_size>& candidates = material_hashes[hashMaterial(data, data->materials[i], vrm_materials[i])];
+
+		for (size_t j = 0; j < candidates.size(); ++j)
+		{
+			cgltf_size other = candidates[j];
+
+			if (!isSameMaterial(data, data->materials[i], data->materials[other]) || !isSameBindings(bindings[i], bindings[other]))
+				continue;
+
+			if (vrm_materials[i] && !isSameVrmProperties(*vrm_materials[i], *vrm_materials[other], false))
+				continue;
+
+			target[i] = other;
+			merged++;
+			break;
+		}
+
+		if (target[i] == i)
+			candidates.push_back(i);
+	}
+
+	if (settings.verbose && merged)
+		fprintf(stderr, "materials: merged %d duplicate materials\n", int(merged));
+
+	if (!merged)
+		return;
+
+	if (data->has_vrm_v0_0)
+		renameBindings(data, target);
+
+	removeMaterials(data, target, vrm_materials);
+}
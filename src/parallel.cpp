@@ -0,0 +1,176 @@
+#include "vrmpack.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+struct ParallelJob
+{
+	const std::function<void(size_t)>* body;
+	size_t count;
+
+	std::atomic<size_t> next;
+
+	// guarded by the pool mutex
+	size_t helpers;
+	size_t active;
+	std::exception_ptr error; // the first exception thrown by body, rethrown by the caller
+};
+
+struct WorkerPool
+{
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable finished;
+
+	std::vector<ParallelJob*> jobs;
+	std::vector<std::thread> threads;
+
+	bool stop;
+
+	WorkerPool()
+	    : stop(false)
+	{
+	}
+
+	~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+
+		wake.notify_all();
+
+		for (size_t i = 0; i < threads.size(); ++i)
+			threads[i].join();
+	}
+};
+
+static WorkerPool& getPool()
+{
+	static WorkerPool pool;
+	return pool;
+}
+
+static void runJob(WorkerPool& pool, ParallelJob& job)
+{
+	try
+	{
+		for (size_t i = job.next++; i < job.count; i = job.next++)
+			(*job.body)(i);
+	}
+	catch (...)
+	{
+		// an exception must not end a worker thread; the remaining indices are skipped and the caller rethrows it
+		std::lock_guard<std::mutex> lock(pool.mutex);
+
+		if (!job.error)
+			job.error = std::current_exception();
+
+		job.next = job.count;
+	}
+}
+
+static ParallelJob* findJob(WorkerPool& pool)
+{
+	// the most recent job is usually nested inside an older one, so finishing it first unblocks its caller sooner
+	for (size_t i = pool.jobs.size(); i > 0; --i)
+	{
+		ParallelJob* job = pool.jobs[i - 1];
+
+		if (job->helpers && job->next < job->count)
+			return job;
+	}
+
+	return NULL;
+}
+
+static void workerThread(WorkerPool* pool)
+{
+	std::unique_lock<std::mutex> lock(pool->mutex);
+
+	for (;;)
+	{
+		ParallelJob* job = NULL;
+		pool->wake.wait(lock, [&]() { return pool->stop || (job = findJob(*pool)) != NULL; });
+
+		if (pool->stop)
+			return;
+
+		job->helpers--;
+		job->active++;
+
+		lock.unlock();
+		runJob(*pool, *job);
+		lock.lock();
+
+		if (--job->active == 0)
+			pool->finished.notify_all();
+	}
+}
+
+int getThreadCount(int requested)
+{
+	if (requested > 0)
+		return requested;
+
+	unsigned int hardware = std::thread::hardware_concurrency();
+	return hardware ? int(hardware) : 1;
+}
+
+void parallelFor(size_t count, int thread_count, const std::function<void(size_t)>& body)
+{
+	// jobs are handed out in index order; callers store results per index so output does not depend on scheduling
+	size_t worker_count = size_t(getThreadCount(thread_count));
+	if (worker_count > count)
+		worker_count = count;
+
+	if (worker_count <= 1)
+	{
+		for (size_t i = 0; i < count; ++i)
+			body(i);
+		return;
+	}
+
+	// workers are shared by all callers, including nested ones (e.g. texture jobs inside a batch file job); the calling
+	// thread always works on its own job, so nesting cannot deadlock even when every worker is busy
+	WorkerPool& pool = getPool();
+
+	ParallelJob job;
+	job.body = &body;
+	job.count = count;
+	job.next = 0;
+	job.helpers = worker_count - 1;
+	job.active = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+
+		while (pool.threads.size() < worker_count - 1)
+			pool.threads.emplace_back(workerThread, &pool);
+
+		pool.jobs.push_back(&job);
+	}
+
+	pool.wake.notify_all();
+
+	runJob(pool, job);
+
+	std::unique_lock<std::mutex> lock(pool.mutex);
+
+	for (size_t i = 0; i < pool.jobs.size(); ++i)
+		if (pool.jobs[i] == &job)
+		{
+			pool.jobs.erase(pool.jobs.begin() + i);
+			break;
+		}
+
+	pool.finished.wait(lock, [&]() { return job.active == 0; });
+	lock.unlock();
+
+	if (job.error)
+		std::rethrow_exception(job.error);
+}
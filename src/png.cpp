@@ -0,0 +1,1226 @@
+#include "vrmpack.hpp"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const uint8_t kPngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+
+struct BitReader
+{
+	const uint8_t* data;
+	size_t size;
+	size_t offset;
+
+	uint64_t bits;
+	int count;
+};
+
+static void refill(BitReader& reader)
+{
+	while (reader.count <= 56)
+	{
+		uint64_t byte = reader.offset < reader.size ? reader.data[reader.offset] : 0;
+		reader.offset++;
+
+		reader.bits |= byte << reader.count;
+		reader.count += 8;
+	}
+}
+
+static unsigned int getBits(BitReader& reader, int count)
+{
+	if (reader.count < count)
+		refill(reader);
+
+	unsigned int result = unsigned(reader.bits & ((1ull << count) - 1));
+	reader.bits >>= count;
+	reader.count -= count;
+
+	return result;
+}
+
+static bool isOverrun(const BitReader& reader)
+{
+	// refill pads with zeroes past the end; consuming any of them means the stream was truncated
+	return reader.offset > reader.size && (reader.offset - reader.size) * 8 > size_t(reader.count);
+}
+
+static const int kHuffmanFastBits = 10;
+
+struct Huffman
+{
+	// fast entries store symbol | (length << 12); 0 means the code is longer than kHuffmanFastBits
+	uint16_t fast[1 << kHuffmanFastBits];
+
+	uint16_t counts[16];
+	uint16_t symbols[288];
+};
+
+static bool buildHuffman(Huffman& huffman, const uint8_t* lengths, int count)
+{
+	memset(huffman.fast, 0, sizeof(huffman.fast));
+	memset(huffman.counts, 0, sizeof(huffman.counts));
+
+	for (int i = 0; i < count; ++i)
+		huffman.counts[lengths[i]]++;
+
+	huffman.counts[0] = 0;
+
+	int left = 1;
+	for (int i = 1; i < 16; ++i)
+	{
+		left = (left << 1) - huffman.counts[i];
+		if (left < 0)
+			return false; // over-subscribed
+	}
+
+	uint16_t offsets[16] = {};
+	for (int i = 1; i < 15; ++i)
+		offsets[i + 1] = uint16_t(offsets[i] + huffman.counts[i]);
+
+	for (int i = 0; i < count; ++i)
+		if (lengths[i])
+			huffman.symbols[offsets[lengths[i]]++] = uint16_t(i);
+
+	// canonical codes are assigned MSB-first but read LSB-first, so fast table indices are bit-reversed
+	int code = 0;
+	int index = 0;
+	for (int len = 1; len <= kHuffmanFastBits; ++len)
+	{
+		for (int i = 0; i < huffman.counts[len]; ++i, ++code, ++index)
+		{
+			int reversed = 0;
+			for (int b = 0; b < len; ++b)
+				reversed |= ((code >> b) & 1) << (len - 1 - b);
+
+			for (int fill = reversed; fill < (1 << kHuffmanFastBits); fill += 1 << len)
+				huffman.fast[fill] = uint16_t(huffman.symbols[index] | (len << 12));
+		}
+
+		code <<= 1;
+	}
+
+	return true;
+}
+
+static int decodeSymbol(BitReader& reader, const Huffman& huffman)
+{
+	if (reader.count < 16)
+		refill(reader);
+
+	uint16_t entry = huffman.fast[reader.bits & ((1 << kHuffmanFastBits) - 1)];
+
+	if (entry)
+	{
+		int len = entry >> 12;
+		reader.bits >>= len;
+		reader.count -= len;
+		return entry & 0xfff;
+	}
+
+	// slow path for long codes, walks the canonical code one bit at a time
+	int code = 0, first = 0, index = 0;
+	for (int len = 1; len < 16; ++len)
+	{
+		code |= getBits(reader, 1);
+
+		int count = huffman.counts[len];
+		if (code - count < first)
+			return huffman.symbols[index + (code - first)];
+
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+
+	return -1;
+}
+
+static const uint16_t kLengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t kLengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t kDistanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t kDistanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+static bool inflateBlock(BitReader& reader, std::vector<uint8_t>& result, const Huffman& lengths, const Huffman& distances)
+{
+	for (;;)
+	{
+		int symbol = decodeSymbol(reader, lengths);
+
+		if (symbol < 0 || isOverrun(reader))
+			return false;
+
+		if (symbol < 256)
+		{
+			result.push_back(uint8_t(symbol));
+			continue;
+		}
+
+		if (symbol == 256)
+			return true;
+
+		symbol -= 257;
+		if (symbol >= 29)
+			return false;
+
+		size_t length = kLengthBase[symbol] + getBits(reader, kLengthExtra[symbol]);
+
+		int dsymbol = decodeSymbol(reader, distances);
+		if (dsymbol < 0 || dsymbol >= 30)
+			return false;
+
+		size_t distance = kDistanceBase[dsymbol] + getBits(reader, kDistanceExtra[dsymbol]);
+		if (distance > result.size())
+			return false;
+
+		size_t offset = result.size();
+		result.resize(offset + length);
+
+		// overlapping copies are intentional (distance < length repeats the last bytes)
+		uint8_t* dst = &result[offset];
+		for (size_t i = 0; i < length; ++i)
+			dst[i] = dst[i - distance];
+	}
+}
+
+static const uint8_t kCodeLengthOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+static bool inflateDynamic(BitReader& reader, Huffman& lengths, Huffman& distances)
+{
+	int hlit = getBits(reader, 5) + 257;
+	int hdist = getBits(reader, 5) + 1;
+	int hclen = getBits(reader, 4) + 4;
+
+	if (hlit > 286 || hdist > 30)
+		return false;
+
+	uint8_t code_lengths[19] = {};
+	for (int i = 0; i < hclen; ++i)
+		code_lengths[kCodeLengthOrder[i]] = uint8_t(getBits(reader, 3));
+
+	Huffman codes;
+	if (!buildHuffman(codes, code_lengths, 19))
+		return false;
+
+	uint8_t lens[286 + 30] = {};
+	int index = 0;
+
+	while (index < hlit + hdist)
+	{
+		int symbol = decodeSymbol(reader, codes);
+
+		if (symbol < 0 || isOverrun(reader))
+			return false;
+
+		if (symbol < 16)
+		{
+			lens[index++] = uint8_t(symbol);
+			continue;
+		}
+
+		int repeat = 0;
+		uint8_t value = 0;
+
+		if (symbol == 16)
+		{
+			if (index == 0)
+				return false;
+			value = lens[index - 1];
+			repeat = 3 + getBits(reader, 2);
+		}
+		else if (symbol == 17)
+			repeat = 3 + getBits(reader, 3);
+		else
+			repeat = 11 + getBits(reader, 7);
+
+		if (index + repeat > hlit + hdist)
+			return false;
+
+		while (repeat--)
+			lens[index++] = value;
+	}
+
+	return buildHuffman(lengths, lens, hlit) && buildHuffman(distances, lens + hlit, hdist);
+}
+
+static uint32_t adler32(const uint8_t* data, size_t size)
+{
+	uint32_t a = 1, b = 0;
+
+	// 5552 bytes is the most that can be summed before b overflows 32 bits
+	while (size)
+	{
+		size_t block = size < 5552 ? size : 5552;
+
+		for (size_t i = 0; i < block; ++i)
+		{
+			a += data[i];
+			b += a;
+		}
+
+		a %= 65521;
+		b %= 65521;
+		data += block;
+		size -= block;
+	}
+
+	return (b << 16) | a;
+}
+
+static bool inflateZlib(const uint8_t* data, size_t size, std::vector<uint8_t>& result)
+{
+	if (size < 2 || (data[0] & 0xf) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 0x20))
+		return false;
+
+	BitReader reader = {data + 2, size - 2, 0, 0, 0};
+
+	Huffman lengths, distances;
+
+	for (;;)
+	{
+		unsigned int final = getBits(reader, 1);
+		unsigned int type = getBits(reader, 2);
+
+		if (type == 0)
+		{
+			// stored blocks start at a byte boundary; drop the partial byte and rewind over prefetched bytes
+			getBits(reader, reader.count & 7);
+			reader.offset -= reader.count / 8;
+			reader.bits = 0;
+			reader.count = 0;
+
+			if (reader.offset + 4 > reader.size)
+				return false;
+
+			const uint8_t* header = reader.data + reader.offset;
+			unsigned int len = header[0] | (header[1] << 8);
+			unsigned int nlen = header[2] | (header[3] << 8);
+
+			if ((len ^ 0xffff) != nlen || reader.offset + 4 + len > reader.size)
+				return false;
+
+			result.insert(result.end(), header + 4, header + 4 + len);
+			reader.offset += 4 + len;
+		}
+		else if (type == 1)
+		{
+			uint8_t lens[288 + 30];
+			memset(lens, 8, 144);
+			memset(lens + 144, 9, 112);
+			memset(lens + 256, 7, 24);
+			memset(lens + 280, 8, 8);
+			memset(lens + 288, 5, 30);
+
+			buildHuffman(lengths, lens, 288);
+			buildHuffman(distances, lens + 288, 30);
+
+			if (!inflateBlock(reader, result, lengths, distances))
+				return false;
+		}
+		else if (type == 2)
+		{
+			if (!inflateDynamic(reader, lengths, distances) || !inflateBlock(reader, result, lengths, distances))
+				return false;
+		}
+		else
+		{
+			return false;
+		}
+
+		if (final)
+			break;
+	}
+
+	// the Adler-32 trailer follows the last block at a byte boundary
+	getBits(reader, reader.count & 7);
+	reader.offset -= reader.count / 8;
+
+	if (reader.offset + 4 > reader.size)
+		return false;
+
+	const uint8_t* trailer = reader.data + reader.offset;
+	uint32_t checksum = (uint32_t(trailer[0]) << 24) | (uint32_t(trailer[1]) << 16) | (uint32_t(trailer[2]) << 8) | uint32_t(trailer[3]);
+
+	return checksum == adler32(result.empty() ? NULL : &result[0], result.size());
+}
+
+static uint32_t readBE32(const uint8_t* data)
+{
+	return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+}
+
+static void writeBE32(std::vector<uint8_t>& result, uint32_t value)
+{
+	result.push_back(uint8_t(value >> 24));
+	result.push_back(uint8_t(value >> 16));
+	result.push_back(uint8_t(value >> 8));
+	result.push_back(uint8_t(value));
+}
+
+static uint8_t paeth(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+	return uint8_t((pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c);
+}
+
+static bool unfilter(uint8_t* scanlines, size_t stride, size_t rows, size_t bpp)
+{
+	const uint8_t* prior = NULL;
+
+	for (size_t y = 0; y < rows; ++y)
+	{
+		uint8_t filter = scanlines[0];
+		uint8_t* row = scanlines + 1;
+
+		for (size_t x = 0; x < stride; ++x)
+		{
+			int a = x >= bpp ? row[x - bpp] : 0;
+			int b = prior ? prior[x] : 0;
+			int c = (prior && x >= bpp) ? prior[x - bpp] : 0;
+
+			switch (filter)
+			{
+			case 0:
+				break;
+			case 1:
+				row[x] = uint8_t(row[x] + a);
+				break;
+			case 2:
+				row[x] = uint8_t(row[x] + b);
+				break;
+			case 3:
+				row[x] = uint8_t(row[x] + ((a + b) >> 1));
+				break;
+			case 4:
+				row[x] = uint8_t(row[x] + paeth(a, b, c));
+				break;
+			default:
+				return false;
+			}
+		}
+
+		prior = row;
+		scanlines += stride + 1;
+	}
+
+	return true;
+}
+
+struct PngHeader
+{
+	uint32_t width;
+	uint32_t height;
+	int depth;
+	int color_type;
+	int interlace;
+
+	int channels;
+
+	uint8_t palette[256][4];
+	int palette_size;
+
+	bool has_key;
+	uint16_t key[3];
+};
+
+static int getSample(const uint8_t* row, size_t x, int depth)
+{
+	switch (depth)
+	{
+	case 1:
+		return (row[x >> 3] >> (7 - (x & 7))) & 1;
+	case 2:
+		return (row[x >> 2] >> (6 - (x & 3) * 2)) & 3;
+	case 4:
+		return (row[x >> 1] >> (4 - (x & 1) * 4)) & 15;
+	case 8:
+		return row[x];
+	default:
+		return (row[x * 2] << 8) | row[x * 2 + 1];
+	}
+}
+
+static void expandRow(const PngHeader& header, const uint8_t* row, size_t width, uint8_t* result, size_t result_step)
+{
+	int maxval = (1 << header.depth) - 1;
+
+	for (size_t x = 0; x < width; ++x)
+	{
+		uint8_t* pixel = result + x * result_step;
+
+		if (header.color_type == 3)
+		{
+			int index = getSample(row, x, header.depth);
+			memcpy(pixel, header.palette[index], 4);
+			continue;
+		}
+
+		int samples[4] = {0, 0, 0, maxval};
+		for (int c = 0; c < header.channels; ++c)
+			samples[c] = getSample(row, x * header.channels + c, header.depth);
+
+		bool keyed = false;
+
+		if (header.color_type == 0 || header.color_type == 4)
+		{
+			keyed = header.has_key && header.color_type == 0 && samples[0] == header.key[0];
+			samples[3] = header.color_type == 4 ? samples[1] : maxval;
+			samples[1] = samples[2] = samples[0];
+		}
+		else if (header.color_type == 2)
+		{
+			keyed = header.has_key && samples[0] == header.key[0] && samples[1] == header.key[1] && samples[2] == header.key[2];
+		}
+
+		for (int c = 0; c < 4; ++c)
+			pixel[c] = uint8_t(samples[c] * 255 / maxval);
+
+		if (keyed)
+			pixel[3] = 0;
+	}
+}
+
+// interlace passes: x0, y0, dx, dy
+static const int kAdam7[7][4] = {{0, 0, 8, 8}, {4, 0, 8, 8}, {0, 4, 4, 8}, {2, 0, 4, 4}, {0, 2, 2, 4}, {1, 0, 2, 2}, {0, 1, 1, 2}};
+
+// deflate expands data by at most ~1032:1, so a stream cannot produce more than this per compressed byte
+static const size_t kMaxDeflateRatio = 1032;
+
+static size_t getRawSize(const PngHeader& header)
+{
+	size_t bits_per_pixel = size_t(header.channels) * header.depth;
+	size_t result = 0;
+	int passes = header.interlace ? 7 : 1;
+
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		size_t x0 = header.interlace ? kAdam7[pass][0] : 0, y0 = header.interlace ? kAdam7[pass][1] : 0;
+		size_t dx = header.interlace ? kAdam7[pass][2] : 1, dy = header.interlace ? kAdam7[pass][3] : 1;
+
+		size_t width = header.width > x0 ? (header.width - x0 + dx - 1) / dx : 0;
+		size_t height = header.height > y0 ? (header.height - y0 + dy - 1) / dy : 0;
+
+		if (width && height)
+			result += ((width * bits_per_pixel + 7) / 8 + 1) * height;
+	}
+
+	return result;
+}
+
+static bool decodePixels(const PngHeader& header, std::vector<uint8_t>& raw, VRM::Image& image)
+{
+	size_t bits_per_pixel = size_t(header.channels) * header.depth;
+	size_t bpp = (bits_per_pixel + 7) / 8;
+
+	image.width = int(header.width);
+	image.height = int(header.height);
+	image.pixels.resize(size_t(header.width) * header.height * 4);
+
+	size_t offset = 0;
+	int passes = header.interlace ? 7 : 1;
+
+	for (int pass = 0; pass < passes; ++pass)
+	{
+		size_t x0 = header.interlace ? kAdam7[pass][0] : 0, y0 = header.interlace ? kAdam7[pass][1] : 0;
+		size_t dx = header.interlace ? kAdam7[pass][2] : 1, dy = header.interlace ? kAdam7[pass][3] : 1;
+
+		size_t width = header.width > x0 ? (header.width - x0 + dx - 1) / dx : 0;
+		size_t height = header.height > y0 ? (header.height - y0 + dy - 1) / dy : 0;
+
+		if (width == 0 || height == 0)
+			continue;
+
+		size_t stride = (width * bits_per_pixel + 7) / 8;
+
+		if (offset + (stride + 1) * height > raw.size())
+			return false;
+
+		if (!unfilter(&raw[offset], stride, height, bpp))
+			return false;
+
+		for (size_t y = 0; y < height; ++y)
+		{
+			const uint8_t* row = &raw[offset + y * (stride + 1) + 1];
+			uint8_t* result = &image.pixels[((y0 + y * dy) * header.width + x0) * 4];
+
+			expandRow(header, row, width, result, dx * 4);
+		}
+
+		offset += (stride + 1) * height;
+	}
+
+	return true;
+}
+
+bool decodePng(const uint8_t* data, size_t size, VRM::Image& image)
+{
+	if (size < 8 || memcmp(data, kPngSignature, 8) != 0)
+		return false;
+
+	PngHeader header = {};
+	std::vector<uint8_t> compressed;
+
+	for (size_t offset = 8; offset + 12 <= size;)
+	{
+		uint32_t length = readBE32(data + offset);
+		const uint8_t* type = data + offset + 4;
+		const uint8_t* chunk = data + offset + 8;
+
+		if (length > size - offset - 12)
+			return false;
+
+		if (memcmp(type, "IHDR", 4) == 0 && length >= 13)
+		{
+			header.width = readBE32(chunk);
+			header.height = readBE32(chunk + 4);
+			header.depth = chunk[8];
+			header.color_type = chunk[9];
+			header.interlace = chunk[12];
+
+			if (chunk[10] != 0 || chunk[11] != 0 || header.interlace > 1)
+				return false;
+		}
+		else if (memcmp(type, "PLTE", 4) == 0)
+		{
+			header.palette_size = int(length / 3 > 256 ? 256 : length / 3);
+
+			for (int i = 0; i < header.palette_size; ++i)
+			{
+				header.palette[i][0] = chunk[i * 3 + 0];
+				header.palette[i][1] = chunk[i * 3 + 1];
+				header.palette[i][2] = chunk[i * 3 + 2];
+				header.palette[i][3] = 255;
+			}
+		}
+		else if (memcmp(type, "tRNS", 4) == 0)
+		{
+			if (header.color_type == 3)
+			{
+				for (uint32_t i = 0; i < length && i < 256; ++i)
+					header.palette[i][3] = chunk[i];
+			}
+			else if (header.color_type == 0 && length >= 2)
+			{
+				header.has_key = true;
+				header.key[0] = uint16_t((chunk[0] << 8) | chunk[1]);
+			}
+			else if (header.color_type == 2 && length >= 6)
+			{
+				header.has_key = true;
+				for (int c = 0; c < 3; ++c)
+					header.key[c] = uint16_t((chunk[c * 2] << 8) | chunk[c * 2 + 1]);
+			}
+		}
+		else if (memcmp(type, "IDAT", 4) == 0)
+		{
+			compressed.insert(compressed.end(), chunk, chunk + length);
+		}
+		else if (memcmp(type, "IEND", 4) == 0)
+		{
+			break;
+		}
+
+		offset += 12 + length;
+	}
+
+	switch (header.color_type)
+	{
+	case 0:
+		header.channels = 1;
+		break;
+	case 2:
+		header.channels = 3;
+		break;
+	case 3:
+		header.channels = 1;
+		break;
+	case 4:
+		header.channels = 2;
+		break;
+	case 6:
+		header.channels = 4;
+		break;
+	default:
+		return false;
+	}
+
+	bool depth_valid = header.depth == 8 || (header.depth == 16 && header.color_type != 3) || (header.depth < 8 && (header.color_type == 0 || header.color_type == 3) && (header.depth == 1 || header.depth == 2 || header.depth == 4));
+
+	if (header.width == 0 || header.height == 0 || header.width > (1 << 16) || header.height > (1 << 16) || !depth_valid)
+		return false;
+
+	if (header.color_type == 3 && header.palette_size == 0)
+		return false;
+
+	// the header alone must not drive allocations; reject images the compressed data cannot possibly fill
+	size_t raw_size = getRawSize(header);
+	if (raw_size > compressed.size() * kMaxDeflateRatio)
+		return false;
+
+	std::vector<uint8_t> raw;
+	raw.reserve(raw_size);
+
+	if (!inflateZlib(compressed.empty() ? NULL : &compressed[0], compressed.size(), raw) || raw.size() != raw_size)
+		return false;
+
+	return decodePixels(header, raw, image);
+}
+
+struct CrcTable
+{
+	uint32_t entries[256];
+
+	CrcTable()
+	{
+		for (uint32_t i = 0; i < 256; ++i)
+		{
+			uint32_t c = i;
+			for (int k = 0; k < 8; ++k)
+				c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+			entries[i] = c;
+		}
+	}
+};
+
+static uint32_t crc32(const uint8_t* data, size_t size)
+{
+	static const CrcTable table;
+
+	uint32_t crc = ~0u;
+	for (size_t i = 0; i < size; ++i)
+		crc = table.entries[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+
+	return ~crc;
+}
+
+static void writeChunk(std::vector<uint8_t>& result, const char* type, const uint8_t* data, size_t size)
+{
+	writeBE32(result, uint32_t(size));
+
+	size_t offset = result.size();
+	result.insert(result.end(), type, type + 4);
+	if (size)
+		result.insert(result.end(), data, data + size);
+
+	writeBE32(result, crc32(&result[offset], size + 4));
+}
+
+struct BitWriter
+{
+	std::vector<uint8_t>& result;
+
+	uint64_t bits;
+	int count;
+
+	void put(unsigned int value, int length)
+	{
+		bits |= uint64_t(value) << count;
+		count += length;
+
+		while (count >= 8)
+		{
+			result.push_back(uint8_t(bits));
+			bits >>= 8;
+			count -= 8;
+		}
+	}
+
+	void flush()
+	{
+		if (count > 0)
+			put(0, 8 - count);
+	}
+};
+
+struct DeflateToken
+{
+	uint16_t value; // literal byte, or match length when distance != 0
+	uint16_t distance;
+};
+
+static const int kDeflateWindow = 32768;
+static const int kDeflateHashBits = 15;
+static const int kDeflateMaxChain = 64;
+static const int kDeflateNiceLength = 128;
+static const size_t kDeflateBlockTokens = 1 << 16;
+
+static void buildCodeLengths(const uint32_t* frequencies, int count, int max_length, uint8_t* lengths)
+{
+	memset(lengths, 0, count);
+
+	std::vector<int> symbols;
+	for (int i = 0; i < count; ++i)
+		if (frequencies[i])
+			symbols.push_back(i);
+
+	// a single used symbol still gets a complete two-entry code, paired with an unused one; some inflaters reject incomplete codes
+	if (symbols.size() < 2)
+	{
+		int used = symbols.empty() ? 0 : symbols[0];
+
+		lengths[used] = 1;
+		lengths[used == 0 ? 1 : 0] = 1;
+		return;
+	}
+
+	for (size_t i = 1; i < symbols.size(); ++i)
+		for (size_t j = i; j > 0 && frequencies[symbols[j]] < frequencies[symbols[j - 1]]; --j)
+			std::swap(symbols[j], symbols[j - 1]);
+
+	// two-queue Huffman construction over leaves sorted by frequency; internal nodes are created in weight order
+	size_t leaf_count = symbols.size();
+	std::vector<uint32_t> weights(leaf_count * 2 - 1);
+	std::vector<size_t> parents(leaf_count * 2 - 1);
+
+	for (size_t i = 0; i < leaf_count; ++i)
+		weights[i] = frequencies[symbols[i]];
+
+	size_t leaf = 0, node = leaf_count;
+
+	for (size_t next = leaf_count; next < leaf_count * 2 - 1; ++next)
+	{
+		size_t children[2];
+
+		for (int k = 0; k < 2; ++k)
+			children[k] = (leaf < leaf_count && (node >= next || weights[leaf] <= weights[node])) ? leaf++ : node++;
+
+		weights[next] = weights[children[0]] + weights[children[1]];
+		parents[children[0]] = parents[children[1]] = next;
+	}
+
+	std::vector<int> depths(leaf_count * 2 - 1);
+	for (size_t i = leaf_count * 2 - 1; i-- > 0;)
+		depths[i] = i == leaf_count * 2 - 2 ? 0 : depths[parents[i]] + 1;
+
+	int length_counts[33] = {};
+	for (size_t i = 0; i < leaf_count; ++i)
+		length_counts[depths[i] < max_length ? depths[i] : max_length]++;
+
+	// codes deeper than max_length were clamped; rebalance until the Kraft sum is exact again
+	uint32_t total = 0;
+	for (int i = 1; i <= max_length; ++i)
+		total += uint32_t(length_counts[i]) << (max_length - i);
+
+	while (total != (1u << max_length))
+	{
+		length_counts[max_length]--;
+
+		for (int i = max_length - 1; i > 0; --i)
+			if (length_counts[i])
+			{
+				length_counts[i]--;
+				length_counts[i + 1] += 2;
+				break;
+			}
+
+		total--;
+	}
+
+	// most frequent symbols get the shortest codes
+	size_t index = leaf_count;
+	for (int len = 1; len <= max_length; ++len)
+		for (int i = 0; i < length_counts[len]; ++i)
+			lengths[symbols[--index]] = uint8_t(len);
+}
+
+static void buildCanonicalCodes(const uint8_t* lengths, int count, uint16_t* codes)
+{
+	int length_counts[16] = {};
+	for (int i = 0; i < count; ++i)
+		length_counts[lengths[i]]++;
+
+	length_counts[0] = 0;
+
+	int next[16] = {};
+	int code = 0;
+	for (int len = 1; len < 16; ++len)
+	{
+		code = (code + length_counts[len - 1]) << 1;
+		next[len] = code;
+	}
+
+	// deflate sends Huffman codes starting from the most significant bit, while the bit writer is LSB-first
+	for (int i = 0; i < count; ++i)
+	{
+		int len = lengths[i];
+		if (!len)
+			continue;
+
+		int value = next[len]++, reversed = 0;
+		for (int b = 0; b < len; ++b)
+			reversed |= ((value >> b) & 1) << (len - 1 - b);
+
+		codes[i] = uint16_t(reversed);
+	}
+}
+
+static int getLengthSymbol(int length)
+{
+	int symbol = 0;
+	while (symbol < 28 && kLengthBase[symbol + 1] <= length)
+		symbol++;
+
+	return symbol;
+}
+
+static int getDistanceSymbol(int distance)
+{
+	int symbol = 0;
+	while (symbol < 29 && kDistanceBase[symbol + 1] <= distance)
+		symbol++;
+
+	return symbol;
+}
+
+static void writeDeflateBlock(BitWriter& writer, const std::vector<DeflateToken>& tokens, bool final)
+{
+	uint32_t frequencies[286 + 30] = {};
+
+	for (size_t i = 0; i < tokens.size(); ++i)
+	{
+		const DeflateToken& token = tokens[i];
+
+		if (token.distance)
+		{
+			frequencies[257 + getLengthSymbol(token.value)]++;
+			frequencies[286 + getDistanceSymbol(token.distance)]++;
+		}
+		else
+			frequencies[token.value]++;
+	}
+
+	frequencies[256] = 1;
+
+	uint8_t lengths[286 + 30];
+	uint16_t codes[286 + 30] = {};
+	buildCodeLengths(frequencies, 286, 15, lengths);
+	buildCodeLengths(frequencies + 286, 30, 15, lengths + 286);
+	buildCanonicalCodes(lengths, 286, codes);
+	buildCanonicalCodes(lengths + 286, 30, codes + 286);
+
+	int hlit = 286, hdist = 30;
+	while (hlit > 257 && lengths[hlit - 1] == 0)
+		hlit--;
+	while (hdist > 1 && lengths[286 + hdist - 1] == 0)
+		hdist--;
+
+	uint8_t sequence[286 + 30];
+	memcpy(sequence, lengths, hlit);
+	memcpy(sequence + hlit, lengths + 286, hdist);
+
+	// run-length encode the code lengths with symbols 16 (repeat previous), 17 and 18 (runs of zeroes)
+	DeflateToken items[286 + 30];
+	size_t item_count = 0;
+	uint32_t item_frequencies[19] = {};
+
+	for (int i = 0; i < hlit + hdist;)
+	{
+		int value = sequence[i];
+		int run = 1;
+		while (i + run < hlit + hdist && sequence[i + run] == value)
+			run++;
+
+		i += run;
+
+		if (value == 0)
+		{
+			while (run >= 11)
+			{
+				int chunk = run < 138 ? run : 138;
+				items[item_count++] = {18, uint16_t(chunk - 11)};
+				run -= chunk;
+			}
+
+			if (run >= 3)
+			{
+				items[item_count++] = {17, uint16_t(run - 3)};
+				run = 0;
+			}
+		}
+		else
+		{
+			items[item_count++] = {uint16_t(value), 0};
+			run--;
+
+			while (run >= 3)
+			{
+				int chunk = run < 6 ? run : 6;
+				items[item_count++] = {16, uint16_t(chunk - 3)};
+				run -= chunk;
+			}
+		}
+
+		while (run-- > 0)
+			items[item_count++] = {uint16_t(value), 0};
+	}
+
+	for (size_t i = 0; i < item_count; ++i)
+		item_frequencies[items[i].value]++;
+
+	uint8_t item_lengths[19];
+	uint16_t item_codes[19] = {};
+	buildCodeLengths(item_frequencies, 19, 7, item_lengths);
+	buildCanonicalCodes(item_lengths, 19, item_codes);
+
+	int hclen = 19;
+	while (hclen > 4 && item_lengths[kCodeLengthOrder[hclen - 1]] == 0)
+		hclen--;
+
+	writer.put(final ? 1 : 0, 1);
+	writer.put(2, 2);
+	writer.put(hlit - 257, 5);
+	writer.put(hdist - 1, 5);
+	writer.put(hclen - 4, 4);
+
+	for (int i = 0; i < hclen; ++i)
+		writer.put(item_lengths[kCodeLengthOrder[i]], 3);
+
+	for (size_t i = 0; i < item_count; ++i)
+	{
+		int symbol = items[i].value;
+		writer.put(item_codes[symbol], item_lengths[symbol]);
+
+		if (symbol >= 16)
+			writer.put(items[i].distance, symbol == 16 ? 2 : symbol == 17 ? 3 : 7);
+	}
+
+	for (size_t i = 0; i < tokens.size(); ++i)
+	{
+		const DeflateToken& token = tokens[i];
+
+		if (token.distance)
+		{
+			int ls = getLengthSymbol(token.value);
+			int ds = getDistanceSymbol(token.distance);
+
+			writer.put(codes[257 + ls], lengths[257 + ls]);
+			writer.put(token.value - kLengthBase[ls], kLengthExtra[ls]);
+			writer.put(codes[286 + ds], lengths[286 + ds]);
+			writer.put(token.distance - kDistanceBase[ds], kDistanceExtra[ds]);
+		}
+		else
+			writer.put(codes[token.value], lengths[token.value]);
+	}
+
+	writer.put(codes[256], lengths[256]);
+}
+
+static uint32_t hash3(const uint8_t* data)
+{
+	uint32_t v = (uint32_t(data[0]) << 16) | (uint32_t(data[1]) << 8) | data[2];
+	return (v * 2654435761u) >> (32 - kDeflateHashBits);
+}
+
+static void deflateZlib(const uint8_t* data, size_t size, std::vector<uint8_t>& result)
+{
+	// greedy LZ77 over hash chains, one dynamic Huffman block per kDeflateBlockTokens tokens
+	result.push_back(0x78);
+	result.push_back(0x9c);
+
+	BitWriter writer = {result, 0, 0};
+
+	std::vector<int> head(1 << kDeflateHashBits, -1);
+	std::vector<int> prev(kDeflateWindow, -1);
+
+	std::vector<DeflateToken> tokens;
+	tokens.reserve(kDeflateBlockTokens);
+
+	for (size_t i = 0; i < size;)
+	{
+		size_t best_length = 0, best_distance = 0;
+
+		if (i + 3 <= size)
+		{
+			size_t max_length = size - i < 258 ? size - i : 258;
+			int chain = kDeflateMaxChain;
+
+			for (int candidate = head[hash3(data + i)]; candidate >= 0 && size_t(candidate) < i && i - candidate <= size_t(kDeflateWindow) && chain-- > 0; candidate = prev[candidate & (kDeflateWindow - 1)])
+			{
+				const uint8_t* match = data + candidate;
+
+				if (match[best_length] != data[i + best_length])
+					continue;
+
+				size_t length = 0;
+				while (length < max_length && match[length] == data[i + length])
+					length++;
+
+				if (length > best_length)
+				{
+					best_length = length;
+					best_distance = i - candidate;
+
+					if (length >= size_t(kDeflateNiceLength) || length == max_length)
+						break;
+				}
+			}
+		}
+
+		size_t advance = best_length >= 3 ? best_length : 1;
+
+		if (best_length >= 3)
+			tokens.push_back({uint16_t(best_length), uint16_t(best_distance)});
+		else
+			tokens.push_back({data[i], 0});
+
+		for (size_t k = 0; k < advance && i + k + 3 <= size; ++k)
+		{
+			uint32_t h = hash3(data + i + k);
+			prev[(i + k) & (kDeflateWindow - 1)] = head[h];
+			head[h] = int(i + k);
+		}
+
+		i += advance;
+
+		if (tokens.size() >= kDeflateBlockTokens)
+		{
+			writeDeflateBlock(writer, tokens, false);
+			tokens.clear();
+		}
+	}
+
+	writeDeflateBlock(writer, tokens, true);
+	writer.flush();
+
+	writeBE32(result, adler32(data, size));
+}
+
+static void filterRow(const uint8_t* row, const uint8_t* prior, size_t stride, size_t bpp, uint8_t* candidates, uint8_t* result)
+{
+	// pick the filter with the smallest sum of absolute residuals, same heuristic as libpng
+	const uint8_t* best = NULL;
+	size_t best_cost = ~size_t(0);
+
+	for (int filter = 0; filter < 5; ++filter)
+	{
+		uint8_t* out = candidates + (stride + 1) * filter;
+		out[0] = uint8_t(filter);
+
+		size_t cost = 0;
+
+		for (size_t x = 0; x < stride; ++x)
+		{
+			int a = x >= bpp ? row[x - bpp] : 0;
+			int b = prior ? prior[x] : 0;
+			int c = (prior && x >= bpp) ? prior[x - bpp] : 0;
+
+			uint8_t value = row[x];
+
+			switch (filter)
+			{
+			case 1:
+				value = uint8_t(value - a);
+				break;
+			case 2:
+				value = uint8_t(value - b);
+				break;
+			case 3:
+				value = uint8_t(value - ((a + b) >> 1));
+				break;
+			case 4:
+				value = uint8_t(value - paeth(a, b, c));
+				break;
+			}
+
+			out[x + 1] = value;
+			cost += value < 128 ? value : 256 - value;
+		}
+
+		if (cost < best_cost)
+		{
+			best_cost = cost;
+			best = out;
+		}
+	}
+
+	memcpy(result, best, stride + 1);
+}
+
+bool encodePng(const VRM::Image& image, std::vector<uint8_t>& result)
+{
+	size_t pixel_count = size_t(image.width) * image.height;
+
+	bool has_alpha = false;
+	bool is_gray = true;
+
+	for (size_t i = 0; i < pixel_count; ++i)
+	{
+		const uint8_t* pixel = &image.pixels[i * 4];
+
+		has_alpha |= pixel[3] != 255;
+		is_gray &= pixel[0] == pixel[1] && pixel[1] == pixel[2];
+	}
+
+	int channels = (is_gray ? 1 : 3) + (has_alpha ? 1 : 0);
+	int color_type = is_gray ? (has_alpha ? 4 : 0) : (has_alpha ? 6 : 2);
+
+	size_t stride = size_t(image.width) * channels;
+
+	std::vector<uint8_t> rows(stride * 2);
+	std::vector<uint8_t> candidates((stride + 1) * 5);
+	std::vector<uint8_t> filtered((stride + 1) * image.height);
+
+	for (int y = 0; y < image.height; ++y)
+	{
+		uint8_t* row = &rows[(y & 1) * stride];
+		const uint8_t* prior = y > 0 ? &rows[((y - 1) & 1) * stride] : NULL;
+
+		const uint8_t* pixels = &image.pixels[size_t(y) * image.width * 4];
+
+		for (int x = 0; x < image.width; ++x)
+		{
+			const uint8_t* pixel = pixels + x * 4;
+			uint8_t* out = row + x * channels;
+
+			if (is_gray)
+			{
+				out[0] = pixel[0];
+			}
+			else
+			{
+				out[0] = pixel[0];
+				out[1] = pixel[1];
+				out[2] = pixel[2];
+			}
+
+			if (has_alpha)
+				out[channels - 1] = pixel[3];
+		}
+
+		filterRow(row, prior, stride, channels, &candidates[0], &filtered[size_t(y) * (stride + 1)]);
+	}
+
+	// hash chains store positions as int
+	if (filtered.size() > size_t(INT_MAX / 2))
+		return false;
+
+	std::vector<uint8_t> compressed;
+	deflateZlib(&filtered[0], filtered.size(), compressed);
+
+	uint8_t ihdr[13];
+	ihdr[0] = uint8_t(image.width >> 24);
+	ihdr[1] = uint8_t(image.width >> 16);
+	ihdr[2] = uint8_t(image.width >> 8);
+	ihdr[3] = uint8_t(image.width);
+	ihdr[4] = uint8_t(image.height >> 24);
+	ihdr[5] = uint8_t(image.height >> 16);
+	ihdr[6] = uint8_t(image.height >> 8);
+	ihdr[7] = uint8_t(image.height);
+	ihdr[8] = 8;
+	ihdr[9] = uint8_t(color_type);
+	ihdr[10] = 0;
+	ihdr[11] = 0;
+	ihdr[12] = 0;
+
+	result.clear();
+	result.insert(result.end(), kPngSignature, kPngSignature + 8);
+
+	writeChunk(result, "IHDR", ihdr, sizeof(ihdr));
+	writeChunk(result, "IDAT", compressed.empty() ? NULL : &compressed[0], compressed.size());
+	writeChunk(result, "IEND", NULL, 0);
+
+	return true;
+}
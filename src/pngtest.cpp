@@ -0,0 +1,178 @@
+#include "vrmpack.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include <zlib.h>
+
+using namespace VRM;
+
+// round-trips synthetic images through encodePng and checks every zlib stream with zlib itself, so that encoder bugs
+// cannot hide behind a matching bug in decodePng
+
+enum Pattern
+{
+	Pattern_Solid,
+	Pattern_Period3,
+	Pattern_Gradient,
+	Pattern_Noise,
+
+	Pattern_Count
+};
+
+static const char* kPatternNames[Pattern_Count] = {"solid", "period-3", "gradient", "noise"};
+
+static uint32_t random(uint32_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+// gray images are written as gray or gray and alpha PNGs, color ones as RGB or RGBA
+static Image getImage(int width, int height, Pattern pattern, bool gray, bool alpha, uint32_t& state)
+{
+	Image image;
+	image.width = width;
+	image.height = height;
+	image.pixels.resize(size_t(width) * height * 4);
+
+	for (int y = 0; y < height; ++y)
+		for (int x = 0; x < width; ++x)
+		{
+			uint8_t* pixel = &image.pixels[(size_t(y) * width + x) * 4];
+
+			for (int c = 0; c < 4; ++c)
+			{
+				switch (pattern)
+				{
+				case Pattern_Solid:
+					pixel[c] = uint8_t(128 + c);
+					break;
+				case Pattern_Period3:
+					pixel[c] = uint8_t((x + y * width) % 3 * 60 + c);
+					break;
+				case Pattern_Gradient:
+					pixel[c] = uint8_t((x * 255 / width + y * 255 / height) / 2 + c * 17);
+					break;
+				default:
+					pixel[c] = uint8_t(random(state));
+					break;
+				}
+			}
+
+			if (gray)
+				pixel[1] = pixel[2] = pixel[0];
+
+			if (!alpha)
+				pixel[3] = 255;
+		}
+
+	return image;
+}
+
+// also returns where the data of the last IDAT chunk ends, which is where the Adler-32 trailer ends
+static bool readChunks(const std::vector<uint8_t>& png, std::vector<uint8_t>& compressed, size_t& compressed_end)
+{
+	size_t offset = 8;
+
+	while (offset + 12 <= png.size())
+	{
+		size_t length = (size_t(png[offset]) << 24) | (size_t(png[offset + 1]) << 16) | (size_t(png[offset + 2]) << 8) | size_t(png[offset + 3]);
+
+		if (offset + 12 + length > png.size())
+			return false;
+
+		if (memcmp(&png[offset + 4], "IDAT", 4) == 0)
+		{
+			compressed.insert(compressed.end(), png.begin() + offset + 8, png.begin() + offset + 8 + length);
+			compressed_end = offset + 8 + length;
+		}
+
+		offset += 12 + length;
+	}
+
+	return offset == png.size() && !compressed.empty();
+}
+
+// inflates the whole stream with zlib, which also verifies the Adler-32 trailer
+static bool inflateReference(const std::vector<uint8_t>& compressed)
+{
+	z_stream stream = {};
+	if (inflateInit(&stream) != Z_OK)
+		return false;
+
+	stream.next_in = const_cast<Bytef*>(&compressed[0]);
+	stream.avail_in = uInt(compressed.size());
+
+	std::vector<uint8_t> output(65536);
+	int result = Z_OK;
+
+	while (result == Z_OK)
+	{
+		stream.next_out = &output[0];
+		stream.avail_out = uInt(output.size());
+
+		result = inflate(&stream, Z_NO_FLUSH);
+	}
+
+	bool complete = result == Z_STREAM_END && stream.avail_in == 0;
+	inflateEnd(&stream);
+
+	return complete;
+}
+
+int main()
+{
+	int failed = 0, count = 0;
+	uint32_t state = 1;
+
+	for (int pattern = 0; pattern < Pattern_Count; ++pattern)
+		for (int format = 0; format < 4; ++format)
+			for (int height = 1; height <= 12; ++height)
+				for (int width = 1; width <= 12; ++width)
+				{
+					bool gray = (format & 1) != 0, alpha = (format & 2) != 0;
+					Image image = getImage(width, height, Pattern(pattern), gray, alpha, state);
+
+					std::vector<uint8_t> png, compressed;
+					size_t compressed_end = 0;
+					Image decoded;
+
+					const char* error = NULL;
+
+					if (!encodePng(image, png))
+						error = "encodePng failed";
+					else if (!readChunks(png, compressed, compressed_end))
+						error = "malformed chunks";
+					else if (!inflateReference(compressed))
+						error = "zlib rejected the stream";
+					else if (!decodePng(&png[0], png.size(), decoded))
+						error = "decodePng failed";
+					else if (decoded.width != width || decoded.height != height || decoded.pixels != image.pixels)
+						error = "pixels differ";
+					else
+					{
+						// chunk CRCs are not checked by decodePng, so this only breaks the zlib checksum
+						png[compressed_end - 1] ^= 1;
+
+						if (decodePng(&png[0], png.size(), decoded))
+							error = "decodePng accepted a wrong Adler-32 checksum";
+					}
+
+					if (error)
+					{
+						fprintf(stderr, "%dx%d %s%s %s: %s\n", width, height, gray ? "gray" : "color", alpha ? " alpha" : "", kPatternNames[pattern], error);
+						failed++;
+					}
+
+					count++;
+				}
+
+	printf("pngtest: %d images, %d failed\n", count, failed);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,641 @@
+#include "vrmpack.hpp"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// triangles per BVH leaf; small leaves keep closest point queries cheap for the dense meshes avatars have
+static const size_t kLeafSize = 4;
+
+struct Surface
+{
+	std::vector<float> positions;
+	std::vector<uint32_t> indices;
+};
+
+struct BvhNode
+{
+	float min[3];
+	float max[3];
+
+	// leaves reference a range of the triangle order; inner nodes store their first child, the second one follows it
+	uint32_t first;
+	uint32_t count;
+};
+
+struct Bvh
+{
+	std::vector<BvhNode> nodes;
+	std::vector<uint32_t> triangles;
+};
+
+struct Comparison
+{
+	size_t mesh;
+	size_t primitive;
+	int target; // -1 for the bind pose
+	std::string name;
+	std::string pose;
+
+	size_t triangles_before;
+	size_t triangles_after;
+
+	double diagonal;
+	double hausdorff; // negative when one of the surfaces is empty
+	double rms;
+
+	const char* error; // set when a surface can not be read, e.g. because its indices are out of range
+};
+
+static cgltf_data* load(const char* path)
+{
+	cgltf_options options = {};
+	cgltf_data* data = NULL;
+
+	if (cgltf_parse_file(&options, path, &data) != cgltf_result_success)
+	{
+		fprintf(stderr, "Failed to parse file %s\n", path);
+		return NULL;
+	}
+
+	if (cgltf_load_buffers(&options, data, path) != cgltf_result_success)
+	{
+		fprintf(stderr, "Failed to load buffers from %s\n", path);
+		cgltf_free(data);
+		return NULL;
+	}
+
+	if (cgltf_validate(data) != cgltf_result_success)
+	{
+		fprintf(stderr, "Invalid glTF data in %s\n", path);
+		cgltf_free(data);
+		return NULL;
+	}
+
+	return data;
+}
+
+static const cgltf_accessor* findPositions(const cgltf_attribute* attributes, cgltf_size count)
+{
+	for (cgltf_size i = 0; i < count; ++i)
+		if (attributes[i].type == cgltf_attribute_type_position)
+			return attributes[i].data;
+
+	return NULL;
+}
+
+// accessors without a buffer view read as zeros, but one whose buffer was not loaded can not be read at all
+static bool isReadable(const cgltf_accessor* accessor)
+{
+	if (accessor->buffer_view && !cgltf_buffer_view_data(accessor->buffer_view))
+		return false;
+
+	if (accessor->is_sparse && (!cgltf_buffer_view_data(accessor->sparse.indices_buffer_view) || !cgltf_buffer_view_data(accessor->sparse.values_buffer_view)))
+		return false;
+
+	return true;
+}
+
+// target < 0 is the bind pose, otherwise the morph target at full weight; error is set when the primitive has data that can not be used
+static bool getSurface(const cgltf_primitive& primitive, int target, Surface& result, const char*& error)
+{
+	const cgltf_accessor* positions = findPositions(primitive.attributes, primitive.attributes_count);
+	if (!positions || primitive.type != cgltf_primitive_type_triangles)
+		return false;
+
+	if (!isReadable(positions))
+	{
+		error = "position data is missing";
+		return false;
+	}
+
+	result.positions.resize(positions->count * 3);
+	cgltf_accessor_unpack_floats(positions, result.positions.data(), result.positions.size());
+
+	if (target >= 0)
+	{
+		const cgltf_morph_target& morph = primitive.targets[target];
+		const cgltf_accessor* deltas = findPositions(morph.attributes, morph.attributes_count);
+
+		if (deltas && !isReadable(deltas))
+		{
+			error = "morph target data is missing";
+			return false;
+		}
+
+		if (deltas && deltas->count == positions->count)
+		{
+			std::vector<float> offsets(deltas->count * 3);
+			cgltf_accessor_unpack_floats(deltas, offsets.data(), offsets.size());
+
+			for (size_t i = 0; i < offsets.size(); ++i)
+				result.positions[i] += offsets[i];
+		}
+	}
+
+	if (primitive.indices)
+	{
+		if (!isReadable(primitive.indices))
+		{
+			error = "index data is missing";
+			return false;
+		}
+
+		result.indices.resize(primitive.indices->count);
+
+		for (size_t i = 0; i < result.indices.size(); ++i)
+		{
+			cgltf_size index = cgltf_accessor_read_index(primitive.indices, i);
+
+			if (index >= positions->count)
+			{
+				error = "index is out of range";
+				return false;
+			}
+
+			result.indices[i] = uint32_t(index);
+		}
+	}
+	else
+	{
+		result.indices.resize(positions->count);
+
+		for (size_t i = 0; i < result.indices.size(); ++i)
+			result.indices[i] = uint32_t(i);
+	}
+
+	result.indices.resize(result.indices.size() / 3 * 3);
+	return true;
+}
+
+static double getDiagonal(const Surface& surface)
+{
+	float lo[3] = {FLT_MAX, FLT_MAX, FLT_MAX}, hi[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+	for (size_t i = 0; i < surface.indices.size(); ++i)
+		for (int k = 0; k < 3; ++k)
+		{
+			lo[k] = std::min(lo[k], surface.positions[surface.indices[i] * 3 + k]);
+			hi[k] = std::max(hi[k], surface.positions[surface.indices[i] * 3 + k]);
+		}
+
+	if (surface.indices.empty())
+		return 0;
+
+	return sqrt(double(hi[0] - lo[0]) * (hi[0] - lo[0]) + double(hi[1] - lo[1]) * (hi[1] - lo[1]) + double(hi[2] - lo[2]) * (hi[2] - lo[2]));
+}
+
+static void getBounds(const Surface& surface, const uint32_t* triangles, size_t count, BvhNode& node)
+{
+	for (int k = 0; k < 3; ++k)
+	{
+		node.min[k] = FLT_MAX;
+		node.max[k] = -FLT_MAX;
+	}
+
+	for (size_t i = 0; i < count; ++i)
+		for (int j = 0; j < 3; ++j)
+		{
+			const float* v = &surface.positions[surface.indices[triangles[i] * 3 + j] * 3];
+
+			for (int k = 0; k < 3; ++k)
+			{
+				node.min[k] = std::min(node.min[k], v[k]);
+				node.max[k] = std::max(node.max[k], v[k]);
+			}
+		}
+}
+
+static float getCentroid(const Surface& surface, uint32_t triangle, int axis)
+{
+	const uint32_t* tri = &surface.indices[triangle * 3];
+	return surface.positions[tri[0] * 3 + axis] + surface.positions[tri[1] * 3 + axis] + surface.positions[tri[2] * 3 + axis];
+}
+
+static void buildNode(Bvh& bvh, const Surface& surface, size_t index, size_t first, size_t count)
+{
+	BvhNode& node = bvh.nodes[index];
+	getBounds(surface, &bvh.triangles[first], count, node);
+
+	if (count <= kLeafSize)
+	{
+		node.first = uint32_t(first);
+		node.count = uint32_t(count);
+		return;
+	}
+
+	// median split along the longest axis keeps the tree balanced regardless of how triangles are distributed
+	int axis = 0;
+	for (int k = 1; k < 3; ++k)
+		if (node.max[k] - node.min[k] > node.max[axis] - node.min[axis])
+			axis = k;
+
+	size_t half = count / 2;
+	std::nth_element(bvh.triangles.begin() + first, bvh.triangles.begin() + first + half, bvh.triangles.begin() + first + count,
+	                 [&](uint32_t l, uint32_t r) { return getCentroid(surface, l, axis) < getCentroid(surface, r, axis); });
+
+	size_t child = bvh.nodes.size();
+	bvh.nodes[index].first = uint32_t(child);
+	bvh.nodes[index].count = 0;
+
+	bvh.nodes.resize(child + 2);
+
+	buildNode(bvh, surface, child, first, half);
+	buildNode(bvh, surface, child + 1, first + half, count - half);
+}
+
+static void buildBvh(Bvh& bvh, const Surface& surface)
+{
+	size_t triangle_count = surface.indices.size() / 3;
+
+	bvh.triangles.resize(triangle_count);
+	for (size_t i = 0; i < triangle_count; ++i)
+		bvh.triangles[i] = uint32_t(i);
+
+	bvh.nodes.clear();
+	bvh.nodes.reserve(triangle_count * 2 / kLeafSize + 1);
+	bvh.nodes.resize(1);
+
+	if (triangle_count)
+		buildNode(bvh, surface, 0, 0, triangle_count);
+}
+
+static float dot(const float* a, const float* b)
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// closest point on triangle abc to p; see Ericson, Real-Time Collision Detection, 5.1.5
+static float getTriangleDistance(const float* p, const float* a, const float* b, const float* c)
+{
+	float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+	float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+	float ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+
+	float d1 = dot(ab, ap), d2 = dot(ac, ap);
+	float q[3];
+
+	float bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+	float d3 = dot(ab, bp), d4 = dot(ac, bp);
+
+	float cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+	float d5 = dot(ab, cp), d6 = dot(ac, cp);
+
+	float vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+
+	if (d1 <= 0 && d2 <= 0)
+		memcpy(q, a, sizeof(q));
+	else if (d3 >= 0 && d4 <= d3)
+		memcpy(q, b, sizeof(q));
+	else if (d6 >= 0 && d5 <= d6)
+		memcpy(q, c, sizeof(q));
+	else if (vc <= 0 && d1 >= 0 && d3 <= 0)
+	{
+		float v = d1 / (d1 - d3);
+		for (int k = 0; k < 3; ++k)
+			q[k] = a[k] + v * ab[k];
+	}
+	else if (vb <= 0 && d2 >= 0 && d6 <= 0)
+	{
+		float w = d2 / (d2 - d6);
+		for (int k = 0; k < 3; ++k)
+			q[k] = a[k] + w * ac[k];
+	}
+	else if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+	{
+		float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+		for (int k = 0; k < 3; ++k)
+			q[k] = b[k] + w * (c[k] - b[k]);
+	}
+	else
+	{
+		float denom = 1 / (va + vb + vc);
+		float v = vb * denom, w = vc * denom;
+		for (int k = 0; k < 3; ++k)
+			q[k] = a[k] + ab[k] * v + ac[k] * w;
+	}
+
+	float d[3] = {p[0] - q[0], p[1] - q[1], p[2] - q[2]};
+	return dot(d, d);
+}
+
+static float getBoxDistance(const BvhNode& node, const float* p)
+{
+	float result = 0;
+
+	for (int k = 0; k < 3; ++k)
+	{
+		float d = std::max(std::max(node.min[k] - p[k], p[k] - node.max[k]), 0.f);
+		result += d * d;
+	}
+
+	return result;
+}
+
+// squared distance from p to the closest point of the surface
+static float getSurfaceDistance(const Bvh& bvh, const Surface& surface, const float* p)
+{
+	float best = FLT_MAX;
+
+	uint32_t stack[64];
+	size_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size)
+	{
+		const BvhNode& node = bvh.nodes[stack[--stack_size]];
+
+		if (getBoxDistance(node, p) >= best)
+			continue;
+
+		if (node.count)
+		{
+			for (uint32_t i = node.first; i < node.first + node.count; ++i)
+			{
+				const uint32_t* tri = &surface.indices[bvh.triangles[i] * 3];
+				best = std::min(best, getTriangleDistance(p, &surface.positions[tri[0] * 3], &surface.positions[tri[1] * 3], &surface.positions[tri[2] * 3]));
+			}
+		}
+		else
+		{
+			// visit the closer child first so that its result prunes the other one
+			uint32_t near = node.first, far = node.first + 1;
+			if (getBoxDistance(bvh.nodes[far], p) < getBoxDistance(bvh.nodes[near], p))
+				std::swap(near, far);
+
+			stack[stack_size++] = far;
+			stack[stack_size++] = near;
+		}
+	}
+
+	return best;
+}
+
+// samples every triangle of source at its corners, edge midpoints and centroid and measures the distance to target
+static void measure(const Surface& source, const Surface& target, const Bvh& bvh, double& max_distance, double& sum_squares, size_t& samples)
+{
+	static const float kWeights[7][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {0.5f, 0.5f, 0}, {0, 0.5f, 0.5f}, {0.5f, 0, 0.5f}, {1 / 3.f, 1 / 3.f, 1 / 3.f}};
+
+	for (size_t i = 0; i < source.indices.size(); i += 3)
+	{
+		const float* a = &source.positions[source.indices[i + 0] * 3];
+		const float* b = &source.positions[source.indices[i + 1] * 3];
+		const float* c = &source.positions[source.indices[i + 2] * 3];
+
+		for (int s = 0; s < 7; ++s)
+		{
+			const float* w = kWeights[s];
+			float p[3] = {a[0] * w[0] + b[0] * w[1] + c[0] * w[2], a[1] * w[0] + b[1] * w[1] + c[1] * w[2], a[2] * w[0] + b[2] * w[1] + c[2] * w[2]};
+
+			double distance = getSurfaceDistance(bvh, target, p);
+
+			max_distance = std::max(max_distance, distance);
+			sum_squares += distance;
+			samples++;
+		}
+	}
+}
+
+static void compare(const cgltf_primitive& original, const cgltf_primitive& processed, Comparison& result)
+{
+	int target = result.target;
+
+	Surface before, after;
+	result.hausdorff = -1;
+	result.rms = -1;
+
+	if (!getSurface(original, target, before, result.error) || !getSurface(processed, target, after, result.error))
+		return;
+
+	result.triangles_before = before.indices.size() / 3;
+	result.triangles_after = after.indices.size() / 3;
+	result.diagonal = getDiagonal(before);
+
+	if (before.indices.empty() || after.indices.empty())
+		return;
+
+	Bvh before_bvh, after_bvh;
+	buildBvh(before_bvh, before);
+	buildBvh(after_bvh, after);
+
+	// symmetric: a simplified surface can stay close to the original while leaving parts of it uncovered
+	double max_distance = 0, sum_squares = 0;
+	size_t samples = 0;
+
+	measure(before, after, after_bvh, max_distance, sum_squares, samples);
+	measure(after, before, before_bvh, max_distance, sum_squares, samples);
+
+	result.hausdorff = sqrt(max_distance);
+	result.rms = sqrt(sum_squares / double(samples));
+}
+
+static double getRelative(double value, double diagonal)
+{
+	return diagonal > 0 ? value / diagonal : value;
+}
+
+static bool writeJson(const char* path, const std::vector<Comparison>& results, bool passed)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		fprintf(stderr, "Failed to write %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "{\n\t\"version\": \"%s\",\n\t\"passed\": %s,\n\t\"comparisons\": [", getVersion().c_str(), passed ? "true" : "false");
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const Comparison& result = results[i];
+
+		fprintf(file, "%s\n\t\t{\"mesh\": %d, \"primitive\": %d, \"name\": ", i ? "," : "", int(result.mesh), int(result.primitive));
+		writeJsonString(file, result.name.c_str());
+		fprintf(file, ", \"pose\": ");
+		writeJsonString(file, result.pose.c_str());
+		fprintf(file, ", \"triangles_before\": %d, \"triangles_after\": %d, \"diagonal\": %g", int(result.triangles_before), int(result.triangles_after), result.diagonal);
+
+		if (result.error)
+		{
+			fprintf(file, ", \"hausdorff\": null, \"rms\": null, \"error\": ");
+			writeJsonString(file, result.error);
+			fprintf(file, "}");
+		}
+		else if (result.hausdorff < 0)
+			fprintf(file, ", \"hausdorff\": null, \"rms\": null}");
+		else
+			fprintf(file, ", \"hausdorff\": %g, \"rms\": %g, \"hausdorff_relative\": %g, \"rms_relative\": %g}", result.hausdorff, result.rms,
+			        getRelative(result.hausdorff, result.diagonal), getRelative(result.rms, result.diagonal));
+	}
+
+	fprintf(file, "%s]\n}\n", results.empty() ? "" : "\n\t");
+
+	if (fclose(file) != 0)
+	{
+		fprintf(stderr, "Failed to write %s\n", path);
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	const char* input = 0;
+	const char* output = 0;
+	const char* json_path = 0;
+	double hausdorff_limit = 0;
+	double rms_limit = 0;
+	int thread_count = 0;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+
+		if (strcmp(arg, "-i") == 0 && i + 1 < argc && !input)
+		{
+			input = argv[++i];
+		}
+		else if (strcmp(arg, "-o") == 0 && i + 1 < argc && !output)
+		{
+			output = argv[++i];
+		}
+		else if (strcmp(arg, "-hmax") == 0 && i + 1 < argc)
+		{
+			hausdorff_limit = atof(argv[++i]);
+		}
+		else if (strcmp(arg, "-rmax") == 0 && i + 1 < argc)
+		{
+			rms_limit = atof(argv[++i]);
+		}
+		else if (strcmp(arg, "-json") == 0 && i + 1 < argc)
+		{
+			json_path = argv[++i];
+		}
+		else if (strcmp(arg, "-j") == 0 && i + 1 < argc)
+		{
+			thread_count = atoi(argv[++i]);
+		}
+		else
+		{
+			input = output = 0;
+			break;
+		}
+	}
+
+	if (!input || !output)
+	{
+		fprintf(stderr, "vrmpack_quality %s\n", getVersion().c_str());
+		fprintf(stderr, "Usage: vrmpack_quality [options] -i original -o processed\n");
+		fprintf(stderr, "\t-hmax R: fail if the Hausdorff distance of any primitive exceeds R times its bounding box diagonal\n");
+		fprintf(stderr, "\t-rmax R: fail if the RMS distance of any primitive exceeds R times its bounding box diagonal\n");
+		fprintf(stderr, "\t-json file: write the distances of every primitive and pose as JSON\n");
+		fprintf(stderr, "\t-j N: thread count (default: 0, one per hardware thread)\n");
+		return 1;
+	}
+
+	cgltf_data* original = load(input);
+	cgltf_data* processed = original ? load(output) : NULL;
+
+	if (!original || !processed)
+	{
+		cgltf_free(original);
+		return 1;
+	}
+
+	bool matching = original->meshes_count == processed->meshes_count;
+
+	for (size_t i = 0; i < original->meshes_count && matching; ++i)
+		matching = original->meshes[i].primitives_count == processed->meshes[i].primitives_count;
+
+	if (!matching)
+	{
+		fprintf(stderr, "%s and %s do not have the same meshes and primitives\n", input, output);
+		cgltf_free(original);
+		cgltf_free(processed);
+		return 1;
+	}
+
+	// one job per primitive and pose; the bind pose comes first, then every morph target at full weight
+	std::vector<Comparison> results;
+
+	for (size_t i = 0; i < original->meshes_count; ++i)
+	{
+		const cgltf_mesh& mesh = original->meshes[i];
+
+		for (size_t j = 0; j < mesh.primitives_count; ++j)
+			for (int target = -1; target < int(mesh.primitives[j].targets_count); ++target)
+			{
+				Comparison result = {};
+				result.mesh = i;
+				result.primitive = j;
+				result.target = target;
+				result.name = mesh.name ? mesh.name : "";
+
+				if (target < 0)
+					result.pose = "bind";
+				else if (size_t(target) < mesh.target_names_count)
+					result.pose = mesh.target_names[target];
+				else
+					result.pose = "target " + std::to_string(target);
+
+				results.push_back(result);
+			}
+	}
+
+	parallelFor(results.size(), thread_count, [&](size_t i) {
+		Comparison& result = results[i];
+
+		compare(original->meshes[result.mesh].primitives[result.primitive], processed->meshes[result.mesh].primitives[result.primitive], result);
+	});
+
+	bool passed = true;
+
+	printf("%-24s %-16s %10s %10s %12s %12s\n", "primitive", "pose", "triangles", "after", "hausdorff", "rms");
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const Comparison& result = results[i];
+		std::string name = result.name + "/" + std::to_string(result.primitive);
+
+		if (result.error)
+		{
+			printf("%-24s %-16s %10s %10s %12s %12s  ERROR: %s\n", name.c_str(), result.pose.c_str(), "-", "-", "-", "-", result.error);
+
+			passed = false;
+			continue;
+		}
+
+		if (result.hausdorff < 0)
+		{
+			printf("%-24s %-16s %10d %10d %12s %12s\n", name.c_str(), result.pose.c_str(), int(result.triangles_before), int(result.triangles_after), "-", "-");
+
+			// an emptied primitive can not be measured, but it only passes if it was empty before as well
+			passed &= result.triangles_after == result.triangles_before;
+			continue;
+		}
+
+		double hausdorff = getRelative(result.hausdorff, result.diagonal), rms = getRelative(result.rms, result.diagonal);
+		bool failed = (hausdorff_limit > 0 && hausdorff > hausdorff_limit) || (rms_limit > 0 && rms > rms_limit);
+
+		printf("%-24s %-16s %10d %10d %12.6f %12.6f%s\n", name.c_str(), result.pose.c_str(), int(result.triangles_before), int(result.triangles_after), hausdorff, rms, failed ? "  FAILED" : "");
+
+		passed &= !failed;
+	}
+
+	printf("distances are relative to the bounding box diagonal of each original primitive\n");
+
+	if (json_path && !writeJson(json_path, results, passed))
+		passed = false;
+
+	cgltf_free(original);
+	cgltf_free(processed);
+
+	return passed ? 0 : 1;
+}
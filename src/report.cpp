@@ -0,0 +1,243 @@
+#include "vrmpack.hpp"
+
+#include "meshoptimizer/src/meshoptimizer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace VRM;
+
+static const char* const kStageNames[Stage_Count] = {
+    "read",
+    "parse",
+    "load_buffers",
+    "simplify",
+    "materials",
+    "atlas",
+    "images",
+    "textures",
+    "buffers",
+    "write_json",
+    "write_glb",
+};
+
+const char* getStageName(Stage stage)
+{
+	return kStageNames[stage];
+}
+
+// meshoptimizer has a single process-wide allocator, so its allocations cannot be attributed to individual files
+static std::atomic<uint64_t> gMeshoptAllocations(0);
+static std::atomic<uint64_t> gMeshoptAllocatedBytes(0);
+
+double getTime()
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+StageTimer::StageTimer(Report* report, Stage stage)
+    : report(report)
+    , stage(stage)
+    , start(report || isTracing() ? getTime() : 0)
+{
+}
+
+StageTimer::~StageTimer()
+{
+	if (!report && !isTracing())
+		return;
+
+	double end = getTime();
+
+	if (report)
+		report->stages[stage] += end - start;
+
+	traceEvent(kStageNames[stage], "file", report && !report->input.empty() ? report->input.c_str() : NULL, start, end);
+}
+
+uint64_t getPeakMemory()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters = {};
+	return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? uint64_t(counters.PeakWorkingSetSize) : 0;
+#else
+	rusage usage = {};
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+#ifdef __APPLE__
+	return uint64_t(usage.ru_maxrss);
+#else
+	return uint64_t(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+static void* reportAlloc(void* user, cgltf_size size)
+{
+	// a file's cgltf data is only ever allocated from one thread at a time
+	Report* report = static_cast<Report*>(user);
+	report->allocations++;
+	report->allocated_bytes += size;
+
+	return malloc(size);
+}
+
+static void reportFree(void*, void* ptr)
+{
+	free(ptr);
+}
+
+cgltf_memory_options getReportAllocator(Report* report)
+{
+	cgltf_memory_options memory = {};
+
+	if (report)
+	{
+		memory.alloc = reportAlloc;
+		memory.free = reportFree;
+		memory.user_data = report;
+	}
+
+	return memory;
+}
+
+static void* meshoptAlloc(size_t size)
+{
+	gMeshoptAllocations++;
+	gMeshoptAllocatedBytes += size;
+
+	return operator new(size);
+}
+
+static void meshoptFree(void* ptr)
+{
+	operator delete(ptr);
+}
+
+void countMeshoptAllocations()
+{
+	// must run before any meshoptimizer call, since blocks have to be released by the allocator that made them
+	meshopt_setAllocator(meshoptAlloc, meshoptFree);
+}
+
+static double getTotalTime(const Report& report)
+{
+	double result = 0;
+
+	for (int i = 0; i < Stage_Count; ++i)
+		result += report.stages[i];
+
+	return result;
+}
+
+void printReport(const Report& report)
+{
+	size_t triangles_before = 0, triangles_after = 0, cached = 0;
+
+	for (size_t i = 0; i < report.meshes.size(); ++i)
+	{
+		triangles_before += report.meshes[i].triangles_before;
+		triangles_after += report.meshes[i].triangles_after;
+		cached += report.meshes[i].cached;
+	}
+
+	fprintf(stderr, "report: %s\n", report.input.c_str());
+
+	for (int i = 0; i < Stage_Count; ++i)
+		fprintf(stderr, "  %-14s %10.2f ms\n", kStageNames[i], report.stages[i]);
+
+	fprintf(stderr, "  %-14s %10.2f ms\n", "total", getTotalTime(report));
+	fprintf(stderr, "  meshes: %d primitives, %d -> %d triangles, %d cached\n", int(report.meshes.size()), int(triangles_before), int(triangles_after), int(cached));
+	fprintf(stderr, "  allocations: %llu cgltf (%.1f MB), %llu meshoptimizer (%.1f MB, whole process)\n",
+	        (unsigned long long)report.allocations, double(report.allocated_bytes) / (1024 * 1024),
+	        (unsigned long long)gMeshoptAllocations.load(), double(gMeshoptAllocatedBytes.load()) / (1024 * 1024));
+	fprintf(stderr, "  peak memory: %.1f MB\n", double(getPeakMemory()) / (1024 * 1024));
+}
+
+void writeJsonString(FILE* file, const char* value)
+{
+	fputc('"', file);
+
+	for (const char* ptr = value; *ptr; ++ptr)
+	{
+		unsigned char ch = static_cast<unsigned char>(*ptr);
+
+		if (ch == '"' || ch == '\\')
+			fprintf(file, "\\%c", ch);
+		else if (ch < 0x20)
+			fprintf(file, "\\u%04x", ch);
+		else
+			fputc(ch, file);
+	}
+
+	fputc('"', file);
+}
+
+bool writeReport(const char* path, const std::vector<Report>& reports)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		fprintf(stderr, "Failed to write report %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "{\n\t\"version\": \"%s\",\n", getVersion().c_str());
+	fprintf(file, "\t\"peak_memory\": %llu,\n", (unsigned long long)getPeakMemory());
+	fprintf(file, "\t\"meshopt_allocations\": %llu,\n", (unsigned long long)gMeshoptAllocations.load());
+	fprintf(file, "\t\"meshopt_allocated_bytes\": %llu,\n", (unsigned long long)gMeshoptAllocatedBytes.load());
+	fprintf(file, "\t\"files\": [");
+
+	for (size_t i = 0; i < reports.size(); ++i)
+	{
+		const Report& report = reports[i];
+
+		fprintf(file, "%s\n\t\t{\n\t\t\t\"input\": ", i ? "," : "");
+		writeJsonString(file, report.input.c_str());
+		fprintf(file, ",\n\t\t\t\"output\": ");
+		writeJsonString(file, report.output.c_str());
+		fprintf(file, ",\n\t\t\t\"result\": %d,\n", report.result);
+		fprintf(file, "\t\t\t\"time\": %.3f,\n", getTotalTime(report));
+
+		fprintf(file, "\t\t\t\"stages\": {");
+		for (int j = 0; j < Stage_Count; ++j)
+			fprintf(file, "%s\"%s\": %.3f", j ? ", " : "", kStageNames[j], report.stages[j]);
+		fprintf(file, "},\n");
+
+		fprintf(file, "\t\t\t\"allocations\": %llu,\n", (unsigned long long)report.allocations);
+		fprintf(file, "\t\t\t\"allocated_bytes\": %llu,\n", (unsigned long long)report.allocated_bytes);
+
+		fprintf(file, "\t\t\t\"meshes\": [");
+		for (size_t j = 0; j < report.meshes.size(); ++j)
+		{
+			const MeshReport& mesh = report.meshes[j];
+
+			fprintf(file, "%s\n\t\t\t\t{\"name\": ", j ? "," : "");
+			writeJsonString(file, mesh.name.c_str());
+			fprintf(file, ", \"vertices\": %d, \"triangles_before\": %d, \"triangles_after\": %d, \"cached\": %s, \"time\": %.3f}",
+			        int(mesh.vertex_count), int(mesh.triangles_before), int(mesh.triangles_after), mesh.cached ? "true" : "false", mesh.time);
+		}
+		fprintf(file, "%s]\n\t\t}", report.meshes.empty() ? "" : "\n\t\t\t");
+	}
+
+	fprintf(file, "%s]\n}\n", reports.empty() ? "" : "\n\t");
+
+	if (fclose(file) != 0)
+	{
+		fprintf(stderr, "Failed to write report %s\n", path);
+		return false;
+	}
+
+	return true;
+}
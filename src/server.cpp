@@ -0,0 +1,462 @@
+#include "vrmpack.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Protocol: one or more requests per connection, each answered before the next one is read; all integers are little-endian
+//   request:  u32 options size, options (vrmpack options separated by spaces, e.g. "-si 0.5 -tmax 1024"), u64 input size, input (.vrm)
+//   response: u32 status (0 on success), u64 payload size, payload (.vrm on success, error message otherwise)
+static const uint32_t kMaxOptionsSize = 4096;
+static const uint64_t kMaxInputSize = uint64_t(1) << 30;
+
+// connections beyond this wait in the listen backlog; -serve-jobs only limits requests that are being processed
+static const int kMaxConnections = 64;
+static const size_t kInputChunkSize = 1 << 20;
+
+#ifndef _WIN32
+typedef std::chrono::steady_clock Clock;
+
+static volatile sig_atomic_t gStopRequested = 0;
+
+static void handleStopSignal(int)
+{
+	gStopRequested = 1;
+}
+
+// waits until fd is ready or the deadline passes; idle waits also give up when the server starts draining
+static bool waitSocket(int fd, short events, Clock::time_point deadline, bool idle)
+{
+	for (;;)
+	{
+		if (idle && gStopRequested)
+			return false;
+
+		long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+		if (remaining <= 0)
+			return false;
+
+		pollfd entry = {fd, events, 0};
+		int result = poll(&entry, 1, int(remaining < 100 ? remaining : 100));
+
+		if (result > 0)
+			return true;
+
+		if (result < 0 && errno != EINTR)
+			return false;
+	}
+}
+
+static bool readSocket(int fd, void* data, size_t size, Clock::time_point deadline, bool idle = false)
+{
+	char* bytes = static_cast<char*>(data);
+
+	while (size)
+	{
+		if (!waitSocket(fd, POLLIN, deadline, idle))
+			return false;
+
+		ssize_t result = recv(fd, bytes, size, 0);
+
+		if (result == 0 || (result < 0 && errno != EINTR && errno != EAGAIN))
+			return false;
+
+		if (result > 0)
+		{
+			bytes += result;
+			size -= size_t(result);
+			idle = false;
+		}
+	}
+
+	return true;
+}
+
+static bool writeSocket(int fd, const void* data, size_t size, Clock::time_point deadline)
+{
+	const char* bytes = static_cast<const char*>(data);
+
+	while (size)
+	{
+		if (!waitSocket(fd, POLLOUT, deadline, false))
+			return false;
+
+		ssize_t result = send(fd, bytes, size, 0);
+
+		if (result < 0 && errno != EINTR && errno != EAGAIN)
+			return false;
+
+		if (result > 0)
+		{
+			bytes += result;
+			size -= size_t(result);
+		}
+	}
+
+	return true;
+}
+
+static void encodeUint(uint8_t* result, uint64_t value, int size)
+{
+	for (int i = 0; i < size; ++i)
+		result[i] = uint8_t(value >> (i * 8));
+}
+
+static uint64_t decodeUint(const uint8_t* data, int size)
+{
+	uint64_t result = 0;
+
+	for (int i = 0; i < size; ++i)
+		result |= uint64_t(data[i]) << (i * 8);
+
+	return result;
+}
+
+static bool writeMessage(int fd, uint32_t status, const std::vector<char>& payload, Clock::time_point deadline)
+{
+	uint8_t header[12];
+	encodeUint(header, status, 4);
+	encodeUint(header + 4, payload.size(), 8);
+
+	return writeSocket(fd, header, sizeof(header), deadline) && (payload.empty() || writeSocket(fd, &payload[0], payload.size(), deadline));
+}
+
+static void sendError(int fd, const char* message, Clock::time_point deadline)
+{
+	std::vector<char> payload(message, message + strlen(message));
+	writeMessage(fd, 1, payload, deadline);
+}
+
+// grows the buffer as data arrives, so that a size header alone does not allocate memory
+static bool readInput(int fd, std::vector<char>& input, size_t size, Clock::time_point deadline)
+{
+	while (input.size() < size)
+	{
+		size_t offset = input.size();
+		size_t chunk = std::min(size - offset, std::max(offset, kInputChunkSize));
+
+		input.resize(offset + chunk);
+
+		if (!readSocket(fd, &input[offset], chunk, deadline))
+			return false;
+	}
+
+	return true;
+}
+
+struct Slots
+{
+	std::mutex mutex;
+	std::condition_variable released;
+	int available;
+};
+
+static int processRequest(Slots& slots, const ServeCallback& callback, const std::string& options, const std::vector<char>& input, std::vector<char>& output)
+{
+	{
+		std::unique_lock<std::mutex> lock(slots.mutex);
+		slots.released.wait(lock, [&]() { return slots.available > 0; });
+		slots.available--;
+	}
+
+	int status = callback(options, input, output);
+
+	{
+		std::lock_guard<std::mutex> guard(slots.mutex);
+		slots.available++;
+	}
+
+	slots.released.notify_one();
+
+	return status;
+}
+
+static void serveConnection(int fd, int timeout, Slots& slots, const ServeCallback& callback)
+{
+	for (;;)
+	{
+		// the timeout applies to receiving a request once it starts and to sending its response; waiting for a -serve-jobs slot
+		// and processing itself are not interrupted
+		uint8_t size[8];
+
+		if (!readSocket(fd, size, 4, Clock::now() + std::chrono::seconds(timeout), true))
+			break;
+
+		Clock::time_point deadline = Clock::now() + std::chrono::seconds(timeout);
+
+		uint32_t options_size = uint32_t(decodeUint(size, 4));
+		if (options_size > kMaxOptionsSize)
+		{
+			sendError(fd, "options are too long", deadline);
+			break;
+		}
+
+		std::string options(options_size, ' ');
+		if (options_size && !readSocket(fd, &options[0], options_size, deadline))
+			break;
+
+		if (!readSocket(fd, size, 8, deadline))
+			break;
+
+		uint64_t input_size = decodeUint(size, 8);
+		if (input_size > kMaxInputSize)
+		{
+			sendError(fd, "input is too large", deadline);
+			break;
+		}
+
+		std::vector<char> input;
+		if (!readInput(fd, input, static_cast<size_t>(input_size), deadline))
+			break;
+
+		std::vector<char> output;
+		int status = processRequest(slots, callback, options, input, output);
+
+		if (!writeMessage(fd, uint32_t(status), output, Clock::now() + std::chrono::seconds(timeout)))
+			break;
+	}
+
+	close(fd);
+}
+
+struct Connection
+{
+	std::thread thread;
+	bool done;
+};
+
+// a socket left behind by a previous instance would make bind fail; it is removed only when nothing accepts connections on it
+static bool removeStaleSocket(const char* path, const sockaddr_un& address)
+{
+	struct stat info;
+	if (lstat(path, &info) != 0)
+		return errno == ENOENT;
+
+	if (!S_ISSOCK(info.st_mode))
+	{
+		fprintf(stderr, "Failed to listen on %s: the path exists and is not a socket\n", path);
+		return false;
+	}
+
+	int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (probe < 0)
+	{
+		fprintf(stderr, "Failed to create socket: %s\n", strerror(errno));
+		return false;
+	}
+
+	bool refused = connect(probe, (const sockaddr*)&address, sizeof(address)) != 0 && errno == ECONNREFUSED;
+	close(probe);
+
+	if (!refused)
+	{
+		fprintf(stderr, "Failed to listen on %s: another server is using the socket\n", path);
+		return false;
+	}
+
+	if (unlink(path) != 0)
+	{
+		fprintf(stderr, "Failed to remove stale socket %s: %s\n", path, strerror(errno));
+		return false;
+	}
+
+	return true;
+}
+
+int serve(const char* path, int jobs, int timeout, const ServeCallback& callback)
+{
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+
+	if (strlen(path) >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "Socket path %s is too long\n", path);
+		return 1;
+	}
+
+	strcpy(address.sun_path, path);
+
+	if (!removeStaleSocket(path, address))
+		return 1;
+
+	int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener < 0)
+	{
+		fprintf(stderr, "Failed to create socket: %s\n", strerror(errno));
+		return 1;
+	}
+
+	if (bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 64) != 0)
+	{
+		fprintf(stderr, "Failed to listen on %s: %s\n", path, strerror(errno));
+		close(listener);
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, handleStopSignal);
+	signal(SIGTERM, handleStopSignal);
+
+	std::mutex mutex;
+	std::condition_variable finished;
+	std::list<std::unique_ptr<Connection> > connections;
+	int active = 0;
+
+	Slots slots;
+	slots.available = jobs;
+
+	while (!gStopRequested)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+
+		// connections beyond the limit wait in the listen backlog
+		if (active >= kMaxConnections)
+		{
+			finished.wait_for(lock, std::chrono::milliseconds(100));
+			continue;
+		}
+
+		for (std::list<std::unique_ptr<Connection> >::iterator it = connections.begin(); it != connections.end();)
+		{
+			if ((*it)->done)
+			{
+				(*it)->thread.join();
+				it = connections.erase(it);
+			}
+			else
+				++it;
+		}
+
+		lock.unlock();
+
+		pollfd entry = {listener, POLLIN, 0};
+		if (poll(&entry, 1, 100) <= 0)
+			continue;
+
+		int fd = accept(listener, NULL, NULL);
+		if (fd < 0)
+			continue;
+
+		lock.lock();
+
+		active++;
+		connections.push_back(std::unique_ptr<Connection>(new Connection()));
+		Connection* connection = connections.back().get();
+
+		connection->done = false;
+		connection->thread = std::thread([&, fd, connection]() {
+			serveConnection(fd, timeout, slots, callback);
+
+			std::lock_guard<std::mutex> guard(mutex);
+			active--;
+			connection->done = true;
+			finished.notify_all();
+		});
+	}
+
+	// drain: stop accepting, let requests in flight finish, then close idle connections
+	close(listener);
+	unlink(path);
+
+	for (std::list<std::unique_ptr<Connection> >::iterator it = connections.begin(); it != connections.end(); ++it)
+		(*it)->thread.join();
+
+	return 0;
+}
+
+int request(const char* path, const std::string& options, const std::vector<char>& input, std::vector<char>& output)
+{
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+
+	if (strlen(path) >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "Socket path %s is too long\n", path);
+		return 1;
+	}
+
+	strcpy(address.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0 || connect(fd, (sockaddr*)&address, sizeof(address)) != 0)
+	{
+		fprintf(stderr, "Failed to connect to %s: %s\n", path, strerror(errno));
+		if (fd >= 0)
+			close(fd);
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+
+	// the client waits for as long as processing takes
+	Clock::time_point forever = Clock::time_point::max();
+
+	uint8_t header[12];
+	encodeUint(header, options.size(), 4);
+	encodeUint(header + 4, input.size(), 8);
+
+	bool ok = writeSocket(fd, header, 4, forever) && writeSocket(fd, options.data(), options.size(), forever) &&
+	          writeSocket(fd, header + 4, 8, forever) && (input.empty() || writeSocket(fd, &input[0], input.size(), forever));
+
+	uint32_t status = 1;
+
+	if (ok && readSocket(fd, header, sizeof(header), forever))
+	{
+		status = uint32_t(decodeUint(header, 4));
+		output.resize(size_t(decodeUint(header + 4, 8)));
+
+		ok = output.empty() || readSocket(fd, &output[0], output.size(), forever);
+	}
+	else
+		ok = false;
+
+	close(fd);
+
+	if (!ok)
+	{
+		fprintf(stderr, "Failed to exchange request with %s\n", path);
+		return 1;
+	}
+
+	return int(status);
+}
+#else
+int serve(const char* path, int jobs, int timeout, const ServeCallback& callback)
+{
+	(void)path;
+	(void)jobs;
+	(void)timeout;
+	(void)callback;
+
+	fprintf(stderr, "Serving requests is not supported on this platform\n");
+	return 1;
+}
+
+int request(const char* path, const std::string& options, const std::vector<char>& input, std::vector<char>& output)
+{
+	(void)path;
+	(void)options;
+	(void)input;
+	(void)output;
+
+	fprintf(stderr, "Serving requests is not supported on this platform\n");
+	return 1;
+}
+#endif
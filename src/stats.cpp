@@ -0,0 +1,134 @@
+#include "vrmpack.hpp"
+
+#include "meshoptimizer/src/meshoptimizer.h"
+
+#include <stdio.h>
+
+#include <vector>
+
+using namespace VRM;
+
+// typical post-transform cache size used by meshoptimizer's own analysis tools
+static const unsigned int kCacheSize = 16;
+
+void analyzeMesh(const Mesh& mesh, MeshStatistics& result)
+{
+	result = MeshStatistics();
+
+	if (mesh.indices.empty() || mesh.positions.empty())
+		return;
+
+	meshopt_VertexCacheStatistics vcache = meshopt_analyzeVertexCache(&mesh.indices[0], mesh.indices.size(), mesh.vertex_count, kCacheSize, 0, 0);
+	meshopt_OverdrawStatistics overdraw = meshopt_analyzeOverdraw(&mesh.indices[0], mesh.indices.size(), &mesh.positions[0], mesh.vertex_count, sizeof(float) * 3);
+	meshopt_VertexFetchStatistics vfetch = meshopt_analyzeVertexFetch(&mesh.indices[0], mesh.indices.size(), mesh.vertex_count, mesh.vertex_size);
+
+	// ATVR and overfetch are relative to the vertices the indices use, as in meshoptimizer's own analyzers
+	std::vector<bool> referenced(mesh.vertex_count);
+	uint64_t vertices_referenced = 0;
+
+	for (size_t i = 0; i < mesh.indices.size(); ++i)
+	{
+		unsigned int index = mesh.indices[i];
+
+		if (index < mesh.vertex_count && !referenced[index])
+		{
+			referenced[index] = true;
+			vertices_referenced++;
+		}
+	}
+
+	result.triangles = mesh.indices.size() / 3;
+	result.vertices = mesh.vertex_count;
+	result.vertices_referenced = vertices_referenced;
+	result.vertices_transformed = vcache.vertices_transformed;
+	result.pixels_covered = overdraw.pixels_covered;
+	result.pixels_shaded = overdraw.pixels_shaded;
+	result.bytes_fetched = vfetch.bytes_fetched;
+	result.vertex_bytes = vertices_referenced * mesh.vertex_size;
+}
+
+static double getRatio(uint64_t value, uint64_t total)
+{
+	return total ? double(value) / double(total) : 0;
+}
+
+static void addStatistics(MeshStatistics& result, const MeshStatistics& stats)
+{
+	result.triangles += stats.triangles;
+	result.vertices += stats.vertices;
+	result.vertices_referenced += stats.vertices_referenced;
+	result.vertices_transformed += stats.vertices_transformed;
+	result.pixels_covered += stats.pixels_covered;
+	result.pixels_shaded += stats.pixels_shaded;
+	result.bytes_fetched += stats.bytes_fetched;
+	result.vertex_bytes += stats.vertex_bytes;
+}
+
+static void printStatistics(FILE* file, const MeshStatistics& stats)
+{
+	fprintf(file, "{\"triangles\": %llu, \"vertices\": %llu, \"vertices_referenced\": %llu, \"acmr\": %.4f, \"atvr\": %.4f, \"overdraw\": %.4f, \"overfetch\": %.4f}",
+	        (unsigned long long)stats.triangles, (unsigned long long)stats.vertices, (unsigned long long)stats.vertices_referenced,
+	        getRatio(stats.vertices_transformed, stats.triangles), getRatio(stats.vertices_transformed, stats.vertices_referenced),
+	        getRatio(stats.pixels_shaded, stats.pixels_covered), getRatio(stats.bytes_fetched, stats.vertex_bytes));
+}
+
+bool writeStatistics(const char* path, const std::vector<Report>& reports)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		fprintf(stderr, "Failed to write statistics %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "{\n\t\"version\": \"%s\",\n\t\"cache_size\": %d,\n\t\"files\": [", getVersion().c_str(), int(kCacheSize));
+
+	for (size_t i = 0; i < reports.size(); ++i)
+	{
+		const Report& report = reports[i];
+
+		// totals weigh each primitive by its share of the counters, e.g. the avatar ACMR is transformed vertices over all triangles
+		MeshStatistics before = {}, after = {};
+
+		for (size_t j = 0; j < report.meshes.size(); ++j)
+		{
+			addStatistics(before, report.meshes[j].before);
+			addStatistics(after, report.meshes[j].after);
+		}
+
+		fprintf(file, "%s\n\t\t{\n\t\t\t\"input\": ", i ? "," : "");
+		writeJsonString(file, report.input.c_str());
+		fprintf(file, ",\n\t\t\t\"output\": ");
+		writeJsonString(file, report.output.c_str());
+		fprintf(file, ",\n\t\t\t\"result\": %d,\n\t\t\t\"before\": ", report.result);
+		printStatistics(file, before);
+		fprintf(file, ",\n\t\t\t\"after\": ");
+		printStatistics(file, after);
+		fprintf(file, ",\n\t\t\t\"primitives\": [");
+
+		for (size_t j = 0; j < report.meshes.size(); ++j)
+		{
+			const MeshReport& mesh = report.meshes[j];
+
+			fprintf(file, "%s\n\t\t\t\t{\"name\": ", j ? "," : "");
+			writeJsonString(file, mesh.name.c_str());
+			fprintf(file, ", \"before\": ");
+			printStatistics(file, mesh.before);
+			fprintf(file, ", \"after\": ");
+			printStatistics(file, mesh.after);
+			fprintf(file, "}");
+		}
+
+		fprintf(file, "%s]\n\t\t}", report.meshes.empty() ? "" : "\n\t\t\t");
+	}
+
+	fprintf(file, "%s]\n}\n", reports.empty() ? "" : "\n\t");
+
+	if (fclose(file) != 0)
+	{
+		fprintf(stderr, "Failed to write statistics %s\n", path);
+		return false;
+	}
+
+	return true;
+}
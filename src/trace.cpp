@@ -0,0 +1,169 @@
+#include "vrmpack.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// events per thread; once a buffer is full the oldest events are overwritten, so memory stays bounded in long running servers
+static const size_t kTraceCapacity = 16384;
+
+struct TraceEvent
+{
+	const char* name;
+	const char* detail_key;
+	char detail[48];
+
+	double start;
+	double end;
+
+	long long triangles_before;
+	long long triangles_after;
+};
+
+struct TraceBuffer
+{
+	int thread_id;
+
+	std::vector<TraceEvent> events;
+	size_t count;
+};
+
+static std::atomic<bool> gTraceEnabled(false);
+static double gTraceStart = 0;
+
+// buffers are owned here rather than by their threads so that events of threads that exited are still written
+static std::mutex gTraceMutex;
+static std::vector<std::unique_ptr<TraceBuffer> > gTraceBuffers;
+
+static thread_local TraceBuffer* gThreadBuffer = NULL;
+
+void startTrace()
+{
+	gTraceStart = getTime();
+	gTraceEnabled = true;
+}
+
+bool isTracing()
+{
+	return gTraceEnabled.load(std::memory_order_relaxed);
+}
+
+static TraceBuffer* getThreadBuffer()
+{
+	if (!gThreadBuffer)
+	{
+		std::lock_guard<std::mutex> lock(gTraceMutex);
+
+		gTraceBuffers.push_back(std::unique_ptr<TraceBuffer>(new TraceBuffer()));
+		gThreadBuffer = gTraceBuffers.back().get();
+
+		gThreadBuffer->thread_id = int(gTraceBuffers.size());
+		gThreadBuffer->events.resize(kTraceCapacity);
+		gThreadBuffer->count = 0;
+	}
+
+	return gThreadBuffer;
+}
+
+void traceEvent(const char* name, const char* detail_key, const char* detail, double start, double end, long long triangles_before, long long triangles_after)
+{
+	if (!isTracing())
+		return;
+
+	// only the owning thread writes to its buffer, so recording takes no locks
+	TraceBuffer* buffer = getThreadBuffer();
+	TraceEvent& event = buffer->events[buffer->count % kTraceCapacity];
+
+	event.name = name;
+	event.detail_key = detail ? detail_key : NULL;
+	event.detail[0] = 0;
+	event.start = start;
+	event.end = end;
+	event.triangles_before = triangles_before;
+	event.triangles_after = triangles_after;
+
+	if (detail)
+	{
+		size_t length = strlen(detail);
+
+		// a name that does not fit is cut at a character boundary, so that the trace stays valid UTF-8
+		if (length > sizeof(event.detail) - 1)
+		{
+			length = sizeof(event.detail) - 1;
+
+			while (length > 0 && (detail[length] & 0xc0) == 0x80)
+				length--;
+		}
+
+		memcpy(event.detail, detail, length);
+		event.detail[length] = 0;
+	}
+
+	buffer->count++;
+}
+
+bool writeTrace(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (!file)
+	{
+		fprintf(stderr, "Failed to write trace %s\n", path);
+		return false;
+	}
+
+	// called once processing is over, when no thread records events anymore
+	std::lock_guard<std::mutex> lock(gTraceMutex);
+
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"vrmpack\"}}");
+
+	size_t dropped = 0;
+
+	for (size_t i = 0; i < gTraceBuffers.size(); ++i)
+	{
+		const TraceBuffer& buffer = *gTraceBuffers[i];
+
+		fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}", buffer.thread_id, buffer.thread_id);
+
+		size_t first = buffer.count > kTraceCapacity ? buffer.count - kTraceCapacity : 0;
+		dropped += first;
+
+		for (size_t j = first; j < buffer.count; ++j)
+		{
+			const TraceEvent& event = buffer.events[j % kTraceCapacity];
+
+			fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"vrmpack\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.1f,\"dur\":%.1f,\"args\":{",
+			        event.name, buffer.thread_id, (event.start - gTraceStart) * 1000, (event.end - event.start) * 1000);
+
+			const char* separator = "";
+
+			if (event.detail_key)
+			{
+				fprintf(file, "\"%s\":", event.detail_key);
+				writeJsonString(file, event.detail);
+				separator = ",";
+			}
+
+			if (event.triangles_before >= 0)
+				fprintf(file, "%s\"triangles_before\":%lld,\"triangles_after\":%lld", separator, event.triangles_before, event.triangles_after);
+
+			fprintf(file, "}}");
+		}
+	}
+
+	fprintf(file, "\n]}\n");
+
+	if (dropped)
+		fprintf(stderr, "Warning: trace buffers overflowed, %d oldest events were dropped\n", int(dropped));
+
+	if (fclose(file) != 0)
+	{
+		fprintf(stderr, "Failed to write trace %s\n", path);
+		return false;
+	}
+
+	return true;
+}
@@ -1,11 +1,22 @@
 #include "vrmpack.hpp"
 
-#include <ctype.h>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <set>
 #include <sstream>
 
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
 #define CGLTF_IMPLEMENTATION
 #define CGLTF_WRITE_IMPLEMENTATION
 #define CGLTF_VRM_v0_0_IMPLEMENTATION
@@ -22,13 +33,14 @@ std::string getVersion()
 	return result;
 }
 
-static Settings defaults()
+Settings getDefaultSettings()
 {
 	Settings settings = {};
 	settings.simplify_threshold = 1.f;
 	settings.simplify_aggressive = false;
 	settings.target_error = 1e-2f;
 	settings.target_error_aggressive = 1e-1f;
+	settings.cache_limit = 256 << 20;
 	return settings;
 }
 
@@ -44,7 +56,7 @@ static cgltf_skin* get_skin(const cgltf_data* data, const cgltf_mesh* mesh)
 	}
 	return NULL;
 }
-static void processMesh(Mesh* mesh, Settings& settings)
+static void processMesh(Mesh* mesh, const Settings& settings)
 {
 	const size_t target_index_count = size_t(double(mesh->indices.size() / 3) * settings.simplify_threshold) * 3;
 
@@ -82,6 +94,8 @@ static void parseAccessors(Mesh* mesh)
 		{
 			acc_POSITION = attr->data;
 		}
+
+		mesh->vertex_size += cgltf_calc_size(attr->data->type, attr->data->component_type);
 	}
 
 	if (acc_POSITION != nullptr)
@@ -95,27 +109,8 @@ static void parseAccessors(Mesh* mesh)
 	}
 }
 
-static cgltf_data* parse(const char* input, std::vector<Mesh*>& meshes)
+static void parseMeshes(cgltf_data* data, std::vector<Mesh*>& meshes)
 {
-	cgltf_options options = {};
-	cgltf_data* data = nullptr;
-	cgltf_result result = cgltf_parse_file(&options, input, &data);
-
-	if (result != cgltf_result_success)
-	{
-		fprintf(stderr, "Failed to parse file %s\n", input);
-		return nullptr;
-	}
-
-	result = cgltf_load_buffers(&options, data, input);
-
-	if (result != cgltf_result_success)
-	{
-		cgltf_free(data);
-		fprintf(stderr, "Failed to load buffers from %s\n", input);
-		return nullptr;
-	}
-
 	for (cgltf_size i = 0; i < data->meshes_count; ++i)
 	{
 		cgltf_mesh* mesh = &data->meshes[i];
@@ -135,227 +130,862 @@ static cgltf_data* parse(const char* input, std::vector<Mesh*>& meshes)
 			meshes.push_back(m);
 		}
 	}
+}
+
+// input files are mapped copy-on-write instead of read, so pages that processing never touches (e.g. kept images) are not loaded up front;
+// the mapping is preceded by a page that records its length for unmapFile
+static cgltf_result mapFile(const cgltf_memory_options* memory, const cgltf_file_options* file, const char* path, cgltf_size* size, void** data)
+{
+#ifdef _WIN32
+	return cgltf_default_file_read(memory, file, path, size, data);
+#else
+	(void)memory;
+	(void)file;
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		return cgltf_result_file_not_found;
+	}
+
+	struct stat st = {};
+	if (fstat(fd, &st) != 0 || st.st_size <= 0 || (*size && *size > cgltf_size(st.st_size)))
+	{
+		close(fd);
+		return cgltf_result_io_error;
+	}
+
+	size_t length = *size ? *size : size_t(st.st_size);
+	size_t page = size_t(sysconf(_SC_PAGESIZE));
+
+	char* base = (char*)mmap(NULL, page + length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED)
+	{
+		close(fd);
+		return cgltf_result_out_of_memory;
+	}
+
+	void* contents = mmap(base + page, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+	close(fd);
+
+	if (contents == MAP_FAILED)
+	{
+		munmap(base, page + length);
+		return cgltf_result_io_error;
+	}
+
+	memcpy(base, &length, sizeof(length));
+
+	*size = length;
+	*data = contents;
+	return cgltf_result_success;
+#endif
+}
+
+static void unmapFile(const cgltf_memory_options* memory, const cgltf_file_options* file, void* data)
+{
+#ifdef _WIN32
+	cgltf_default_file_release(memory, file, data);
+#else
+	(void)memory;
+	(void)file;
+
+	if (!data)
+	{
+		return;
+	}
+
+	size_t page = size_t(sysconf(_SC_PAGESIZE));
+	char* base = (char*)data - page;
+
+	size_t length = 0;
+	memcpy(&length, base, sizeof(length));
+	munmap(base, page + length);
+#endif
+}
+
+static bool hasAccessorData(const cgltf_accessor* accessor)
+{
+	return !accessor || !accessor->buffer_view || cgltf_buffer_view_data(accessor->buffer_view);
+}
+
+// geometry is always needed, so buffers holding it are read right away and a missing file is an error instead of empty meshes; buffers that only hold images stay unread
+static bool loadMeshBuffers(cgltf_data* data)
+{
+	for (cgltf_size i = 0; i < data->meshes_count; ++i)
+	{
+		for (cgltf_size j = 0; j < data->meshes[i].primitives_count; ++j)
+		{
+			const cgltf_primitive& primitive = data->meshes[i].primitives[j];
+
+			if (!hasAccessorData(primitive.indices))
+			{
+				return false;
+			}
+
+			for (cgltf_size k = 0; k < primitive.attributes_count; ++k)
+			{
+				if (!hasAccessorData(primitive.attributes[k].data))
+				{
+					return false;
+				}
+			}
+
+			for (cgltf_size k = 0; k < primitive.targets_count; ++k)
+			{
+				for (cgltf_size l = 0; l < primitive.targets[k].attributes_count; ++l)
+				{
+					if (!hasAccessorData(primitive.targets[k].attributes[l].data))
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+static void release(cgltf_data* data, std::vector<Mesh*>& meshes)
+{
+	for (size_t i = 0; i < meshes.size(); ++i)
+	{
+		delete meshes[i];
+	}
+	meshes.clear();
+
+	cgltf_free(data);
+}
+
+// owns the parsed data and its meshes, so that they are released on every path out of processing, including exceptions
+struct ParsedFile
+{
+	cgltf_data* data;
+	std::vector<Mesh*> meshes;
+
+	ParsedFile()
+	    : data(nullptr)
+	{
+	}
+
+	~ParsedFile()
+	{
+		release(data, meshes);
+	}
+
+	ParsedFile(const ParsedFile&) = delete;
+	ParsedFile& operator=(const ParsedFile&) = delete;
+};
+
+static cgltf_data* parseBuffer(const cgltf_options& options, const void* buffer, size_t size, const char* path, std::vector<Mesh*>& meshes, Report* report)
+{
+	cgltf_options parse_options = options;
+	cgltf_data* data = nullptr;
+
+	// external buffers are only read once something asks for their contents
+	parse_options.lazy_buffers = true;
+	cgltf_result result = cgltf_result_success;
+
+	{
+		StageTimer timer(report, Stage_Parse);
+		result = cgltf_parse(&parse_options, buffer, size, &data);
+	}
+
+	if (result != cgltf_result_success)
+	{
+		fprintf(stderr, "Failed to parse %s\n", path ? path : "input");
+		return nullptr;
+	}
+
+	// the data is not owned by the caller until it is returned
+	try
+	{
+		// without a path, buffers can only come from the GLB binary chunk or data URIs
+		{
+			StageTimer timer(report, Stage_LoadBuffers);
+			result = cgltf_load_buffers(&parse_options, data, path);
+
+			if (result == cgltf_result_success && !loadMeshBuffers(data))
+			{
+				result = cgltf_result_io_error;
+			}
+		}
+
+		if (result != cgltf_result_success)
+		{
+			cgltf_free(data);
+			fprintf(stderr, "Failed to load buffers from %s\n", path ? path : "input");
+			return nullptr;
+		}
+
+		parseMeshes(data, meshes);
+	}
+	catch (...)
+	{
+		release(data, meshes);
+		throw;
+	}
 
 	return data;
 }
 
-static void write_bin(cgltf_data* data, std::string output)
+static cgltf_data* parse(const char* input, std::vector<Mesh*>& meshes, Report* report)
 {
-	std::ofstream fout;
-	fout.open(output.c_str(), std::ios::out | std::ios::binary);
+	cgltf_options options = {};
+	options.memory = getReportAllocator(report);
 
-	for (cgltf_size i = 0; i < data->buffers_count; i++)
+	if (!options.memory.alloc)
 	{
-		cgltf_buffer* buffer = &data->buffers[i];
-		fout.write(reinterpret_cast<const char*>(&buffer->size), 4);
-		fout.write(reinterpret_cast<const char*>(&GlbMagicBinChunk), 4);
-		fout.write(reinterpret_cast<const char*>(buffer->data), buffer->size);
+		options.memory.alloc = &cgltf_default_alloc;
+		options.memory.free = &cgltf_default_free;
 	}
 
-	fout.close();
+	// parsed data lives in an arena, so teardown releases a few blocks instead of every name and property
+	options.memory.arena = true;
+
+	options.file.read = mapFile;
+	options.file.release = unmapFile;
+
+	void* file_data = nullptr;
+	cgltf_size file_size = 0;
+	cgltf_result result = cgltf_result_success;
+
+	{
+		StageTimer timer(report, Stage_Read);
+		result = mapFile(&options.memory, &options.file, input, &file_size, &file_data);
+	}
+
+	if (result != cgltf_result_success)
+	{
+		fprintf(stderr, "Failed to read file %s\n", input);
+		return nullptr;
+	}
+
+	cgltf_data* data = parseBuffer(options, file_data, file_size, input, meshes, report);
+
+	if (data == nullptr)
+	{
+		unmapFile(&options.memory, &options.file, file_data);
+		return nullptr;
+	}
+
+	// released by cgltf_free along with the rest of the data
+	data->file_data = file_data;
+
+	return data;
 }
 
-static void processBuffers(cgltf_data* data, std::vector<Mesh*> meshes)
+// a range of output bytes; the output GLB is assembled from these only when it is written, so unmodified views are never copied in between
+struct GlbSegment
+{
+	const char* data;
+	size_t size;
+};
+
+struct GlbOutput
 {
-	// update indices assuming indices never increase.
+	std::vector<std::vector<GlbSegment> > bins; // per buffer, for buffers that were laid out anew
+	std::vector<char> json;
+	std::vector<char> headers;
+	std::vector<char> zeros; // contents of buffers that have no data
+	std::vector<GlbSegment> segments;
+};
+
+static const char kZeros[4] = {};
+
+// ranges of the input this large are copied file to file instead of through memory
+static const size_t kFileCopySize = 16384;
+
+static void appendSegment(std::vector<GlbSegment>& segments, const char* data, size_t size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	// views that were adjacent in the source and stay adjacent in the output become one range
+	if (!segments.empty() && segments.back().data + segments.back().size == data)
+	{
+		segments.back().size += size;
+		return;
+	}
+
+	GlbSegment segment = {data, size};
+	segments.push_back(segment);
+}
+
+// removes buffers that were laid out anew without any views, since glTF requires a byteLength of at least 1
+static void removeEmptyBuffers(cgltf_data* data, std::vector<std::vector<GlbSegment> >& bins)
+{
+	std::vector<bool> used(data->buffers_count);
+
+	for (cgltf_size i = 0; i < data->buffer_views_count; ++i)
+	{
+		const cgltf_buffer_view& view = data->buffer_views[i];
+
+		used[view.buffer - data->buffers] = true;
+
+		if (view.has_meshopt_compression && view.meshopt_compression.buffer)
+			used[view.meshopt_compression.buffer - data->buffers] = true;
+	}
+
+	std::vector<cgltf_size> remap(data->buffers_count);
+	cgltf_size write = 0;
+
+	for (cgltf_size i = 0; i < data->buffers_count; ++i)
+	{
+		cgltf_buffer& buffer = data->buffers[i];
+
+		if (!used[i] && buffer.size == 0)
+		{
+			cgltf_free_buffer_data(data, &buffer);
+			data->memory.free(data->memory.user_data, buffer.uri);
+			data->memory.free(data->memory.user_data, buffer.lazy_path);
+			freeExtensions(data, buffer.extensions, buffer.extensions_count);
+			continue;
+		}
+
+		remap[i] = write;
+		bins[write].swap(bins[i]);
+		data->buffers[write++] = buffer;
+	}
+
+	if (write == data->buffers_count)
+		return;
+
+	for (cgltf_size i = 0; i < data->buffer_views_count; ++i)
+	{
+		cgltf_buffer_view& view = data->buffer_views[i];
+
+		view.buffer_index = remap[view.buffer - data->buffers];
+		view.buffer = &data->buffers[view.buffer_index];
+
+		if (view.has_meshopt_compression && view.meshopt_compression.buffer)
+			view.meshopt_compression.buffer = &data->buffers[remap[view.meshopt_compression.buffer - data->buffers]];
+	}
+
+	data->buffers_count = write;
+	bins.resize(write);
+}
+
+static void processBuffers(cgltf_data* data, std::vector<Mesh*> meshes, bool buffers_repack, bool stable_indices, std::vector<std::vector<GlbSegment> >& bins)
+{
+	// update indices assuming indices never increase; the GLB binary chunk may be the caller's input, so the new indices replace the view contents instead of being written in place
 	std::set<cgltf_size> buffers_changed;
 	for (const auto mesh : meshes)
 	{
 		cgltf_accessor* accessor = mesh->indices_accessor;
+		cgltf_buffer_view* buffer_view = accessor->buffer_view;
 
 		accessor->count = mesh->indices.size();
-		accessor->buffer_view->size = accessor->count * sizeof(uint32_t);
-		memcpy((uint8_t*)accessor->buffer_view->buffer->data + accessor->buffer_view->offset, &mesh->indices[0], accessor->buffer_view->size);
+		buffer_view->size = accessor->count * sizeof(uint32_t);
+
+		void* contents = data->memory.alloc(data->memory.user_data, buffer_view->size + 1);
+		memcpy(contents, mesh->indices.data(), buffer_view->size);
+
+		data->memory.free(data->memory.user_data, buffer_view->data);
+		buffer_view->data = contents;
 
 		buffers_changed.insert(mesh->indices_accessor->buffer_view->buffer_index);
 	}
 
-	// re-create buffers
-	for (const auto b : buffers_changed)
+	// re-layout buffers; image processing may have dropped views from buffers whose indices did not change
+	// view contents stay where they are, in the source buffer or in replacement data, and are only gathered when the GLB is written
+	bins.resize(data->buffers_count);
+
+	for (cgltf_size b = 0; b < data->buffers_count; ++b)
 	{
 		cgltf_buffer* buffer = &data->buffers[b];
-		uint8_t* dst = (uint8_t*)malloc(buffer->size);
+		if ((buffers_changed.count(b) == 0 && !buffers_repack) || cgltf_buffer_data(buffer) == nullptr)
+		{
+			continue;
+		}
+
 		cgltf_size dst_offset = 0;
 		for (cgltf_size i = 0; i < data->buffer_views_count; ++i)
 		{
 			cgltf_buffer_view* buffer_view = &data->buffer_views[i];
 			if (buffer_view->buffer_index == b)
 			{
-				memcpy(dst + dst_offset, (uint8_t*)buffer->data + buffer_view->offset, buffer_view->size);
+				const char* src = buffer_view->data ? (const char*)buffer_view->data : (const char*)buffer->data + buffer_view->offset;
+				cgltf_size padding = ((buffer_view->size + 3) & ~3) - buffer_view->size;
+
+				appendSegment(bins[b], src, buffer_view->size);
+				appendSegment(bins[b], kZeros, padding);
+
 				buffer_view->offset = dst_offset;
 				// align each bufferView by 4 bytes
-				dst_offset += (buffer_view->size + 3) & ~3;
+				dst_offset += buffer_view->size + padding;
 			}
 		}
 
-		data->buffers[b].size = dst_offset;
-		memcpy(buffer->data, dst, dst_offset);
-		free(dst);
+		// buffers without views are removed below, unless unparsed extensions may refer to them by index; then they keep their contents
+		if (dst_offset == 0 && stable_indices)
+		{
+			continue;
+		}
+
+		// the buffer keeps the bytes the segments point into, so its contents no longer match the new view offsets
+		buffer->size = dst_offset;
+	}
+
+	if (!stable_indices)
+	{
+		removeEmptyBuffers(data, bins);
 	}
 }
 
-static void write(std::string output, std::string in_json, std::string in_bin)
+static void writeUint32(char* dst, uint32_t value)
 {
-	std::ifstream in_json_st(in_json, std::ios::binary);
-	std::ifstream in_bin_st(in_bin, std::ios::binary);
-	std::ofstream out_st(output, std::ios::trunc | std::ios::binary);
+	dst[0] = char(value);
+	dst[1] = char(value >> 8);
+	dst[2] = char(value >> 16);
+	dst[3] = char(value >> 24);
+}
 
-	in_json_st.seekg(0, std::ios::end);
-	uint32_t json_size = (uint32_t)in_json_st.tellg();
-	in_json_st.seekg(0, std::ios::beg);
+static bool writeGlb(cgltf_data* data, GlbOutput& glb, Report* report)
+{
+	cgltf_options options = {};
+	options.write_compact = true;
+	std::vector<char>& json = glb.json;
 
-	in_bin_st.seekg(0, std::ios::end);
-	uint32_t bin_size = (uint32_t)in_bin_st.tellg();
-	in_bin_st.seekg(0, std::ios::beg);
+	{
+		StageTimer timer(report, Stage_WriteJson);
 
-	uint32_t total_size = GlbHeaderSize + GlbChunkHeaderSize + json_size + bin_size;
+		char* json_data = nullptr;
+		cgltf_size json_size = 0;
 
-	out_st.write(reinterpret_cast<const char*>(&GlbMagic), 4);
-	out_st.write(reinterpret_cast<const char*>(&GlbVersion), 4);
-	out_st.write(reinterpret_cast<const char*>(&total_size), 4);
+		if (cgltf_write_json(&options, data, &json_data, &json_size) != cgltf_result_success)
+		{
+			return false;
+		}
 
-	out_st.write(reinterpret_cast<const char*>(&json_size), 4);
-	out_st.write(reinterpret_cast<const char*>(&GlbMagicJsonChunk), 4);
+		json.assign(json_data, json_data + json_size);
+		cgltf_write_free_json(&options, json_data);
+	}
 
-	out_st << in_json_st.rdbuf();
-	out_st << in_bin_st.rdbuf();
+	StageTimer timer(report, Stage_WriteGlb);
 
-	out_st.close();
-}
+	// chunks start at 4-byte boundaries; the JSON chunk is padded with spaces and binary chunks with zeros
+	json.resize((json.size() + 3) & ~size_t(3), ' ');
 
-static int vrmpack(const char* input, const char* output, Settings settings)
-{
-	std::vector<Mesh*> meshes;
-	cgltf_data* data = parse(input, meshes);
+	size_t total_size = GlbHeaderSize + GlbChunkHeaderSize + json.size();
+	size_t missing_size = 0;
 
-	if (data == nullptr)
+	for (cgltf_size i = 0; i < data->buffers_count; ++i)
 	{
-		return cgltf_result_invalid_gltf;
-	}
+		cgltf_buffer* buffer = &data->buffers[i];
+		size_t chunk_size = (buffer->size + 3) & ~cgltf_size(3);
 
-	std::stringstream inss_json;
+		total_size += GlbChunkHeaderSize + chunk_size;
 
-	inss_json << output << ".in.json";
-	cgltf_options write_options = {};
-	cgltf_write_file(&write_options, inss_json.str().c_str(), data);
+		if (!cgltf_buffer_data(buffer))
+		{
+			if (buffer->lazy_path)
+			{
+				fprintf(stderr, "Failed to read buffer %s\n", buffer->lazy_path);
+				return false;
+			}
 
-	for (size_t i = 0; i < meshes.size(); ++i)
+			missing_size = std::max(missing_size, chunk_size);
+		}
+	}
+
+	if (total_size > 0xffffffffu)
 	{
-		processMesh(meshes[i], settings);
+		return false;
 	}
 
-	processBuffers(data, meshes);
+	// segments point into these, so they are sized before any segment is added
+	glb.headers.resize(GlbHeaderSize + GlbChunkHeaderSize + GlbChunkHeaderSize * data->buffers_count);
+	glb.zeros.assign(missing_size, 0);
+	glb.segments.clear();
 
-	std::stringstream outss_json;
-	std::stringstream outss_bin;
+	char* header = &glb.headers[0];
+	writeUint32(header + 0, GlbMagic);
+	writeUint32(header + 4, GlbVersion);
+	writeUint32(header + 8, uint32_t(total_size));
+	writeUint32(header + 12, uint32_t(json.size()));
+	writeUint32(header + 16, GlbMagicJsonChunk);
 
-	outss_json << output << ".json";
-	outss_bin << output << ".bin";
+	appendSegment(glb.segments, header, GlbHeaderSize + GlbChunkHeaderSize);
+	appendSegment(glb.segments, &json[0], json.size());
 
-	std::string out_json = outss_json.str();
-	std::string out_bin = outss_bin.str();
+	for (cgltf_size i = 0; i < data->buffers_count; ++i)
+	{
+		const cgltf_buffer* buffer = &data->buffers[i];
+		size_t chunk_size = (buffer->size + 3) & ~cgltf_size(3);
 
-	cgltf_write_file(&write_options, out_json.c_str(), data);
+		char* chunk_header = header + GlbHeaderSize + GlbChunkHeaderSize + GlbChunkHeaderSize * i;
+		writeUint32(chunk_header + 0, uint32_t(chunk_size));
+		writeUint32(chunk_header + 4, GlbMagicBinChunk);
 
-	write_bin(data, out_bin);
-	write(output, out_json, out_bin);
+		appendSegment(glb.segments, chunk_header, GlbChunkHeaderSize);
 
-	// clean up
-	for (size_t i = 0; i < meshes.size(); ++i)
-	{
-		delete meshes[i];
+		if (i < glb.bins.size() && !glb.bins[i].empty())
+		{
+			for (size_t j = 0; j < glb.bins[i].size(); ++j)
+			{
+				appendSegment(glb.segments, glb.bins[i][j].data, glb.bins[i][j].size);
+			}
+		}
+		else if (buffer->data)
+		{
+			appendSegment(glb.segments, (const char*)buffer->data, buffer->size);
+			appendSegment(glb.segments, kZeros, chunk_size - buffer->size);
+		}
+		else
+		{
+			appendSegment(glb.segments, glb.zeros.data(), chunk_size);
+		}
 	}
-	meshes.clear();
-
-	cgltf_free(data);
 
-	return 0;
+	return true;
 }
 
-int main(int argc, char** argv)
+static void gatherGlb(const GlbOutput& glb, std::vector<char>& result)
 {
-	Settings settings = defaults();
-
-	const char* input = 0;
-	const char* output = 0;
-	bool help = false;
+	size_t size = 0;
+	for (size_t i = 0; i < glb.segments.size(); ++i)
+	{
+		size += glb.segments[i].size;
+	}
 
-	std::vector<const char*> testinputs;
+	result.clear();
+	result.reserve(size);
 
-	for (int i = 1; i < argc; ++i)
+	for (size_t i = 0; i < glb.segments.size(); ++i)
 	{
-		const char* arg = argv[i];
+		result.insert(result.end(), glb.segments[i].data, glb.segments[i].data + glb.segments[i].size);
+	}
+}
 
-		if (strcmp(arg, "-si") == 0 && i + 1 < argc && isdigit(argv[i + 1][0]))
-		{
-			settings.simplify_threshold = float(atof(argv[++i]));
-		}
-		else if (strcmp(arg, "-sa") == 0)
-		{
-			settings.simplify_aggressive = true;
-		}
-		else if (strcmp(arg, "-i") == 0 && i + 1 < argc && !input)
+#ifndef _WIN32
+static bool writeVectors(int fd, std::vector<iovec>& vectors)
+{
+	size_t first = 0;
+
+	while (first < vectors.size())
+	{
+		ssize_t written = writev(fd, &vectors[first], int(std::min(vectors.size() - first, size_t(IOV_MAX))));
+		if (written < 0)
 		{
-			input = argv[++i];
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			return false;
 		}
-		else if (strcmp(arg, "-o") == 0 && i + 1 < argc && !output)
+
+		// skip the vectors that were written completely and advance into a partially written one
+		size_t left = size_t(written);
+		while (first < vectors.size() && left >= vectors[first].iov_len)
 		{
-			output = argv[++i];
+			left -= vectors[first].iov_len;
+			first++;
 		}
-		else if (strcmp(arg, "-v") == 0)
+
+		if (left)
 		{
-			settings.verbose = 1;
+			vectors[first].iov_base = (char*)vectors[first].iov_base + left;
+			vectors[first].iov_len -= left;
 		}
-		else if (strcmp(arg, "-vv") == 0)
+	}
+
+	vectors.clear();
+	return true;
+}
+
+// copies a range of the input file to the output without bringing it into memory; returns the number of bytes copied, which may fall short when the file systems do not support it
+static size_t copyFileRange(int source, size_t offset, int fd, size_t size)
+{
+#ifdef __linux__
+	loff_t source_offset = loff_t(offset);
+	size_t copied = 0;
+
+	while (copied < size)
+	{
+		ssize_t result = copy_file_range(source, &source_offset, fd, NULL, size - copied, 0);
+		if (result <= 0)
 		{
-			settings.verbose = 2;
+			break;
 		}
-		else if (strcmp(arg, "-h") == 0)
+
+		copied += size_t(result);
+	}
+
+	return copied;
+#else
+	(void)source;
+	(void)offset;
+	(void)fd;
+	(void)size;
+	return 0;
+#endif
+}
+#endif
+
+static bool writeGlbFile(const GlbOutput& glb, const cgltf_data* data, const char* input, const char* output)
+{
+#ifdef _WIN32
+	(void)data;
+	(void)input;
+
+	std::ofstream out_st(output, std::ios::trunc | std::ios::binary);
+	for (size_t i = 0; i < glb.segments.size(); ++i)
+	{
+		out_st.write(glb.segments[i].data, glb.segments[i].size);
+	}
+	out_st.close();
+
+	return !out_st.fail();
+#else
+	// the input stays mapped while writing, so the output is written next to it and renamed over it instead of truncating a file that may be the input
+	std::string temp = std::string(output) + ".tmp";
+
+	int fd = open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	// bytes that still sit unmodified in the binary chunk of the mapped input can be copied from the file directly
+	const char* file_data = (const char*)data->file_data;
+	const char* bin = (const char*)data->bin;
+	int source = file_data && bin ? open(input, O_RDONLY) : -1;
+
+	std::vector<iovec> vectors;
+	bool success = true;
+
+	for (size_t i = 0; i < glb.segments.size() && success; ++i)
+	{
+		const GlbSegment& segment = glb.segments[i];
+		size_t copied = 0;
+
+		if (source >= 0 && segment.size >= kFileCopySize && segment.data >= bin && segment.data + segment.size <= bin + data->bin_size)
 		{
-			help = true;
+			success = writeVectors(fd, vectors);
+			copied = success ? copyFileRange(source, size_t(segment.data - file_data), fd, segment.size) : 0;
 		}
-		else if (arg[0] == '-')
+
+		if (copied < segment.size)
 		{
-			fprintf(stderr, "Unrecognized option %s\n", arg);
-			return 1;
+			iovec vector = {(void*)(segment.data + copied), segment.size - copied};
+			vectors.push_back(vector);
 		}
 	}
 
-	// shortcut for vrmpack -v
-	if (settings.verbose && argc == 2)
+	success = success && writeVectors(fd, vectors);
+
+	if (source >= 0)
+	{
+		close(source);
+	}
+
+	success = (close(fd) == 0) && success;
+	success = success && rename(temp.c_str(), output) == 0;
+
+	if (!success)
+	{
+		unlink(temp.c_str());
+	}
+
+	return success;
+#endif
+}
+
+static void process(cgltf_data* data, std::vector<Mesh*>& meshes, const Settings& settings, GlbOutput& glb, Report* report)
+{
+	std::atomic<int> cache_hits(0);
+
+	if (report)
 	{
-		printf("vrmpack %s\n", getVersion().c_str());
-		return 0;
+		report->meshes.resize(meshes.size());
 	}
 
-	if (!input || !output || help)
 	{
-		fprintf(stderr, "vrmpack %s\n", getVersion().c_str());
-		fprintf(stderr, "Usage: vrmpack [options] -i input -o output\n");
+		StageTimer timer(report, Stage_Simplify);
+
+		parallelFor(meshes.size(), settings.thread_count, [&](size_t i) {
+			MeshStatistics before = {}, after = {};
+
+			if (report && settings.statistics)
+			{
+				analyzeMesh(*meshes[i], before);
+			}
+
+			// analysis is kept out of the measured time
+			double start = report || isTracing() ? getTime() : 0;
+			size_t source_index_count = meshes[i]->indices.size();
+			bool cached = false;
+
+			if (!settings.cache_path)
+			{
+				processMesh(meshes[i], settings);
+			}
+			else
+			{
+				// the entry is keyed by the source data, so it has to be computed before processing replaces the indices
+				std::string entry = getCacheEntry(settings.cache_path, *meshes[i], settings);
+
+				cached = loadCachedMesh(entry, *meshes[i]);
+
+				if (!cached)
+				{
+					processMesh(meshes[i], settings);
+					storeCachedMesh(entry, *meshes[i], source_index_count);
+				}
+			}
 
-		if (help)
+			cache_hits += cached;
+
+			double end = report || isTracing() ? getTime() : 0;
+
+			if (report && settings.statistics)
+			{
+				analyzeMesh(*meshes[i], after);
+			}
+
+			if (report || isTracing())
+			{
+
+				traceEvent(cached ? "mesh_cached" : "mesh_simplify", "mesh", meshes[i]->name.c_str(), start, end, source_index_count / 3, meshes[i]->indices.size() / 3);
+
+				if (report)
+				{
+					MeshReport& result = report->meshes[i];
+					result.name = meshes[i]->name;
+					result.vertex_count = meshes[i]->vertex_count;
+					result.triangles_before = source_index_count / 3;
+					result.triangles_after = meshes[i]->indices.size() / 3;
+					result.cached = cached;
+					result.time = end - start;
+					result.before = before;
+					result.after = after;
+				}
+			}
+		});
+	}
+
+	if (settings.cache_path && settings.verbose)
+	{
+		fprintf(stderr, "cache: %d/%d meshes reused\n", int(cache_hits), int(meshes.size()));
+	}
+
+	// top-level extensions that cgltf does not parse are written back as they are, so any index they hold has to stay valid
+	bool stable_indices = data->data_extensions_count > 0;
+
+	if (stable_indices && settings.verbose)
+	{
+		for (cgltf_size i = 0; i < data->data_extensions_count; ++i)
 		{
-			fprintf(stderr, "\nBasics:\n");
-			fprintf(stderr, "\t-i file: input file to process, .vrm\n");
-			fprintf(stderr, "\t-o file: output file path, .vrm\n");
-			fprintf(stderr, "\nSimplification:\n");
-			fprintf(stderr, "\t-si R: simplify meshes to achieve the ratio R (default: 1; R should be between 0 and 1)\n");
-			fprintf(stderr, "\t-sa: aggressively simplify to the target ratio disregarding quality\n");
-			fprintf(stderr, "\nMiscellaneous:\n");
-			fprintf(stderr, "\t-v: verbose output (print version when used without other options)\n");
-			fprintf(stderr, "\t-h: display this help and exit\n");
+			fprintf(stderr, "extensions: %s is copied as is; materials, textures and images are not merged or removed\n", data->data_extensions[i].name);
 		}
-		else
+	}
+
+	if (!settings.keep_materials && !stable_indices)
+	{
+		StageTimer timer(report, Stage_Materials);
+		processMaterials(data, settings);
+	}
+
+	if (settings.texture_atlas && !stable_indices)
+	{
+		StageTimer timer(report, Stage_Atlas);
+		atlasMaterials(data, settings);
+	}
+
+	if (!settings.keep_images && !stable_indices)
+	{
+		StageTimer timer(report, Stage_Images);
+		processImages(data);
+	}
+
+	if (settings.texture_max > 0)
+	{
+		StageTimer timer(report, Stage_Textures);
+		processTextures(data, settings);
+	}
+
+	StageTimer timer(report, Stage_Buffers);
+	processBuffers(data, meshes, !settings.keep_images || settings.texture_max > 0 || settings.texture_atlas, stable_indices, glb.bins);
+}
+
+int vrmpack(const char* input, const char* output, const Settings& settings, Report* report)
+{
+	if (report)
+	{
+		report->input = input;
+		report->output = output;
+	}
+
+	std::vector<Mesh*> meshes;
+	cgltf_data* data = parse(input, meshes, report);
+
+	if (data == nullptr)
+	{
+		return cgltf_result_invalid_gltf;
+	}
+
+	std::stringstream inss_json;
+
+	inss_json << output << ".in.json";
+	cgltf_options write_options = {};
+	cgltf_write_file(&write_options, inss_json.str().c_str(), data);
+
+	GlbOutput glb;
+	process(data, meshes, settings, glb, report);
+
+	cgltf_result result = writeGlb(data, glb, report) ? cgltf_result_success : cgltf_result_invalid_gltf;
+
+	if (result == cgltf_result_success)
+	{
+		StageTimer timer(report, Stage_WriteGlb);
+
+		if (!writeGlbFile(glb, data, input, output))
 		{
-			fprintf(stderr, "\nBasics:\n");
-			fprintf(stderr, "\t-i file: input file to process, .vrm\n");
-			fprintf(stderr, "\t-o file: output file path, .vrm\n");
-			fprintf(stderr, "\t-si R: simplify meshes to achieve the ratio R (default: 1; R should be between 0 and 1)\n");
-			fprintf(stderr, "\nRun vrmpack -h to display a full list of options\n");
+			result = cgltf_result_io_error;
 		}
+	}
 
-		return 1;
+	if (result != cgltf_result_success)
+	{
+		fprintf(stderr, "Failed to write file %s\n", output);
 	}
 
-	return vrmpack(input, output, settings);
+	release(data, meshes);
+
+	return result;
+}
+
+int vrmpack(const void* buffer, size_t size, std::vector<char>& output, const Settings& settings, const cgltf_memory_options& memory, Report* report)
+{
+	cgltf_options options = {};
+
+	// the data keeps these callbacks, so everything allocated while processing goes through them as well
+	options.memory = memory.alloc ? memory : getReportAllocator(report);
+	options.memory.arena = true;
+
+	ParsedFile file;
+	file.data = parseBuffer(options, buffer, size, nullptr, file.meshes, report);
+
+	if (file.data == nullptr)
+	{
+		return cgltf_result_invalid_gltf;
+	}
+
+	GlbOutput glb;
+	process(file.data, file.meshes, settings, glb, report);
+
+	cgltf_result result = writeGlb(file.data, glb, report) ? cgltf_result_success : cgltf_result_invalid_gltf;
+
+	if (result == cgltf_result_success)
+	{
+		StageTimer timer(report, Stage_WriteGlb);
+		gatherGlb(glb, output);
+	}
+
+	return result;
 }
@@ -0,0 +1,70 @@
+#ifndef VRMPACK_H_INCLUDED__
+#define VRMPACK_H_INCLUDED__
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Allocation callbacks; when set, both must be provided */
+typedef struct vrmpack_allocator
+{
+	void* (*alloc)(void* user_data, size_t size);
+	void (*free)(void* user_data, void* ptr);
+	void* user_data;
+} vrmpack_allocator;
+
+typedef struct vrmpack_settings
+{
+	float simplify_threshold; /* target index count ratio, between 0 and 1 */
+	int simplify_aggressive;
+
+	int texture_max; /* 0 = no limit */
+	int texture_atlas;
+
+	int keep_images;
+	int keep_materials;
+
+	int thread_count; /* 0 = one per hardware thread */
+
+	/* used for the glTF data while processing and for the output; other temporary memory comes from the C++ runtime */
+	vrmpack_allocator allocator;
+} vrmpack_settings;
+
+typedef struct vrmpack_output
+{
+	void* data;
+	size_t size;
+
+	/* allocator that owns data, used by vrmpack_free_output */
+	vrmpack_allocator allocator;
+} vrmpack_output;
+
+typedef enum vrmpack_result
+{
+	vrmpack_result_success,
+	vrmpack_result_invalid_argument,
+	vrmpack_result_invalid_input,
+	vrmpack_result_out_of_memory,
+	vrmpack_result_internal_error /* processing failed unexpectedly; the input is not necessarily invalid */
+} vrmpack_result;
+
+/* Fills settings with the defaults used by the command line tool */
+void vrmpack_default_settings(vrmpack_settings* settings);
+
+/**
+ * Processes a .vrm file in memory and writes the resulting .vrm to output, which must be released with vrmpack_free_output
+ * Safe to call concurrently from multiple threads; no files are read or written
+ *
+ * settings can be NULL to use the defaults
+ */
+vrmpack_result vrmpack_process(const void* in, size_t in_size, const vrmpack_settings* settings, vrmpack_output* output);
+
+void vrmpack_free_output(vrmpack_output* output);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* #ifdef VRMPACK_H_INCLUDED__ */
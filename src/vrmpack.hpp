@@ -1,6 +1,9 @@
 #ifndef VRMPACK_HPP_INCLUDED__
 #define VRMPACK_HPP_INCLUDED__
 
+#include <stdio.h>
+
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -25,12 +28,21 @@ struct Mesh
 
 	size_t vertex_count;
 	size_t vertex_positions_stride;
+	size_t vertex_size; // bytes per vertex across all attributes
 
 	cgltf_accessor* indices_accessor;
 
 	std::vector<cgltf_float> positions;
 };
 
+struct Image
+{
+	int width;
+	int height;
+
+	std::vector<uint8_t> pixels; // RGBA8, row-major
+};
+
 struct Settings
 {
 	float simplify_threshold;
@@ -40,10 +52,151 @@ struct Settings
 	float target_error;
 	float target_error_aggressive;
 
+	bool keep_images;
+	bool keep_materials;
+	int texture_max;
+	bool texture_atlas;
+
+	const char* cache_path;
+	uint64_t cache_limit;
+
+	int thread_count;
+
+	bool statistics;
+
 	int verbose;
 };
 
+enum Stage
+{
+	Stage_Read,
+	Stage_Parse,
+	Stage_LoadBuffers,
+	Stage_Simplify,
+	Stage_Materials,
+	Stage_Atlas,
+	Stage_Images,
+	Stage_Textures,
+	Stage_Buffers,
+	Stage_WriteJson,
+	Stage_WriteGlb,
+
+	Stage_Count
+};
+
+// raw counters from the meshoptimizer analyzers; they are summed over primitives for per-file totals
+struct MeshStatistics
+{
+	uint64_t triangles;
+	uint64_t vertices;
+	uint64_t vertices_referenced; // simplification leaves unreferenced vertices in the buffer
+	uint64_t vertices_transformed;
+	uint64_t pixels_covered;
+	uint64_t pixels_shaded;
+	uint64_t bytes_fetched;
+	uint64_t vertex_bytes;
+};
+
+struct MeshReport
+{
+	std::string name;
+
+	size_t vertex_count;
+	size_t triangles_before;
+	size_t triangles_after;
+
+	bool cached;
+	double time; // milliseconds
+
+	// only filled in when Settings::statistics is set
+	MeshStatistics before;
+	MeshStatistics after;
+};
+
+struct Report
+{
+	std::string input;
+	std::string output;
+	int result;
+
+	double stages[Stage_Count]; // milliseconds, wall clock
+	std::vector<MeshReport> meshes;
+
+	// allocations made through the cgltf memory callbacks for this file
+	uint64_t allocations;
+	uint64_t allocated_bytes;
+};
+
+struct StageTimer
+{
+	Report* report;
+	Stage stage;
+	double start;
+
+	StageTimer(Report* report, Stage stage);
+	~StageTimer();
+};
 
 } // namespace VRM
 
+std::string getVersion();
+VRM::Settings getDefaultSettings();
+
+int vrmpack(const char* input, const char* output, const VRM::Settings& settings, VRM::Report* report);
+int vrmpack(const void* buffer, size_t size, std::vector<char>& output, const VRM::Settings& settings, const cgltf_memory_options& memory, VRM::Report* report);
+
+double getTime();
+const char* getStageName(VRM::Stage stage);
+uint64_t getPeakMemory();
+cgltf_memory_options getReportAllocator(VRM::Report* report);
+void countMeshoptAllocations();
+void printReport(const VRM::Report& report);
+bool writeReport(const char* path, const std::vector<VRM::Report>& reports);
+void writeJsonString(FILE* file, const char* value);
+
+void analyzeMesh(const VRM::Mesh& mesh, VRM::MeshStatistics& result);
+bool writeStatistics(const char* path, const std::vector<VRM::Report>& reports);
+
+void startTrace();
+bool isTracing();
+void traceEvent(const char* name, const char* detail_key, const char* detail, double start, double end, long long triangles_before = -1, long long triangles_after = -1);
+bool writeTrace(const char* path);
+
+const int kTextureViewCount = 14;
+
+int getTextureViews(cgltf_material& material, cgltf_texture_view* (&views)[kTextureViewCount]);
+void freeExtensions(cgltf_data* data, cgltf_extension* extensions, cgltf_size count);
+
+bool decodeImage(const cgltf_image& image, VRM::Image& result, bool& jpeg);
+bool encodeImage(const VRM::Image& image, bool jpeg, std::vector<uint8_t>& result);
+
+void processImages(cgltf_data* data);
+void processTextures(cgltf_data* data, const VRM::Settings& settings);
+
+void processMaterials(cgltf_data* data, const VRM::Settings& settings);
+void atlasMaterials(cgltf_data* data, const VRM::Settings& settings);
+
+bool listDirectory(const char* path, std::vector<std::string>& result);
+bool getFileInfo(const char* path, uint64_t& size, int64_t& mtime);
+void touchFile(const char* path);
+
+std::string getCacheEntry(const char* directory, const VRM::Mesh& mesh, const VRM::Settings& settings);
+bool loadCachedMesh(const std::string& path, VRM::Mesh& mesh);
+bool storeCachedMesh(const std::string& path, const VRM::Mesh& mesh, size_t source_index_count);
+void trimCache(const char* directory, uint64_t limit, int verbose);
+
+typedef std::function<int(const std::string& options, const std::vector<char>& input, std::vector<char>& output)> ServeCallback;
+
+int serve(const char* path, int jobs, int timeout, const ServeCallback& callback);
+int request(const char* path, const std::string& options, const std::vector<char>& input, std::vector<char>& output);
+
+int getThreadCount(int requested);
+void parallelFor(size_t count, int thread_count, const std::function<void(size_t)>& body);
+
+bool decodePng(const uint8_t* data, size_t size, VRM::Image& image);
+bool encodePng(const VRM::Image& image, std::vector<uint8_t>& result);
+
+bool decodeJpeg(const uint8_t* data, size_t size, VRM::Image& image);
+bool encodeJpeg(const VRM::Image& image, int quality, std::vector<uint8_t>& result);
+
 #endif /* #ifdef VRMPACK_HPP_INCLUDED__ */